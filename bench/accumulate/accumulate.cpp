@@ -0,0 +1,75 @@
+#include <simdee/algorithm.hpp>
+#include <simdee/simdee.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+
+// L1-resident, so that the sums are bound by the latency of the additions, not by memory
+const std::size_t n = 4096;
+const int repeats = 1000;
+volatile float sink;
+
+void report(const std::string& name, double ms) {
+    const double gflops = double(n) * repeats / (ms * 1.e6);
+    std::cout << std::setw(24) << name << std::fixed << std::setprecision(2) << std::setw(12)
+              << gflops << "\n";
+}
+
+template <std::size_t K>
+void run_sum(const std::vector<float>& in) {
+    const double ms = benchmark_ms([&]() {
+        for (int r = 0; r < repeats; ++r) sink = sd::accumulate<K, F>(sd::view(in), sd::op_add{});
+    });
+    report(K == 0 ? "sd::accumulate, default" : "sd::accumulate, K = " + std::to_string(K), ms);
+}
+
+int main() {
+    std::vector<float> in(n);
+    for (std::size_t i = 0; i < n; ++i) in[i] = float(i % 100) * 0.01f;
+
+    std::cout << hline << "Benchmark: Sum of " << n << " floats, " << F::width << " lanes, K = "
+              << sd::default_unroll<F>::value << " by default (Gflop/s)\n"
+              << hline;
+    const double ms = benchmark_ms([&]() {
+        for (int r = 0; r < repeats; ++r) sink = std::accumulate(in.begin(), in.end(), 0.f);
+    });
+    report("std::accumulate", ms);
+    run_sum<1>(in);
+    run_sum<2>(in);
+    run_sum<4>(in);
+    run_sum<8>(in);
+    run_sum<16>(in);
+    run_sum<0>(in);
+    std::cout << hline;
+}
@@ -0,0 +1,142 @@
+#include <simdee/simdee.hpp>
+#include <simdee/util/allocator.hpp>
+#include <simdee/util/arena.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+volatile float sink;
+
+void print(const std::string& name, double time) {
+    std::cout << std::setw(36) << name << std::fixed << std::setprecision(3) << std::setw(12)
+              << time << "\n";
+}
+
+// the scratch buffers of a frame: a few vectors of 16 KiB to 1 MiB, written and read once
+const std::size_t frames = 200;
+const std::size_t buffer_floats[] = {4096, 65536, 262144, 16384, 131072, 4096, 262144, 32768};
+
+template <typename Alloc, typename Reset>
+void run_frames(const Alloc& alloc, Reset reset) {
+    float total = 0.f;
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        reset();
+        std::vector<std::vector<float, Alloc>> buffers;
+        for (std::size_t n : buffer_floats) buffers.emplace_back(n, float(frame), alloc);
+        F sum = sd::zero();
+        for (auto& b : buffers) {
+            for (std::size_t i = 0; i < b.size(); i += F::width) {
+                sum = sum + F(sd::unaligned(b.data() + i));
+            }
+        }
+        total += sd::hsum(sum);
+    }
+    sink = total;
+}
+
+void scratch() {
+    std::cout << hline << frames << " frames of scratch buffers, time in ms\n";
+    print("std::allocator", benchmark_ms([]() { run_frames(std::allocator<float>(), []() {}); }));
+    print("sd::allocator", benchmark_ms([]() { run_frames(sd::allocator<float>(), []() {}); }));
+    for (sd::huge_pages mode : {sd::huge_pages::none, sd::huge_pages::advise}) {
+        sd::arena arena(std::size_t(8) << 20, mode);
+        const sd::arena_allocator<float, 64> alloc(arena);
+        const std::string name = mode == sd::huge_pages::none ? "" : ", huge pages";
+        print("sd::arena_allocator" + name,
+              benchmark_ms([&]() { run_frames(alloc, [&]() { arena.reset(); }); }));
+    }
+}
+
+// a list that grows and shrinks, one allocation per node
+const std::size_t nodes = 1 << 20;
+
+template <typename Alloc>
+void run_list(const Alloc& alloc) {
+    std::list<std::uint64_t, Alloc> list(alloc);
+    for (std::size_t i = 0; i < nodes; ++i) list.push_back(i);
+    list.remove_if([](std::uint64_t i) { return i % 3 == 0; });
+    for (std::size_t i = 0; i < nodes / 2; ++i) list.push_front(i);
+    std::uint64_t sum = 0;
+    for (std::uint64_t i : list) sum += i;
+    sink = float(sum);
+}
+
+void nodes_pool() {
+    std::cout << hline << nodes << " list nodes, time in ms\n";
+    print("std::allocator", benchmark_ms([]() { run_list(std::allocator<std::uint64_t>()); }));
+    sd::pool pool(32, 32);
+    print("sd::pool_allocator", benchmark_ms([&]() {
+              run_list(sd::pool_allocator<std::uint64_t>(pool));
+              pool.reset();
+          }));
+}
+
+// random reads from a large buffer, where a TLB miss precedes most cache misses unless the
+// buffer is backed by huge pages
+const std::size_t big_floats = std::size_t(64) << 20;
+const std::size_t reads = std::size_t(1) << 24;
+
+void random_reads() {
+    std::cout << hline << reads << " random reads from " << (big_floats * sizeof(float) >> 20)
+              << " MiB, time in ms\n";
+    for (sd::huge_pages mode :
+         {sd::huge_pages::none, sd::huge_pages::advise, sd::huge_pages::mapped}) {
+        sd::arena arena(big_floats * sizeof(float), mode);
+        float* data = static_cast<float*>(arena.allocate(big_floats * sizeof(float), 4096));
+        for (std::size_t i = 0; i < big_floats; ++i) data[i] = float(i & 0xff);
+        const double time = benchmark_ms([&]() {
+            std::uint64_t state = 12345;
+            float sum = 0.f;
+            for (std::size_t i = 0; i < reads; ++i) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                sum += data[(state >> 33) % big_floats];
+            }
+            sink = sum;
+        });
+        print(mode == sd::huge_pages::none
+                  ? "sd::arena"
+                  : mode == sd::huge_pages::advise ? "sd::arena, MADV_HUGEPAGE"
+                                                   : "sd::arena, MAP_HUGETLB",
+              time);
+    }
+}
+
+int main() {
+    std::cout << hline << "Benchmark: sd::allocator vs. sd::arena and sd::pool\n";
+    scratch();
+    nodes_pool();
+    random_reads();
+    std::cout << hline;
+}
@@ -0,0 +1,84 @@
+#include <simdee/simdee.hpp>
+#include <simdee/util/allocator.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using vec_t = sd::vec8f;
+using buffer_t = std::vector<vec_t, sd::allocator<vec_t>>;
+
+// a write-only pass, every output line is written in full and never read back
+template <typename Target>
+void fill(buffer_t& data, Target target) {
+    float* ptr = reinterpret_cast<float*>(data.data());
+    float* end = ptr + data.size() * vec_t::width;
+    vec_t v = 1.f;
+    const vec_t step = 1.f;
+    for (; ptr != end; ptr += vec_t::width) {
+        target(ptr) = v;
+        v = v + step;
+    }
+}
+
+int main(int argc, char** argv) {
+    // the sizes should include some that exceed the last level cache
+    std::vector<std::size_t> sizes_mib = {1, 4, 16, 64, 256, 1024};
+    if (argc > 1) {
+        sizes_mib.clear();
+        for (int i = 1; i < argc; ++i) { sizes_mib.push_back(std::strtoul(argv[i], nullptr, 10)); }
+    }
+
+    std::cout << hline << "Benchmark: Write-only bandwidth, aligned vs. streaming stores\n"
+              << hline << "   size (MiB)     aligned (GB/s)   streaming (GB/s)    speedup\n";
+
+    for (std::size_t size_mib : sizes_mib) {
+        const std::size_t bytes = size_mib * 1024 * 1024;
+        buffer_t data(bytes / sizeof(vec_t));
+
+        const double alignedMs = benchmark_ms([&data]() {
+            fill(data, [](float* p) { return sd::aligned(p); });
+        });
+        const double streamingMs = benchmark_ms([&data]() {
+            fill(data, [](float* p) { return sd::streaming(p); });
+            sd::stream_fence();
+        });
+
+        // keep the stores observable
+        if (first_scalar(data.back()) == 0.f) { std::cout << "Unexpected result!\n"; }
+
+        const double gb = double(bytes) / 1.e9;
+        std::cout << std::fixed << std::setprecision(2) << std::setw(13) << size_mib
+                  << std::setw(19) << gb / (alignedMs / 1.e3) << std::setw(19)
+                  << gb / (streamingMs / 1.e3) << std::setw(10) << alignedMs / streamingMs
+                  << "x\n";
+    }
+    std::cout << hline;
+}
@@ -0,0 +1,119 @@
+#include <simdee/simdee.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+const float scale[] = {0.5f, 0.25f, 0.125f, 0.0625f};
+
+// every kernel replaces channel c of each record with p[c] * scale[c] + p[(c + 1) % N], which
+// reads and writes all channels of the interleaved data
+template <std::size_t N>
+void kernel_scalar(float* ptr, std::size_t records) {
+    for (std::size_t i = 0; i < records; ++i) {
+        float* p = ptr + i * N;
+        float r[N];
+        for (std::size_t c = 0; c < N; ++c) r[c] = p[c] * scale[c] + p[(c + 1) % N];
+        for (std::size_t c = 0; c < N; ++c) p[c] = r[c];
+    }
+}
+
+template <std::size_t N>
+void kernel_strided(float* ptr, std::size_t records) {
+    for (std::size_t i = 0; i < records; i += F::width) {
+        float* p = ptr + i * N;
+        F v[N];
+        for (std::size_t c = 0; c < N; ++c) v[c] = sd::interleaved(p + c, int(N));
+        for (std::size_t c = 0; c < N; ++c) {
+            sd::interleaved(p + c, int(N)) = v[c] * F(scale[c]) + v[(c + 1) % N];
+        }
+    }
+}
+
+template <std::size_t N>
+struct transposed;
+template <>
+struct transposed<2> {
+    static void apply(float* p) {
+        F x, y;
+        sd::load_deinterleave<2>(p, x, y);
+        sd::store_interleave<2>(p, x * F(scale[0]) + y, y * F(scale[1]) + x);
+    }
+};
+template <>
+struct transposed<3> {
+    static void apply(float* p) {
+        F x, y, z;
+        sd::load_deinterleave<3>(p, x, y, z);
+        sd::store_interleave<3>(p, x * F(scale[0]) + y, y * F(scale[1]) + z,
+                                z * F(scale[2]) + x);
+    }
+};
+template <>
+struct transposed<4> {
+    static void apply(float* p) {
+        F r, g, b, a;
+        sd::load_deinterleave<4>(p, r, g, b, a);
+        sd::store_interleave<4>(p, r * F(scale[0]) + g, g * F(scale[1]) + b,
+                                b * F(scale[2]) + a, a * F(scale[3]) + r);
+    }
+};
+
+template <std::size_t N>
+void kernel_transposed(float* ptr, std::size_t records) {
+    for (std::size_t i = 0; i < records; i += F::width) transposed<N>::apply(ptr + i * N);
+}
+
+template <std::size_t N>
+void run(std::size_t records) {
+    std::vector<float> data(records * N);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = float(i % 1000);
+
+    const double scalar = benchmark_ms([&]() { kernel_scalar<N>(data.data(), records); });
+    const double strided = benchmark_ms([&]() { kernel_strided<N>(data.data(), records); });
+    const double transposed = benchmark_ms([&]() { kernel_transposed<N>(data.data(), records); });
+
+    std::cout << std::setw(12) << N << std::fixed << std::setprecision(3) << std::setw(12)
+              << scalar << std::setw(12) << strided << std::setw(16) << transposed << "\n";
+}
+
+int main() {
+    std::cout << hline << "Benchmark: interleaved N-channel data, scalar vs. sd::interleaved() vs. "
+                          "sd::load_deinterleave()\n";
+    for (std::size_t records : {std::size_t(64 * 1024), std::size_t(4 * 1024 * 1024)}) {
+        std::cout << hline << records << " records, " << F::width << " lanes, time in ms\n";
+        std::cout << "    channels      scalar     strided    deinterleave\n";
+        run<2>(records);
+        run<3>(records);
+        run<4>(records);
+    }
+    std::cout << hline;
+}
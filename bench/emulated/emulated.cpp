@@ -0,0 +1,118 @@
+#include <simdee/math.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+#include <simdee/simd_vectors/gnu.hpp>
+#include <simdee/util/allocator.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using fbuffer_t = std::vector<float, sd::allocator<float>>;
+using ubuffer_t = std::vector<uint32_t, sd::allocator<uint32_t>>;
+
+// a clamped polynomial, mostly arithmetic with a few comparisons
+template <typename F>
+void polynomial(const float* in, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += F::width) {
+        const F x = sd::aligned(in + i);
+        F y = fma(fma(fma(x, F(0.25f), F(-0.5f)), x, F(1.5f)), x, F(2.f));
+        y = min(max(y, F(sd::zero())), F(8.f));
+        y.aligned_store(out + i);
+    }
+}
+
+// sd::exp, which mixes float and integer operations
+template <typename F>
+void exponential(const float* in, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += F::width) {
+        const F x = sd::aligned(in + i);
+        sd::exp(x).aligned_store(out + i);
+    }
+}
+
+// an integer hash, multiplications, shifts and xors
+template <typename U>
+void hash(const uint32_t* in, uint32_t* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += U::width) {
+        U x = sd::aligned(in + i);
+        x = (x ^ (x >> 16)) * U(0x45d9f3bU);
+        x = (x ^ (x >> 16)) * U(0x45d9f3bU);
+        x = x ^ (x >> 16);
+        x.aligned_store(out + i);
+    }
+}
+
+template <typename Emulated, typename Gnu, typename Buffer, typename Kernel>
+void run(const std::string& name, const Buffer& in, Buffer& out, Kernel emulated, Kernel gnu) {
+    const std::size_t n = in.size();
+    const double emulatedMs = benchmark_ms([&]() { emulated(in.data(), out.data(), n); });
+    const double gnuMs = benchmark_ms([&]() { gnu(in.data(), out.data(), n); });
+
+    auto rate = [n](double ms) { return double(n) / (ms * 1.e6); };
+    std::cout << std::fixed << std::setprecision(2) << std::setw(14) << name << std::setw(5)
+              << Emulated::width << std::setw(16) << rate(emulatedMs) << std::setw(16)
+              << rate(gnuMs) << std::setw(11) << emulatedMs / gnuMs << "x\n";
+}
+
+int main() {
+    using dum4f = sd::dual<sd::dual<sd::dumf>>;
+    using dum4u = sd::dual<sd::dual<sd::dumu>>;
+    using dum8f = sd::dual<dum4f>;
+    using dum8u = sd::dual<dum4u>;
+    using gnu8f = sd::dual<sd::gnuf>;
+    using gnu8u = sd::dual<sd::gnuu>;
+
+    // L2-resident arrays, so that the kernels are bound by the arithmetic
+    const std::size_t n = 32 * 1024;
+    fbuffer_t fin(n), fout(n);
+    ubuffer_t uin(n), uout(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        fin[i] = float(i % 1000) * 0.01f - 5.f;
+        uin[i] = uint32_t(i * 2654435761U);
+    }
+
+    using fkernel_t = void (*)(const float*, float*, std::size_t);
+    using ukernel_t = void (*)(const uint32_t*, uint32_t*, std::size_t);
+
+    std::cout << hline << "Benchmark: Emulated vectors, dual<dum> vs. gnu (Gscalars/s)\n" << hline;
+    std::cout << "        kernel  lanes      dual<dum>             gnu    speedup\n";
+    run<dum4f, sd::gnuf>("polynomial", fin, fout, fkernel_t(polynomial<dum4f>),
+                         fkernel_t(polynomial<sd::gnuf>));
+    run<dum8f, gnu8f>("polynomial", fin, fout, fkernel_t(polynomial<dum8f>),
+                      fkernel_t(polynomial<gnu8f>));
+    run<dum4f, sd::gnuf>("exp", fin, fout, fkernel_t(exponential<dum4f>),
+                         fkernel_t(exponential<sd::gnuf>));
+    run<dum8f, gnu8f>("exp", fin, fout, fkernel_t(exponential<dum8f>),
+                      fkernel_t(exponential<gnu8f>));
+    run<dum4u, sd::gnuu>("hash", uin, uout, ukernel_t(hash<dum4u>), ukernel_t(hash<sd::gnuu>));
+    run<dum8u, gnu8u>("hash", uin, uout, ukernel_t(hash<dum8u>), ukernel_t(hash<gnu8u>));
+    std::cout << hline;
+}
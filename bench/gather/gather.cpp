@@ -0,0 +1,112 @@
+#include <simdee/simd_vectors/avx.hpp>
+#include <simdee/util/allocator.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if !SIMDEE_AVX2
+#error "AVX2 is required to build the gather benchmark"
+#endif
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 24; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+// the implementation of interleaved_load before hardware gathers were used
+SIMDEE_INL sd::avxf temp_buffer_load(const float* r, int step) {
+    alignas(sd::avxf) float temp[sd::avxf::width];
+    for (std::size_t i = 0; i < sd::avxf::width; ++i, r += step) { temp[i] = *r; }
+    sd::avxf res;
+    res.aligned_load(temp);
+    return res;
+}
+
+// reads every float in data exactly once, splitting it into step interleaved streams
+template <typename Load>
+float transpose_sum(const std::vector<float, sd::allocator<float>>& data, int step, Load load) {
+    const std::size_t block = sd::avxf::width * std::size_t(step);
+    const float* ptr = data.data();
+    const float* end = ptr + data.size() / block * block;
+    sd::avxf acc = sd::zero();
+    for (; ptr != end; ptr += block) {
+        for (int j = 0; j < step; ++j) { acc = acc + load(ptr + j, step); }
+    }
+    return first_scalar(reduce(acc, std::plus<sd::avxf>()));
+}
+
+int main() {
+    std::cout << hline << "Benchmark: Interleaved loads, temporary buffer vs. AVX2 gather\n";
+
+    const std::size_t sizes[] = {4 * 1024, 4 * 1024 * 1024};
+    const int steps[] = {1, 2, 3, 4, 6, 8, 16, 32, 64};
+
+    for (std::size_t size : sizes) {
+        std::vector<float, sd::allocator<float>> data(size);
+        for (std::size_t i = 0; i < size; ++i) { data[i] = float(i % 1024); }
+        const std::size_t repeats = (64 * 1024 * 1024) / size;
+
+        std::cout << hline << "Data: " << size * sizeof(float) / 1024 << " KiB, " << repeats
+                  << " passes; best time in ms (speedup over temporary buffer)\n"
+                  << "   step    temp buffer     interleaved              gather\n";
+
+        for (int step : steps) {
+            float check[3] = {};
+            auto run = [&](float& res, std::function<float(int)> kernel) {
+                return benchmark_ms([&]() {
+                    for (std::size_t r = 0; r < repeats; ++r) { res += kernel(step); }
+                });
+            };
+
+            const double tempMs = run(check[0], [&](int s) {
+                return transpose_sum(data, s, temp_buffer_load);
+            });
+            const double interleavedMs = run(check[1], [&](int s) {
+                return transpose_sum(data, s, [](const float* p, int st) {
+                    return sd::avxf(sd::interleaved(p, st));
+                });
+            });
+            const double gatherMs = run(check[2], [&](int s) {
+                sd::avxs::storage_t idx;
+                for (std::size_t i = 0; i < sd::avxs::width; ++i) { idx[i] = int32_t(i) * s; }
+                const sd::avxs offsets(idx);
+                return transpose_sum(data, s, [&offsets](const float* p, int) {
+                    return sd::avxf(sd::gather(p, offsets));
+                });
+            });
+
+            if (check[0] != check[1] || check[0] != check[2]) {
+                std::cout << "Results differ!\n";
+                return 1;
+            }
+
+            std::cout << std::fixed << std::setprecision(2) << std::setw(7) << step
+                      << std::setw(15) << tempMs << std::setw(11) << interleavedMs << " ("
+                      << std::setw(4) << tempMs / interleavedMs << "x)" << std::setw(11)
+                      << gatherMs << " (" << std::setw(4) << tempMs / gatherMs << "x)\n";
+        }
+    }
+    std::cout << hline;
+}
@@ -0,0 +1,91 @@
+#include <simdee/algorithm.hpp>
+#include <simdee/math.hpp>
+#include <simdee/simdee.hpp>
+#include <simdee/util/thread_pool.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+volatile float sink;
+
+// out = a * 0.5 + b over arrays much larger than the caches, bound by memory bandwidth
+void kernel_triad(sd::thread_pool& pool, const std::vector<float>& a,
+                  const std::vector<float>& b, std::vector<float>& out) {
+    sd::par::transform<F>(a.data(), b.data(), a.size(), out.data(),
+                          [](const F& x, const F& y) { return x * F(0.5f) + y; }, pool);
+}
+
+// the sum of exp(sin(x)) over an array that fits into the caches, bound by arithmetic
+void kernel_math(sd::thread_pool& pool, const std::vector<float>& a) {
+    sink = sd::par::transform_reduce<F>(a.data(), a.size(),
+                                        [](const F& x) { return sd::exp(sd::sin(x)); },
+                                        sd::op_add{}, pool);
+}
+
+int main(int argc, char** argv) {
+    // the thread counts go up to the hardware threads, or to the first argument when given
+    const unsigned hw = std::thread::hardware_concurrency();
+    const std::size_t max_threads =
+        argc > 1 ? std::size_t(std::atoi(argv[1])) : std::size_t(hw != 0 ? hw : 1);
+
+    std::vector<float> a(std::size_t(16) << 20), b(a.size()), out(a.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = float(i % 1000) * 0.001f;
+        b[i] = float(i % 7);
+    }
+    std::vector<float> small(std::size_t(256) << 10);
+    for (std::size_t i = 0; i < small.size(); ++i) small[i] = float(i % 1000) * 0.01f;
+
+    std::cout << hline << "Benchmark: sd::par algorithms on 1 to " << max_threads
+              << " threads\n";
+    std::cout << hline << F::width << " lanes, time in ms, speedup over 1 thread\n";
+    std::cout << "     threads   triad 64 MiB x 3        exp(sin(x)) 1 MiB\n";
+    std::vector<std::size_t> counts;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2) counts.push_back(threads);
+    counts.push_back(max_threads);
+
+    double base_triad = 0, base_math = 0;
+    for (std::size_t threads : counts) {
+        sd::thread_pool pool(threads);
+        const double triad = benchmark_ms([&]() { kernel_triad(pool, a, b, out); });
+        const double math = benchmark_ms([&]() { kernel_math(pool, small); });
+        if (threads == 1) {
+            base_triad = triad;
+            base_math = math;
+        }
+        std::cout << std::setw(12) << threads << std::fixed << std::setprecision(2)
+                  << std::setw(12) << triad << std::setw(7) << base_triad / triad << "x"
+                  << std::setw(17) << math << std::setw(7) << base_math / math << "x\n";
+    }
+    std::cout << hline;
+}
@@ -1,14 +1,59 @@
 #include "run.hpp"
+#include <simdee/math.hpp>
 #include <simdee/simdee.hpp>
 
-float gt_recp(float x) { return 1 / x; }
-float gt_rsqrt(float x) { return float(1 / std::sqrt(double(x))); }
-float gt_sqrt(float x) { return std::sqrt(x); }
+double gt_recp(float x) { return 1 / double(x); }
+double gt_rsqrt(float x) { return 1 / std::sqrt(double(x)); }
+double gt_sqrt(float x) { return std::sqrt(double(x)); }
+
+double gt_exp(float x) { return std::exp(double(x)); }
+double gt_log(float x) { return std::log(double(x)); }
+double gt_sin(float x) { return std::sin(double(x)); }
+double gt_cos(float x) { return std::cos(double(x)); }
+double gt_tan(float x) { return std::tan(double(x)); }
+double gt_atan(float x) { return std::atan(double(x)); }
+double gt_atan2(float y, float x) { return std::atan2(double(y), double(x)); }
+double gt_pow(float x, float y) { return std::pow(double(x), double(y)); }
+
+// evaluates a vector function on a broadcast argument, returns the first lane
+template <typename Fn>
+float eval_vec4f(Fn fn, float x) {
+    return first_scalar(fn(sd::vec4f(x)));
+}
+template <typename Fn>
+float eval_vec4f(Fn fn, float x, float y) {
+    return first_scalar(fn(sd::vec4f(x), sd::vec4f(y)));
+}
+
+// runs rcp, rsqrt and sqrt on vec4f with the given precision
+template <typename Precision>
+void run_tier(const run_opts& opts, const char* name, bool recp, bool rsqrt, bool sqrt) {
+    char buf[64];
+    if (recp) {
+        std::snprintf(buf, sizeof(buf), "recp vec4f %s", name);
+        run(opts, buf, false, gt_recp, [](float x) {
+            return eval_vec4f([](sd::vec4f v) { return sd::rcp<Precision>(v); }, x);
+        });
+    }
+    if (rsqrt) {
+        std::snprintf(buf, sizeof(buf), "rsqrt vec4f %s", name);
+        run(opts, buf, true, gt_rsqrt, [](float x) {
+            return eval_vec4f([](sd::vec4f v) { return sd::rsqrt<Precision>(v); }, x);
+        });
+    }
+    if (sqrt) {
+        std::snprintf(buf, sizeof(buf), "sqrt vec4f %s", name);
+        run(opts, buf, true, gt_sqrt, [](float x) {
+            return eval_vec4f([](sd::vec4f v) { return sd::sqrt<Precision>(v); }, x);
+        });
+    }
+}
 
 int main(int argc, char** argv) {
     run_opts opts = {};
     struct {
         bool recp, rsqrt, sqrt;
+        bool exp, log, sin, cos, tan, atan, atan2, pow;
     } algos = {};
     bool abort = argc < 2;
 
@@ -21,10 +66,34 @@ int main(int argc, char** argv) {
             algos.rsqrt = true;
         } else if (0 == std::strcmp(argv[i], "--sqrt")) {
             algos.sqrt = true;
+        } else if (0 == std::strcmp(argv[i], "--exp")) {
+            algos.exp = true;
+        } else if (0 == std::strcmp(argv[i], "--log")) {
+            algos.log = true;
+        } else if (0 == std::strcmp(argv[i], "--sin")) {
+            algos.sin = true;
+        } else if (0 == std::strcmp(argv[i], "--cos")) {
+            algos.cos = true;
+        } else if (0 == std::strcmp(argv[i], "--tan")) {
+            algos.tan = true;
+        } else if (0 == std::strcmp(argv[i], "--atan")) {
+            algos.atan = true;
+        } else if (0 == std::strcmp(argv[i], "--atan2")) {
+            algos.atan2 = true;
+        } else if (0 == std::strcmp(argv[i], "--pow")) {
+            algos.pow = true;
         } else if (0 == std::strcmp(argv[i], "--all")) {
             algos.recp = true;
             algos.rsqrt = true;
             algos.sqrt = true;
+            algos.exp = true;
+            algos.log = true;
+            algos.sin = true;
+            algos.cos = true;
+            algos.tan = true;
+            algos.atan = true;
+            algos.atan2 = true;
+            algos.pow = true;
         } else {
             abort = true;
             break;
@@ -33,13 +102,19 @@ int main(int argc, char** argv) {
 
     if (abort) {
         std::printf(
-            "Usage: simdee-precision [--exhaustive] [--recp] [--rsqrt] [--sqrt]\n"
+            "Usage: simdee-precision [--exhaustive] [--recp] [--rsqrt] [--sqrt] [--exp] [--log]\n"
+            "                        [--sin] [--cos] [--tan] [--atan] [--atan2] [--pow]\n"
             "Options:\n"
             "  --exhaustive\n"
             "    Performs the operation with all possible inputs, as opposed to a number of\n"
-            "    randomly-selected inputs.\n"
+            "    randomly-selected inputs. Binary functions sweep the first argument for each\n"
+            "    of a fixed set of second arguments.\n"
             "  --recp / --rsqrt / --sqrt\n"
-            "    Include certain tests (reciprocal, reciprocal square root, square root).\n"
+            "    Include certain tests (reciprocal, reciprocal square root, square root), both\n"
+            "    the raw instructions and each sd::precision tier on vec4f.\n"
+            "  --exp / --log / --sin / --cos / --tan / --atan / --atan2 / --pow\n"
+            "    Include tests of simdee/math.hpp functions, measured against a double-precision\n"
+            "    reference.\n"
             "  --all\n"
             "    Include all tests.\n");
         return -1;
@@ -118,4 +193,47 @@ int main(int argc, char** argv) {
         });
     }
 #endif
+
+    run_tier<sd::precision::fast>(opts, "fast", algos.recp, algos.rsqrt, algos.sqrt);
+    run_tier<sd::precision::refined>(opts, "refined", algos.recp, algos.rsqrt, algos.sqrt);
+    run_tier<sd::precision::exact>(opts, "exact", algos.recp, algos.rsqrt, algos.sqrt);
+
+#if SIMDEE_NEED_INT
+    if (algos.exp) {
+        run(opts, "exp vec4f", false, gt_exp,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return exp(v); }, x); });
+    }
+    if (algos.log) {
+        run(opts, "log vec4f", true, gt_log,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return log(v); }, x); });
+    }
+    if (algos.sin) {
+        run(opts, "sin vec4f", false, gt_sin,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return sin(v); }, x); });
+    }
+    if (algos.cos) {
+        run(opts, "cos vec4f", false, gt_cos,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return cos(v); }, x); });
+    }
+    if (algos.tan) {
+        run(opts, "tan vec4f", false, gt_tan,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return tan(v); }, x); });
+    }
+    if (algos.atan) {
+        run(opts, "atan vec4f", false, gt_atan,
+            [](float x) { return eval_vec4f([](sd::vec4f v) { return atan(v); }, x); });
+    }
+    if (algos.atan2) {
+        run2(opts, "atan2 vec4f", false, {1.f, -1.f, 1e-30f, 1e30f}, gt_atan2,
+             [](float y, float x) {
+                 return eval_vec4f([](sd::vec4f a, sd::vec4f b) { return atan2(a, b); }, y, x);
+             });
+    }
+    if (algos.pow) {
+        run2(opts, "pow vec4f", true, {-13.7f, -1.f, 0.1f, 0.5f, 2.f, 3.f, 20.25f, 100.3f}, gt_pow,
+             [](float x, float y) {
+                 return eval_vec4f([](sd::vec4f a, sd::vec4f b) { return pow(a, b); }, x, y);
+             });
+    }
+#endif
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "stats_printer.hpp"
 #include <cstring>
+#include <initializer_list>
 #include <random>
 
 const int g_non_exhaustive_retries = 10000000;
@@ -9,23 +10,46 @@ struct run_opts {
     bool exhaustive;
 };
 
-template <typename GtRoutine, typename Routine>
-void run(const run_opts& opts, const char* name, bool positive_only, GtRoutine gt_routine,
-         Routine routine) {
-    stats_printer sp(name);
-    auto process = [gt_routine, routine, &sp](uint32_t ux) {
+template <typename Process>
+void sweep(const run_opts& opts, bool positive_only, Process process) {
+    auto process_bits = [&process](uint32_t ux) {
         float x;
         std::memcpy(&x, &ux, sizeof(float));
         if (std::isnan(x) || std::isinf(x)) { return; }
-        float value = routine(x);
-        float gt = gt_routine(x);
-        sp.update(value, gt);
+        process(x);
     };
     uint32_t mask = positive_only ? 0x7fffffff : 0xffffffff;
     if (opts.exhaustive) {
-        for (uint32_t i = 0; i < mask; i++) { process(i); }
+        for (uint32_t i = 0; i < mask; i++) { process_bits(i); }
     } else {
         std::minstd_rand rand(0x0f15aa32);
-        for (int i = 0; i < g_non_exhaustive_retries; i++) { process(uint32_t(rand()) & mask); }
+        for (int i = 0; i < g_non_exhaustive_retries; i++) {
+            process_bits(uint32_t(rand()) & mask);
+        }
+    }
+}
+
+template <typename GtRoutine, typename Routine>
+void run(const run_opts& opts, const char* name, bool positive_only, GtRoutine gt_routine,
+         Routine routine) {
+    stats_printer sp(name);
+    sweep(opts, positive_only, [gt_routine, routine, &sp](float x) {
+        float value = routine(x);
+        double gt = gt_routine(x);
+        sp.update(value, gt);
+    });
+}
+
+// binary functions sweep the first argument once for each of the listed second arguments
+template <typename GtRoutine, typename Routine>
+void run2(const run_opts& opts, const char* name, bool positive_only,
+          std::initializer_list<float> ys, GtRoutine gt_routine, Routine routine) {
+    stats_printer sp(name);
+    for (float y : ys) {
+        sweep(opts, positive_only, [y, gt_routine, routine, &sp](float x) {
+            float value = routine(x, y);
+            double gt = gt_routine(x, y);
+            sp.update(value, gt);
+        });
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cfloat>
 #include <cinttypes>
 #include <cmath>
 #include <cstdio>
@@ -10,9 +11,22 @@ class stats_printer {
 private:
     std::string m_name;
     double m_max_rel_err = 0.;
+    double m_max_ulp_err = 0.;
     uint64_t m_retry_count = 0;
     uint64_t m_correct_count = 0;
 
+    // distance of value from gt in units in the last place of a float near gt
+    static double ulp_error(double value, double gt) {
+        if (std::isnan(value) || std::isnan(gt)) {
+            return (std::isnan(value) && std::isnan(gt)) ? 0. : HUGE_VAL;
+        }
+        if (value == gt) { return 0.; }
+        if (std::isinf(value)) { return (std::abs(gt) > double(FLT_MAX)) ? 0. : HUGE_VAL; }
+        int exp;
+        ::frexp(gt, &exp);
+        return std::abs(value - gt) / ::ldexp(1., std::max(exp, FLT_MIN_EXP) - FLT_MANT_DIG);
+    }
+
 public:
     stats_printer(const char* name) : m_name(name) {}
 
@@ -23,17 +37,22 @@ public:
         std::printf("%s\n"
                     "  total          %" PRIu64 "\n"
                     "  correct        %" PRIu64 " (%.1f%%)\n"
-                    "  max rel error  %f * 2^%d\n",
+                    "  max rel error  %f * 2^%d\n"
+                    "  max ulp error  %.3f\n",
                     m_name.c_str(), m_retry_count, m_correct_count, correct_percent,
-                    max_rel_err_fract, max_rel_err_exp);
+                    max_rel_err_fract, max_rel_err_exp, m_max_ulp_err);
     }
 
+    // value is a float result, gt may be a more precise reference; a result is correct if it
+    // equals the reference rounded to float
     void update(double value, double gt) {
         m_retry_count++;
-        if (value == gt) { m_correct_count++; }
+        bool both_nan = std::isnan(value) && std::isnan(gt);
+        if (value == double(float(gt)) || both_nan) { m_correct_count++; }
         if ((gt != 0) && (value != 0) && !std::isinf(value)) {
             double rel_err = std::abs((value - gt) / gt);
             m_max_rel_err = std::max(m_max_rel_err, rel_err);
         }
+        m_max_ulp_err = std::max(m_max_ulp_err, ulp_error(value, gt));
     }
 };
@@ -0,0 +1,121 @@
+#include <simdee/algorithm.hpp>
+#include <simdee/simdee.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+using S = sd::native_vec<int32_t>;
+volatile float sink;
+
+// sums the fields of records of stride floats each, one field per cache line, so that each lane
+// reads a different cache line and each line is read once
+template <std::size_t Distance>
+void kernel_strided(const std::vector<float>& data, int stride) {
+    const std::size_t blocks = data.size() / std::size_t(stride) / F::width;
+    F acc = sd::zero();
+    for (int field = 0; field < stride; field += 16) {
+        const float* ptr = data.data() + field;
+        auto src = [=](std::size_t j) {
+            return sd::interleaved(ptr + j * F::width * std::size_t(stride), stride);
+        };
+        sd::prefetched_for<F, Distance>(blocks, src, [&](std::size_t j) { acc = acc + F(src(j)); });
+    }
+    sink = sd::hsum(acc);
+}
+
+// sums table[idx[i]] over a random index array
+template <std::size_t Distance>
+void kernel_gather(const std::vector<float>& table, const std::vector<int32_t>& idx) {
+    const std::size_t blocks = idx.size() / F::width;
+    const float* ptr = table.data();
+    const int32_t* ip = idx.data();
+    auto src = [=](std::size_t j) { return sd::gather(ptr, S(sd::unaligned(ip + j * F::width))); };
+    F acc = sd::zero();
+    sd::prefetched_for<F, Distance>(blocks, src, [&](std::size_t j) { acc = acc + F(src(j)); });
+    sink = sd::hsum(acc);
+}
+
+struct strided {
+    const std::vector<float>& data;
+    int stride;
+
+    template <std::size_t Distance>
+    void apply() const {
+        kernel_strided<Distance>(data, stride);
+    }
+};
+
+struct gather {
+    const std::vector<float>& table;
+    const std::vector<int32_t>& idx;
+
+    template <std::size_t Distance>
+    void apply() const {
+        kernel_gather<Distance>(table, idx);
+    }
+};
+
+template <typename Kernel>
+void sweep(const char*, const Kernel&) {
+    std::cout << "\n";
+}
+template <std::size_t Distance, std::size_t... Rest, typename Kernel>
+void sweep(const char* name, const Kernel& kernel) {
+    if (Distance == 0) std::cout << std::setw(16) << name;
+    const double ms = benchmark_ms([&]() { kernel.template apply<Distance>(); });
+    std::cout << std::fixed << std::setprecision(2) << std::setw(7) << ms;
+    sweep<Rest...>(name, kernel);
+}
+
+template <typename Kernel>
+void run(const char* name, const Kernel& kernel) {
+    sweep<0, 1, 2, 4, 8, 16, 32, 64>(name, kernel);
+}
+
+int main() {
+    const std::size_t floats = std::size_t(32) << 20; // 128 MiB
+    std::vector<float> data(floats);
+    for (std::size_t i = 0; i < floats; ++i) data[i] = float(i % 1000);
+    std::vector<int32_t> idx(std::size_t(4) << 20);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> dist(0, int32_t(floats - 1));
+    for (int32_t& i : idx) i = dist(rng);
+
+    std::cout << hline << "Benchmark: sd::prefetched_for() at various prefetch distances\n";
+    std::cout << hline << F::width << " lanes, 128 MiB of data, distance in blocks, time in ms\n";
+    std::cout << "          kernel      0      1      2      4      8     16     32     64\n";
+    run("stride 64 B", strided{data, 16});
+    run("stride 4 KiB", strided{data, 1024});
+    run("random gather", gather{data, idx});
+    std::cout << hline;
+}
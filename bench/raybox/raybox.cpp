@@ -7,6 +7,7 @@
 #define SIMDEE_NEED_INT 0
 #include <simdee/simd_vectors/avx.hpp>
 #include <simdee/util/allocator.hpp>
+#include <simdee/util/soa_vector.hpp>
 
 #include <chrono>
 #include <functional>
@@ -48,17 +49,14 @@ int main() {
     struct alignas(__m256) RayBoxData8 {
         float minx[8], miny[8], minz[8], maxx[8], maxy[8], maxz[8];
     };
-    struct alignas(__m256) RayBoxData8S {
-        sd::avxf::storage_t minx, miny, minz, maxx, maxy, maxz;
-    };
     const std::size_t dataSize8 = 1024 * 1024;
     const std::size_t dataSize1 = 8 * dataSize8;
     using vec8 = std::vector<RayBoxData8, sd::allocator<RayBoxData8>>;
     using vec1 = std::vector<RayBoxData1>;
-    using vec8S = std::vector<RayBoxData8S, sd::allocator<RayBoxData8S>>;
+    using vec8S = sd::soa_vector<sd::avxf, float, float, float, float, float, float>;
     vec8 data8(dataSize8);
     vec1 data1(dataSize1);
-    const vec8S& data8S = reinterpret_cast<const vec8S&>(data8);
+    vec8S data8S;
     enum class Result : char { fail = 13, win = 42 };
     std::vector<Result> resultsNonSimd(dataSize1);
     std::vector<Result> resultsHandSimd(dataSize1);
@@ -73,6 +71,7 @@ int main() {
     const std::size_t numFloats = (sizeof(RayBoxData1) / sizeof(float)) * dataSize1;
     fill(reinterpret_cast<float*>(data8.data()), numFloats);
 
+    data8S.reserve(dataSize1);
     {
         RayBoxData1* ptr = data1.data();
         for (auto i = 0U; i < dataSize8; ++i) {
@@ -84,6 +83,7 @@ int main() {
                 ptr->maxx = el.maxx[j];
                 ptr->maxy = el.maxy[j];
                 ptr->maxz = el.maxz[j];
+                data8S.push_back(ptr->minx, ptr->miny, ptr->minz, ptr->maxx, ptr->maxy, ptr->maxz);
                 ptr++;
             }
         }
@@ -224,7 +224,17 @@ int main() {
     auto simdee = [&]() {
         auto resIt = resultsSimdee.begin();
 
-        for (const auto& elem : data8S) {
+        struct {
+            sd::avxf minx, miny, minz, maxx, maxy, maxz;
+        } elem;
+
+        for (std::size_t b = 0; b < data8S.blocks(); ++b) {
+            elem.minx = data8S.field<0>(b);
+            elem.miny = data8S.field<1>(b);
+            elem.minz = data8S.field<2>(b);
+            elem.maxx = data8S.field<3>(b);
+            elem.maxy = data8S.field<4>(b);
+            elem.maxz = data8S.field<5>(b);
             auto tmin = ((dirIsNeg[0] ? elem.maxx : elem.minx) - rayOrigin.x) * invDir.x;
             auto tmax = ((dirIsNeg[0] ? elem.minx : elem.maxx) - rayOrigin.x) * invDir.x;
             auto tminy = ((dirIsNeg[1] ? elem.maxy : elem.miny) - rayOrigin.y) * invDir.y;
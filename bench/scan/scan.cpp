@@ -0,0 +1,88 @@
+#include <simdee/algorithm.hpp>
+#include <simdee/simdee.hpp>
+#include <simdee/util/allocator.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using buffer_t = std::vector<float, sd::allocator<float>>;
+
+int main(int argc, char** argv) {
+    // from L1-resident arrays to ones that exceed the last level cache
+    std::vector<std::size_t> sizes_kib = {16, 128, 1024, 8192, 65536, 262144};
+    if (argc > 1) {
+        sizes_kib.clear();
+        for (int i = 1; i < argc; ++i) { sizes_kib.push_back(std::strtoul(argv[i], nullptr, 10)); }
+    }
+
+    std::cout << hline << "Benchmark: Running sum of floats, std vs. sd::scan (Gfloats/s)\n"
+              << hline;
+#if __cplusplus >= 201703L
+    std::cout << "   size (KiB)   partial_sum  inclusive_scan  scan<vec4f>  scan<vec8f>  speedup\n";
+#else
+    std::cout << "   size (KiB)   partial_sum  scan<vec4f>  scan<vec8f>  speedup\n";
+#endif
+
+    for (std::size_t size_kib : sizes_kib) {
+        const std::size_t n = size_kib * 1024 / sizeof(float);
+        buffer_t in(n), out(n);
+        for (std::size_t i = 0; i < n; ++i) { in[i] = float(i % 16); }
+
+        const double partialMs = benchmark_ms([&]() {
+            std::partial_sum(in.begin(), in.end(), out.begin());
+        });
+#if __cplusplus >= 201703L
+        const double inclusiveMs = benchmark_ms([&]() {
+            std::inclusive_scan(in.begin(), in.end(), out.begin());
+        });
+#endif
+        const double scan4Ms = benchmark_ms([&]() {
+            sd::scan<sd::vec4f>(in.data(), out.data(), n, sd::op_add{});
+        });
+        const double scan8Ms = benchmark_ms([&]() {
+            sd::scan<sd::vec8f>(in.data(), out.data(), n, sd::op_add{});
+        });
+
+        // keep the stores observable
+        if (out.back() == 0.f) { std::cout << "Unexpected result!\n"; }
+
+        auto rate = [n](double ms) { return double(n) / (ms * 1.e6); };
+        std::cout << std::fixed << std::setprecision(2) << std::setw(13) << size_kib
+                  << std::setw(14) << rate(partialMs)
+#if __cplusplus >= 201703L
+                  << std::setw(16) << rate(inclusiveMs)
+#endif
+                  << std::setw(13) << rate(scan4Ms) << std::setw(13) << rate(scan8Ms)
+                  << std::setw(8) << partialMs / std::min(scan4Ms, scan8Ms) << "x\n";
+    }
+    std::cout << hline;
+}
@@ -0,0 +1,145 @@
+#include <simdee/simdee.hpp>
+#include <simdee/util/soa_vector.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+const char* const hline =
+    "===============================================================================\n";
+
+auto now = []() { return std::chrono::high_resolution_clock::now(); };
+
+template <typename Duration>
+double to_ms(Duration dur) {
+    using nanoseconds = std::chrono::nanoseconds;
+    return static_cast<double>(std::chrono::duration_cast<nanoseconds>(dur).count()) / 1.e6;
+}
+
+double benchmark_ms(std::function<void()> func) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; i++) {
+        auto tp1 = now();
+        func();
+        auto tp2 = now();
+        double time = to_ms(tp2 - tp1);
+        best = std::min(best, time);
+    }
+    return best;
+}
+
+using F = sd::native_vec<float>;
+const float dt = 0.01f;
+volatile float sink;
+
+struct Particle {
+    float x, y, z, vx, vy, vz;
+};
+
+using aos_t = std::vector<Particle>;
+// sd::allocator<float> only guarantees the alignment of a float, so SoA uses unaligned loads
+using buffer_t = std::vector<float>;
+struct soa_t {
+    buffer_t x, y, z, vx, vy, vz;
+};
+using aosoa_t = sd::soa_vector<F, float, float, float, float, float, float>;
+
+void print(const std::string& name, double aos, double aosInterleaved, double soa, double aosoa) {
+    std::cout << std::setw(12) << name << std::fixed << std::setprecision(3) << std::setw(12)
+              << aos << std::setw(16) << aosInterleaved << std::setw(12) << soa << std::setw(12)
+              << aosoa << "\n";
+}
+
+void run(std::size_t n) {
+    const std::size_t w = F::width;
+    n = (n + w - 1) / w * w;
+    const int step = int(sizeof(Particle) / sizeof(float));
+
+    aos_t aos(n);
+    soa_t soa;
+    for (buffer_t* b : {&soa.x, &soa.y, &soa.z, &soa.vx, &soa.vy, &soa.vz}) b->resize(n);
+    aosoa_t aosoa;
+    aosoa.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float f = float(i % 1000);
+        aos[i] = {f, f + 1.f, f + 2.f, 0.1f, 0.2f, 0.3f};
+        soa.x[i] = f, soa.y[i] = f + 1.f, soa.z[i] = f + 2.f;
+        soa.vx[i] = 0.1f, soa.vy[i] = 0.2f, soa.vz[i] = 0.3f;
+        aosoa.push_back(f, f + 1.f, f + 2.f, 0.1f, 0.2f, 0.3f);
+    }
+
+    // move every particle, which reads all six fields and writes three
+    const double moveAos = benchmark_ms([&]() {
+        for (Particle& p : aos) {
+            p.x += p.vx * dt;
+            p.y += p.vy * dt;
+            p.z += p.vz * dt;
+        }
+    });
+    const double moveInterleaved = benchmark_ms([&]() {
+        for (std::size_t i = 0; i < n; i += w) {
+            float* p = &aos[i].x;
+            for (int c = 0; c < 3; ++c) {
+                F pos = sd::interleaved(p + c, step);
+                const F vel = sd::interleaved(p + c + 3, step);
+                pos = pos + vel * F(dt);
+                sd::interleaved(p + c, step) = pos;
+            }
+        }
+    });
+    const double moveSoa = benchmark_ms([&]() {
+        for (std::size_t i = 0; i < n; i += w) {
+            const F vx = sd::unaligned(&soa.vx[i]);
+            const F vy = sd::unaligned(&soa.vy[i]);
+            const F vz = sd::unaligned(&soa.vz[i]);
+            sd::unaligned(&soa.x[i]) = F(sd::unaligned(&soa.x[i])) + vx * F(dt);
+            sd::unaligned(&soa.y[i]) = F(sd::unaligned(&soa.y[i])) + vy * F(dt);
+            sd::unaligned(&soa.z[i]) = F(sd::unaligned(&soa.z[i])) + vz * F(dt);
+        }
+    });
+    const double moveAosoa = benchmark_ms([&]() {
+        for (std::size_t b = 0; b < aosoa.blocks(); ++b) {
+            aosoa.field<0>(b) = F(aosoa.field<0>(b)) + F(aosoa.field<3>(b)) * F(dt);
+            aosoa.field<1>(b) = F(aosoa.field<1>(b)) + F(aosoa.field<4>(b)) * F(dt);
+            aosoa.field<2>(b) = F(aosoa.field<2>(b)) + F(aosoa.field<5>(b)) * F(dt);
+        }
+    });
+
+    // sum a single field, where the other fields only waste bandwidth in AoS
+    const double sumAos = benchmark_ms([&]() {
+        float sum = 0.f;
+        for (const Particle& p : aos) sum += p.x;
+        sink = sum;
+    });
+    const double sumInterleaved = benchmark_ms([&]() {
+        F sum = sd::zero();
+        for (std::size_t i = 0; i < n; i += w) sum = sum + F(sd::interleaved(&aos[i].x, step));
+        sink = sd::hsum(sum);
+    });
+    const double sumSoa = benchmark_ms([&]() {
+        F sum = sd::zero();
+        for (std::size_t i = 0; i < n; i += w) sum = sum + F(sd::unaligned(&soa.x[i]));
+        sink = sd::hsum(sum);
+    });
+    const double sumAosoa = benchmark_ms([&]() {
+        F sum = sd::zero();
+        for (std::size_t b = 0; b < aosoa.blocks(); ++b) sum = sum + F(aosoa.field<0>(b));
+        sink = sd::hsum(sum);
+    });
+
+    std::cout << hline << n << " particles, " << w << " lanes, time in ms\n";
+    std::cout << "      kernel         AoS  AoS, strided         SoA       AoSoA\n";
+    print("move", moveAos, moveInterleaved, moveSoa, moveAosoa);
+    print("sum x", sumAos, sumInterleaved, sumSoa, sumAosoa);
+}
+
+int main() {
+    std::cout << hline << "Benchmark: AoS vs. SoA vs. AoSoA (sd::soa_vector) traversal\n";
+    run(4 * 1024);
+    run(4 * 1024 * 1024);
+    std::cout << hline;
+}
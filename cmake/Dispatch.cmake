@@ -0,0 +1,42 @@
+# Support for runtime instruction set dispatch, see sd::dispatched in simdee/util/dispatch.hpp
+#
+# simdee_set_source_isa(<isa> <source>...)
+#
+# Compiles the listed sources for the instruction set <isa>, one of "SSE2", "AVX", "AVX2",
+# regardless of SIMDEE_INSTRUCTION_SET. Each of the sources is then expected to provide the
+# implementation of a dispatched function for the corresponding sd::isa tier.
+#
+# The sources also get SIMDEE_ISA_NAMESPACE, e.g. isa_avx2, which puts the library into the inline
+# namespace sd::isa_avx2, so that the inline functions compiled for each tier have their own
+# symbols and the linker never mixes the copies compiled with different flags.
+#
+# With MSVC, the flags only raise the instruction set, so SIMDEE_INSTRUCTION_SET should be left at
+# "default" in order to keep the lower tiers runnable on older CPUs.
+
+function(simdee_set_source_isa ISA)
+  if(MSVC)
+    if(${ISA} STREQUAL "SSE2")
+      set(SIMDEE_ISA_FLAGS "")
+    elseif(${ISA} STREQUAL "AVX")
+      set(SIMDEE_ISA_FLAGS "/arch:AVX")
+    elseif(${ISA} STREQUAL "AVX2")
+      set(SIMDEE_ISA_FLAGS "/arch:AVX2")
+    else()
+      message(FATAL_ERROR "simdee_set_source_isa: unexpected instruction set ${ISA}")
+    endif()
+  else()
+    if(${ISA} STREQUAL "SSE2")
+      set(SIMDEE_ISA_FLAGS "-msse2 -mno-sse3")
+    elseif(${ISA} STREQUAL "AVX")
+      set(SIMDEE_ISA_FLAGS "-mavx -mno-avx2")
+    elseif(${ISA} STREQUAL "AVX2")
+      set(SIMDEE_ISA_FLAGS "-mavx2")
+    else()
+      message(FATAL_ERROR "simdee_set_source_isa: unexpected instruction set ${ISA}")
+    endif()
+  endif()
+  string(TOLOWER ${ISA} SIMDEE_ISA_LOWER)
+  set_property(SOURCE ${ARGN} APPEND_STRING PROPERTY COMPILE_FLAGS " ${SIMDEE_ISA_FLAGS}")
+  set_property(SOURCE ${ARGN} APPEND PROPERTY COMPILE_DEFINITIONS
+               "SIMDEE_ISA_NAMESPACE=isa_${SIMDEE_ISA_LOWER}")
+endfunction()
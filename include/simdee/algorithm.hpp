@@ -0,0 +1,13 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_HPP
+#define SIMDEE_ALGORITHM_HPP
+
+#include "algorithm/accumulate.hpp"
+#include "algorithm/parallel.hpp"
+#include "algorithm/prefetch.hpp"
+#include "algorithm/scan.hpp"
+#include "algorithm/view.hpp"
+
+#endif // SIMDEE_ALGORITHM_HPP
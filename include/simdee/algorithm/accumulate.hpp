@@ -0,0 +1,128 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_ACCUMULATE_HPP
+#define SIMDEE_ALGORITHM_ACCUMULATE_HPP
+
+#include "../simd_vectors/common.hpp"
+#include "../util/inline.hpp"
+#include "../vec.hpp"
+#include "view.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+        // native registers in flight needed to hide the latency of a vector addition: 3 to 4
+        // cycles at 2 per cycle on current x86-64 and AArch64 cores, which have enough registers
+        // to spare; 32-bit x86 and ARM, which have 8 and 16, and the emulated vectors are given
+        // fewer
+#if (SIMDEE_X86 && (defined(__x86_64__) || defined(_M_X64))) || SIMDEE_ARM64
+        constexpr std::size_t native_accumulators = 8;
+#else
+        constexpr std::size_t native_accumulators = 4;
+#endif
+
+        constexpr std::size_t clamp_unroll(std::size_t k) {
+            return k < 1 ? 1 : k > native_accumulators ? native_accumulators : k;
+        }
+
+        // combines acc[Lo], ..., acc[Lo + Len - 1] pairwise, so that the rounding errors of a sum
+        // grow with log(Len)
+        template <std::size_t Lo, std::size_t Len>
+        struct combine_tree {
+            template <typename Simd_t, typename Op_t>
+            static SIMDEE_INL const Simd_t apply(const Simd_t* acc, Op_t f) {
+                return f(combine_tree<Lo, Len / 2>::apply(acc, f),
+                         combine_tree<Lo + Len / 2, Len - Len / 2>::apply(acc, f));
+            }
+        };
+        template <std::size_t Lo>
+        struct combine_tree<Lo, 1> {
+            template <typename Simd_t, typename Op_t>
+            static SIMDEE_INL const Simd_t apply(const Simd_t* acc, Op_t) {
+                return acc[Lo];
+            }
+        };
+    }
+
+    // default number of accumulators of type Simd_t for sd::unrolled_for() and sd::accumulate();
+    // vectors wider than a native register count as several
+    template <typename Simd_t>
+    struct default_unroll
+        : std::integral_constant<
+              std::size_t,
+              impl::clamp_unroll(impl::native_accumulators *
+                                 native_width<typename Simd_t::scalar_t>::value /
+                                 Simd_t::width)> {};
+
+    // calls body(acc[j % K], j) for j from 0 to count - 1, where the K accumulators all start at
+    // init, so that K chains of dependent operations run in parallel; the accumulators are then
+    // combined with f, e.g. for a sum of n floats at ptr:
+    //     auto acc = sd::unrolled_for<4>(n / 8, sd::vec8f(sd::zero()),
+    //         [&](sd::vec8f& a, std::size_t j) { a = a + sd::vec8f(sd::unaligned(ptr + 8 * j)); },
+    //         sd::op_add{});
+    template <std::size_t K, typename Simd_t, typename Body, typename Op_t>
+    const Simd_t unrolled_for(std::size_t count, const Simd_t& init, Body body, Op_t f) {
+        static_assert(K >= 1, "sd::unrolled_for(): expected at least one accumulator");
+        Simd_t acc[K];
+        std::size_t j = 0;
+        auto reset = [&](std::size_t k) { acc[k] = init; };
+        auto step = [&](std::size_t k) { body(acc[k], j + k); };
+        auto tail = [&](std::size_t k) {
+            if (j + k < count) body(acc[k], j + k);
+        };
+
+        impl::static_for<K>::apply(reset);
+        for (; j + K <= count; j += K) impl::static_for<K>::apply(step);
+        impl::static_for<K - 1>::apply(tail);
+        return impl::combine_tree<0, K>::apply(acc, f);
+    }
+
+    namespace impl {
+        // the accumulator of sd::accumulate(), before its lanes are reduced
+        template <std::size_t K, typename Simd_t, typename Expr, typename Op_t>
+        const Simd_t accumulate_lanes(const Expr& e, Op_t f) {
+            using scalar_t = typename Expr::scalar_t;
+            using mask_t = typename Simd_t::mask_t;
+            using bits_t = typename mask_t::bits_t;
+            const std::size_t w = Simd_t::width;
+            const std::size_t n = e.size();
+            const Simd_t identity(Op_t::template identity<scalar_t>());
+
+            Simd_t acc = unrolled_for<K>(
+                n / w, identity,
+                [&](Simd_t& a, std::size_t j) { a = f(a, e.template load<Simd_t>(j * w)); }, f);
+
+            const std::size_t i = n - n % w;
+            if (i < n) {
+                // the lanes past the end are replaced with the identity
+                const Simd_t tail = e.template partial_load<Simd_t>(i, n - i);
+                const mask_t valid(bits_t((uint64_t(1) << (n - i)) - 1));
+                acc = f(acc, cond(from_mask<Simd_t>(valid), tail, identity));
+            }
+            return acc;
+        }
+    }
+
+    // reduces all scalars of an array expression (see sd::view()) with f, which must be one of
+    // the reduction operators, e.g. sd::accumulate(sd::view(a) * sd::view(b), sd::op_add{}) is a
+    // dot product; the scalars are processed with K accumulators of type Simd_t, by default
+    // sd::native_vec and sd::default_unroll, so the order of a floating-point sum differs from
+    // std::accumulate()
+    template <std::size_t K = 0, typename Simd_t = void, typename Expr, typename Op_t>
+    typename Expr::scalar_t accumulate(const array_expr<Expr>& e, Op_t f) {
+        using scalar_t = typename Expr::scalar_t;
+        using vec_t = typename std::conditional<std::is_void<Simd_t>::value,
+                                                native_vec<scalar_t>, Simd_t>::type;
+        constexpr std::size_t unroll = K != 0 ? K : default_unroll<vec_t>::value;
+        return first_scalar(reduce(impl::accumulate_lanes<unroll, vec_t>(e.self(), f), f));
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_ALGORITHM_ACCUMULATE_HPP
@@ -0,0 +1,200 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_PARALLEL_HPP
+#define SIMDEE_ALGORITHM_PARALLEL_HPP
+
+#include "../common/expr.hpp"
+#include "../simd_vectors/common.hpp"
+#include "../util/allocator.hpp"
+#include "../util/inline.hpp"
+#include "../util/thread_pool.hpp"
+#include "../vec.hpp"
+#include "accumulate.hpp"
+#include "view.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+        // the algorithms of sd::par split arrays into chunks of this many bytes of input, which
+        // fit into L1 together with the output and take a few microseconds each, long enough to
+        // hide the cost of taking a chunk from the pool
+        constexpr std::size_t par_chunk_bytes = 16 * 1024;
+
+        template <typename Simd_t, typename T>
+        using vec_or_native =
+            typename std::conditional<std::is_void<Simd_t>::value,
+                                      native_vec<typename std::remove_const<T>::type>,
+                                      Simd_t>::type;
+
+        // scalars per chunk, a multiple of the vector width, so that only the last chunk has a
+        // partial vector, and of the cache line when the data is aligned
+        template <typename Simd_t>
+        constexpr std::size_t par_chunk() {
+            return par_chunk_bytes / sizeof(typename Simd_t::scalar_t) < Simd_t::width
+                       ? Simd_t::width
+                       : par_chunk_bytes / sizeof(typename Simd_t::scalar_t) / Simd_t::width *
+                             Simd_t::width;
+        }
+
+        // calls fn(c, first, count) for each chunk c of the n scalars on the threads of the pool
+        template <typename Simd_t, typename Fn>
+        void for_each_chunk(thread_pool& pool, std::size_t n, Fn fn) {
+            const std::size_t chunk = par_chunk<Simd_t>();
+            pool.parallel_for((n + chunk - 1) / chunk, [&](std::size_t c) {
+                const std::size_t first = c * chunk;
+                fn(c, first, n - first < chunk ? n - first : chunk);
+            });
+        }
+
+        template <typename Simd_t, typename T>
+        SIMDEE_INL void store_block(T* ptr, const Simd_t& v, std::size_t count, std::false_type) {
+            if (count == Simd_t::width) {
+                unaligned(ptr) = v;
+            } else {
+                v.partial_store(ptr, count);
+            }
+        }
+        template <typename Simd_t, typename T>
+        SIMDEE_INL void store_block(const T*, const Simd_t&, std::size_t, std::true_type) {}
+
+        template <typename Simd_t, typename T>
+        SIMDEE_INL const Simd_t load_block(array_view<T> v, std::size_t i, std::size_t count) {
+            return count == Simd_t::width ? v.template load<Simd_t>(i)
+                                          : v.template partial_load<Simd_t>(i, count);
+        }
+
+        // the array expression fn(v), one vector at a time
+        template <typename T, typename Fn>
+        struct array_map : array_expr<array_map<T, Fn>> {
+            using scalar_t = typename std::remove_const<T>::type;
+
+            SIMDEE_INL array_map(array_view<T> rv, Fn& rfn) : v(rv), fn(rfn) {}
+
+            SIMDEE_INL std::size_t size() const { return v.size(); }
+
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t load(std::size_t i) const {
+                return Simd_t(fn(v.template load<Simd_t>(i)));
+            }
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t partial_load(std::size_t i, std::size_t count) const {
+                return Simd_t(fn(v.template partial_load<Simd_t>(i, count)));
+            }
+
+            // data
+            array_view<T> v;
+            Fn& fn;
+        };
+    }
+
+    // parallel versions of the array algorithms, which run on an sd::thread_pool, by default
+    // sd::par::default_pool(); the arrays are split into chunks of 16 KiB that are multiples of
+    // the vector width, and the threads steal chunks from each other, so a loop whose blocks take
+    // uneven time is still balanced
+    namespace par {
+
+        // the pool used when none is given, with one thread per hardware thread
+        inline thread_pool& default_pool() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        // calls body(v, i) for each block v of Simd_t::width scalars at data + i, by default
+        // sd::native_vec; v is a Simd_t& that is stored back to data unless data is const, and in
+        // the last, partial block the lanes past the end repeat data[i] and are not stored; the
+        // blocks run concurrently, so body must not modify shared state without synchronization
+        template <typename Simd_t = void, typename T, typename Body>
+        void for_each_block(T* data, std::size_t n, Body body,
+                            thread_pool& pool = default_pool()) {
+            using vec_t = impl::vec_or_native<Simd_t, T>;
+            const std::size_t w = vec_t::width;
+            impl::for_each_chunk<vec_t>(pool, n, [&](std::size_t, std::size_t first,
+                                                     std::size_t count) {
+                for (std::size_t i = first; i < first + count; i += w) {
+                    const std::size_t valid = first + count - i < w ? first + count - i : w;
+                    vec_t v = impl::load_block<vec_t>(view(data, n), i, valid);
+                    body(v, i);
+                    impl::store_block(data + i, v, valid, std::is_const<T>{});
+                }
+            });
+        }
+
+        // out[i] = fn(in[i]) for each block of Simd_t::width scalars, by default sd::native_vec;
+        // out may be equal to in
+        template <typename Simd_t = void, typename T, typename Fn>
+        void transform(const T* in, std::size_t n, T* out, Fn fn,
+                       thread_pool& pool = default_pool()) {
+            using vec_t = impl::vec_or_native<Simd_t, T>;
+            const std::size_t w = vec_t::width;
+            impl::for_each_chunk<vec_t>(pool, n, [&](std::size_t, std::size_t first,
+                                                     std::size_t count) {
+                for (std::size_t i = first; i < first + count; i += w) {
+                    const std::size_t valid = first + count - i < w ? first + count - i : w;
+                    const vec_t r = fn(impl::load_block<vec_t>(view(in, n), i, valid));
+                    impl::store_block(out + i, r, valid, std::false_type{});
+                }
+            });
+        }
+
+        // out[i] = fn(a[i], b[i]) for each block of Simd_t::width scalars, by default
+        // sd::native_vec; out may be equal to a or b
+        template <typename Simd_t = void, typename T, typename Fn>
+        void transform(const T* a, const T* b, std::size_t n, T* out, Fn fn,
+                       thread_pool& pool = default_pool()) {
+            using vec_t = impl::vec_or_native<Simd_t, T>;
+            const std::size_t w = vec_t::width;
+            impl::for_each_chunk<vec_t>(pool, n, [&](std::size_t, std::size_t first,
+                                                     std::size_t count) {
+                for (std::size_t i = first; i < first + count; i += w) {
+                    const std::size_t valid = first + count - i < w ? first + count - i : w;
+                    const vec_t r = fn(impl::load_block<vec_t>(view(a, n), i, valid),
+                                       impl::load_block<vec_t>(view(b, n), i, valid));
+                    impl::store_block(out + i, r, valid, std::false_type{});
+                }
+            });
+        }
+
+        // reduces fn(in[i]) for each block of Simd_t::width scalars with f, which must be one of
+        // the reduction operators, e.g. the sum of squares is
+        //     sd::par::transform_reduce(in, n, [](sd::vec8f x) { return x * x; }, sd::op_add{});
+        // each chunk is reduced as by sd::accumulate() and the chunks are combined in order, so
+        // the result doesn't depend on the number of threads or on the schedule
+        template <typename Simd_t = void, typename T, typename Fn, typename Op_t>
+        T transform_reduce(const T* in, std::size_t n, Fn fn, Op_t f,
+                           thread_pool& pool = default_pool()) {
+            using vec_t = impl::vec_or_native<Simd_t, T>;
+            const std::size_t chunk = impl::par_chunk<vec_t>();
+            const vec_t identity(Op_t::template identity<T>());
+            std::vector<vec_t, allocator<vec_t>> partial((n + chunk - 1) / chunk);
+
+            impl::for_each_chunk<vec_t>(pool, n, [&](std::size_t c, std::size_t first,
+                                                     std::size_t count) {
+                const impl::array_map<const T, Fn> chunk_expr(view(in + first, count), fn);
+                partial[c] =
+                    impl::accumulate_lanes<default_unroll<vec_t>::value, vec_t>(chunk_expr, f);
+            });
+
+            vec_t acc = identity;
+            for (const vec_t& p : partial) acc = f(acc, p);
+            return first_scalar(reduce(acc, f));
+        }
+
+        // reduces the n scalars at in with f, which must be one of the reduction operators
+        template <typename Simd_t = void, typename T, typename Op_t>
+        T reduce(const T* in, std::size_t n, Op_t f, thread_pool& pool = default_pool()) {
+            using vec_t = impl::vec_or_native<Simd_t, T>;
+            return transform_reduce<vec_t>(in, n, [](const vec_t& x) { return x; }, f, pool);
+        }
+
+    } // namespace par
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_ALGORITHM_PARALLEL_HPP
@@ -0,0 +1,39 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_PREFETCH_HPP
+#define SIMDEE_ALGORITHM_PREFETCH_HPP
+
+#include "../common/expr.hpp"
+#include "../util/inline.hpp"
+#include <cstddef>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    // calls body(j) for j from 0 to count - 1, and before each call prefetches what a load of
+    // Simd_t from src(j + Distance) would read, where src(j) returns the load expression used by
+    // block j, e.g. for a sum of the fields of n records of stride floats each:
+    //     auto src = [&](std::size_t j) { return sd::interleaved(ptr + 8 * j * stride, stride); };
+    //     sd::prefetched_for<sd::vec8f, 16>(n / 8, src,
+    //         [&](std::size_t j) { acc = acc + sd::vec8f(src(j)); });
+    // the hardware prefetchers already follow sequential and small-stride access, the best
+    // Distance for other patterns depends on the latency of the memory and on the work done per
+    // block, and has to be measured; Distance 0 turns prefetching off
+    template <typename Simd_t, std::size_t Distance, locality L = locality::high, typename Src,
+              typename Body>
+    void prefetched_for(std::size_t count, Src src, Body body) {
+        std::size_t j = 0;
+        if (Distance != 0) {
+            for (; j + Distance < count; ++j) {
+                prefetch_load<Simd_t, L>(src(j + Distance));
+                body(j);
+            }
+        }
+        for (; j < count; ++j) body(j);
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_ALGORITHM_PREFETCH_HPP
@@ -0,0 +1,49 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_SCAN_HPP
+#define SIMDEE_ALGORITHM_SCAN_HPP
+
+#include "../common/expr.hpp"
+#include "../simd_vectors/common.hpp"
+#include "../util/inline.hpp"
+#include <cstddef>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    // inclusive scan of the n scalars at in, written to out (which may be equal to in), using
+    // Simd_t vectors, e.g. sd::scan<sd::vec8f>(in, out, n, sd::op_add{}); each block is scanned
+    // in registers and the last lane of the previous block is carried into it, so the loop-carried
+    // dependency is a single f() and a broadcast per block
+    template <typename Simd_t, typename Op_t>
+    void scan(const typename Simd_t::scalar_t* in, typename Simd_t::scalar_t* out, std::size_t n,
+              Op_t f) {
+        const std::size_t w = Simd_t::width;
+        std::size_t i = 0;
+        Simd_t last;
+
+        if (n >= w) {
+            last = inclusive_scan(Simd_t(unaligned(in)), f);
+            unaligned(out) = last;
+            for (i = w; i + w <= n; i += w) {
+                const Simd_t carry = broadcast_lane<Simd_t::width - 1>(last);
+                last = f(carry, inclusive_scan(Simd_t(unaligned(in + i)), f));
+                unaligned(out + i) = last;
+            }
+        }
+
+        if (i < n) {
+            // the missing lanes are filled with in[i], which doesn't affect the stored prefix
+            Simd_t tail;
+            tail.partial_load(in + i, n - i, Simd_t(in[i]));
+            tail = inclusive_scan(tail, f);
+            if (i != 0) { tail = f(broadcast_lane<Simd_t::width - 1>(last), tail); }
+            tail.partial_store(out + i, n - i);
+        }
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_ALGORITHM_SCAN_HPP
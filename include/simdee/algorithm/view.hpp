@@ -0,0 +1,346 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_ALGORITHM_VIEW_HPP
+#define SIMDEE_ALGORITHM_VIEW_HPP
+
+#include "../common/expr.hpp"
+#include "../simd_vectors/common.hpp"
+#include "../util/inline.hpp"
+#include "../vec.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    // array expressions are built from sd::view() and scalars with the usual operators and are
+    // evaluated lazily, one vector at a time, when assigned to a view; a whole expression is a
+    // single pass over memory, e.g. sd::view(out) = sd::view(a) * sd::view(b) + sd::view(c)
+    template <typename Crtp>
+    struct array_expr {
+        SIMDEE_INL const Crtp& self() const { return static_cast<const Crtp&>(*this); }
+    };
+
+    template <typename T>
+    struct is_array_expr : std::is_base_of<array_expr<T>, T> {};
+
+    // evaluates e into dst with Simd_t vectors; only the first min(dst.size(), e.size()) scalars
+    // are written and the tail is handled with a partial load and store
+    template <typename Simd_t, typename Dst, typename Expr>
+    void assign(const Dst& dst, const array_expr<Expr>& e) {
+        static_assert(std::is_same<typename Dst::scalar_t, typename Simd_t::scalar_t>::value,
+                      "sd::assign(): the scalar types of the view and Simd_t differ");
+        const std::size_t w = Simd_t::width;
+        const std::size_t n = std::min(dst.size(), e.self().size());
+        auto out = dst.data();
+        std::size_t i = 0;
+        for (; i + w <= n; i += w) { unaligned(out + i) = e.self().template load<Simd_t>(i); }
+        if (i < n) {
+            const Simd_t tail = e.self().template partial_load<Simd_t>(i, n - i);
+            tail.partial_store(out + i, n - i);
+        }
+    }
+
+    // a range of scalars, the leaves of array expressions; assigning an expression to a view
+    // writes the scalars, the view itself is never rebound
+    template <typename T>
+    struct array_view : array_expr<array_view<T>> {
+        using scalar_t = typename std::remove_const<T>::type;
+
+        SIMDEE_INL constexpr array_view(T* ptr, std::size_t count) : m_ptr(ptr), m_count(count) {}
+        SIMDEE_INL array_view(const array_view&) = default;
+
+        SIMDEE_INL constexpr T* data() const { return m_ptr; }
+        SIMDEE_INL constexpr std::size_t size() const { return m_count; }
+
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t load(std::size_t i) const {
+            return Simd_t(unaligned(m_ptr + i));
+        }
+
+        // the missing lanes repeat the first scalar, so they don't produce denormals or NaNs
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t partial_load(std::size_t i, std::size_t count) const {
+            Simd_t res;
+            res.partial_load(m_ptr + i, count, Simd_t(m_ptr[i]));
+            return res;
+        }
+
+        const array_view& operator=(const array_view& r) const {
+            assign<native_vec<scalar_t>>(*this, r);
+            return *this;
+        }
+        template <typename Expr>
+        const array_view& operator=(const array_expr<Expr>& r) const {
+            assign<native_vec<scalar_t>>(*this, r);
+            return *this;
+        }
+        template <typename Expr>
+        const array_view& operator+=(const Expr& r) const {
+            return *this = *this + r;
+        }
+        template <typename Expr>
+        const array_view& operator-=(const Expr& r) const {
+            return *this = *this - r;
+        }
+        template <typename Expr>
+        const array_view& operator*=(const Expr& r) const {
+            return *this = *this * r;
+        }
+        template <typename Expr>
+        const array_view& operator/=(const Expr& r) const {
+            return *this = *this / r;
+        }
+
+    private:
+        T* m_ptr;
+        std::size_t m_count;
+    };
+
+    template <typename T>
+    SIMDEE_INL constexpr array_view<T> view(T* ptr, std::size_t count) {
+        return array_view<T>(ptr, count);
+    }
+    template <typename T, typename Alloc>
+    SIMDEE_INL array_view<T> view(std::vector<T, Alloc>& v) {
+        return array_view<T>(v.data(), v.size());
+    }
+    template <typename T, typename Alloc>
+    SIMDEE_INL array_view<const T> view(const std::vector<T, Alloc>& v) {
+        return array_view<const T>(v.data(), v.size());
+    }
+
+    namespace impl {
+        // a scalar operand, broadcast to every lane
+        template <typename T>
+        struct array_scalar : array_expr<array_scalar<T>> {
+            using scalar_t = T;
+
+            SIMDEE_INL constexpr explicit array_scalar(T r) : value(r) {}
+
+            SIMDEE_INL constexpr std::size_t size() const {
+                return std::numeric_limits<std::size_t>::max();
+            }
+
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t load(std::size_t) const {
+                return Simd_t(value);
+            }
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t partial_load(std::size_t, std::size_t) const {
+                return Simd_t(value);
+            }
+
+            // data
+            T value;
+        };
+
+        template <typename Op_t, typename A>
+        struct array_unary : array_expr<array_unary<Op_t, A>> {
+            using scalar_t = typename A::scalar_t;
+
+            SIMDEE_INL constexpr explicit array_unary(const A& ra) : a(ra) {}
+
+            SIMDEE_INL constexpr std::size_t size() const { return a.size(); }
+
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t load(std::size_t i) const {
+                return Simd_t(Op_t{}(a.template load<Simd_t>(i)));
+            }
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t partial_load(std::size_t i, std::size_t count) const {
+                return Simd_t(Op_t{}(a.template partial_load<Simd_t>(i, count)));
+            }
+
+            // data
+            A a;
+        };
+
+        template <typename Op_t, typename L, typename R>
+        struct array_binary : array_expr<array_binary<Op_t, L, R>> {
+            using scalar_t = typename L::scalar_t;
+            static_assert(std::is_same<scalar_t, typename R::scalar_t>::value,
+                          "array expression: the operands have different scalar types");
+
+            SIMDEE_INL constexpr array_binary(const L& rl, const R& rr) : l(rl), r(rr) {}
+
+            SIMDEE_INL std::size_t size() const { return std::min(l.size(), r.size()); }
+
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t load(std::size_t i) const {
+                return Simd_t(Op_t{}(l.template load<Simd_t>(i), r.template load<Simd_t>(i)));
+            }
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t partial_load(std::size_t i, std::size_t count) const {
+                return Simd_t(Op_t{}(l.template partial_load<Simd_t>(i, count),
+                                     r.template partial_load<Simd_t>(i, count)));
+            }
+
+            // data
+            L l;
+            R r;
+        };
+
+        template <typename A, typename B, typename C>
+        struct array_fma : array_expr<array_fma<A, B, C>> {
+            using scalar_t = typename A::scalar_t;
+            static_assert(std::is_same<scalar_t, typename B::scalar_t>::value &&
+                              std::is_same<scalar_t, typename C::scalar_t>::value,
+                          "array expression: the operands have different scalar types");
+
+            SIMDEE_INL constexpr array_fma(const A& ra, const B& rb, const C& rc)
+                : a(ra), b(rb), c(rc) {}
+
+            SIMDEE_INL std::size_t size() const { return std::min({a.size(), b.size(), c.size()}); }
+
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t load(std::size_t i) const {
+                return fma(a.template load<Simd_t>(i), b.template load<Simd_t>(i),
+                           c.template load<Simd_t>(i));
+            }
+            template <typename Simd_t>
+            SIMDEE_INL const Simd_t partial_load(std::size_t i, std::size_t count) const {
+                return fma(a.template partial_load<Simd_t>(i, count),
+                           b.template partial_load<Simd_t>(i, count),
+                           c.template partial_load<Simd_t>(i, count));
+            }
+
+            // data
+            A a;
+            B b;
+            C c;
+        };
+
+        struct op_sub {
+            template <typename L, typename R>
+            SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l - r) {
+                return l - r;
+            }
+        };
+        struct op_div {
+            template <typename L, typename R>
+            SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l / r) {
+                return l / r;
+            }
+        };
+        struct op_neg {
+            template <typename A>
+            SIMDEE_INL auto operator()(const A& a) -> decltype(-a) {
+                return -a;
+            }
+        };
+        struct op_abs {
+            template <typename A>
+            SIMDEE_INL auto operator()(const A& a) -> decltype(abs(a)) {
+                return abs(a);
+            }
+        };
+        struct op_sqrt {
+            template <typename A>
+            SIMDEE_INL auto operator()(const A& a) -> decltype(sqrt(a)) {
+                return sqrt(a);
+            }
+        };
+
+        // an operand of an array expression whose scalars are of type T: either an array
+        // expression, or an arithmetic value to be broadcast
+        template <typename X, typename T, bool = is_array_expr<X>::value>
+        struct array_operand {
+            using type = X;
+            static SIMDEE_INL const X& get(const X& x) { return x; }
+        };
+        template <typename X, typename T>
+        struct array_operand<X, T, false> {
+            static_assert(std::is_arithmetic<X>::value,
+                          "array expression: expected an array expression or a scalar");
+            using type = array_scalar<T>;
+            static SIMDEE_INL type get(const X& x) { return type(static_cast<T>(x)); }
+        };
+
+        // the scalar type of the first array expression among Ts, no type if there is none
+        template <typename X>
+        struct array_expr_scalar {
+            using type = typename X::scalar_t;
+        };
+        template <typename... Ts>
+        struct array_scalar_of {};
+        template <typename X, typename... Ts>
+        struct array_scalar_of<X, Ts...>
+            : std::conditional<is_array_expr<X>::value, array_expr_scalar<X>,
+                               array_scalar_of<Ts...>>::type {};
+
+        template <typename X, typename... Ts>
+        using array_operand_t =
+            typename array_operand<X, typename array_scalar_of<Ts...>::type>::type;
+
+        template <typename Op_t, typename L, typename R>
+        using array_binary_t =
+            array_binary<Op_t, array_operand_t<L, L, R>, array_operand_t<R, L, R>>;
+
+        template <typename Op_t, typename L, typename R>
+        SIMDEE_INL const array_binary_t<Op_t, L, R> make_array_binary(const L& l, const R& r) {
+            using scalar_t = typename array_scalar_of<L, R>::type;
+            return array_binary_t<Op_t, L, R>(array_operand<L, scalar_t>::get(l),
+                                              array_operand<R, scalar_t>::get(r));
+        }
+    } // namespace impl
+
+    template <typename L, typename R>
+    SIMDEE_INL auto operator+(const L& l, const R& r)
+        -> decltype(impl::make_array_binary<op_add>(l, r)) {
+        return impl::make_array_binary<op_add>(l, r);
+    }
+    template <typename L, typename R>
+    SIMDEE_INL auto operator-(const L& l, const R& r)
+        -> decltype(impl::make_array_binary<impl::op_sub>(l, r)) {
+        return impl::make_array_binary<impl::op_sub>(l, r);
+    }
+    template <typename L, typename R>
+    SIMDEE_INL auto operator*(const L& l, const R& r)
+        -> decltype(impl::make_array_binary<op_mul>(l, r)) {
+        return impl::make_array_binary<op_mul>(l, r);
+    }
+    template <typename L, typename R>
+    SIMDEE_INL auto operator/(const L& l, const R& r)
+        -> decltype(impl::make_array_binary<impl::op_div>(l, r)) {
+        return impl::make_array_binary<impl::op_div>(l, r);
+    }
+    template <typename L, typename R>
+    SIMDEE_INL auto min(const L& l, const R& r) -> decltype(impl::make_array_binary<op_min>(l, r)) {
+        return impl::make_array_binary<op_min>(l, r);
+    }
+    template <typename L, typename R>
+    SIMDEE_INL auto max(const L& l, const R& r) -> decltype(impl::make_array_binary<op_max>(l, r)) {
+        return impl::make_array_binary<op_max>(l, r);
+    }
+
+    template <typename A>
+    SIMDEE_INL const impl::array_unary<impl::op_neg, A> operator-(const array_expr<A>& a) {
+        return impl::array_unary<impl::op_neg, A>(a.self());
+    }
+    template <typename A>
+    SIMDEE_INL const impl::array_unary<impl::op_abs, A> abs(const array_expr<A>& a) {
+        return impl::array_unary<impl::op_abs, A>(a.self());
+    }
+    template <typename A>
+    SIMDEE_INL const impl::array_unary<impl::op_sqrt, A> sqrt(const array_expr<A>& a) {
+        return impl::array_unary<impl::op_sqrt, A>(a.self());
+    }
+
+    template <typename A, typename B, typename C>
+    SIMDEE_INL auto fma(const A& a, const B& b, const C& c)
+        -> impl::array_fma<impl::array_operand_t<A, A, B, C>, impl::array_operand_t<B, A, B, C>,
+                           impl::array_operand_t<C, A, B, C>> {
+        using scalar_t = typename impl::array_scalar_of<A, B, C>::type;
+        return {impl::array_operand<A, scalar_t>::get(a), impl::array_operand<B, scalar_t>::get(b),
+                impl::array_operand<C, scalar_t>::get(c)};
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_ALGORITHM_VIEW_HPP
@@ -10,6 +10,7 @@
 #include <type_traits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace impl {
 
@@ -107,6 +108,7 @@ namespace sd {
 
     } // namespace dirty
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_COMMON_CASTS_HPP
@@ -8,6 +8,7 @@
 #include <type_traits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace impl {
         template <typename T>
@@ -271,6 +272,7 @@ namespace sd {
 
     } // namespace expr
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_COMMON_DEFERRED_NOT_HPP
@@ -5,9 +5,18 @@
 #define SIMDEE_COMMON_EXPR_HPP
 
 #include "../common/casts.hpp"
+#include "../common/init.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 
+#if SIMDEE_SSE2
+#include <xmmintrin.h>
+#endif
+
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     namespace expr {
         template <typename T>
         struct aligned {
@@ -35,6 +44,19 @@ namespace sd {
             T* ptr;
         };
 
+        template <typename T>
+        struct streaming {
+            SIMDEE_INL constexpr explicit streaming(T* r) : ptr(r) {}
+
+            template <typename Simd_t>
+            SIMDEE_INL void operator=(const Simd_t& r) const {
+                r.streaming_store(ptr);
+            }
+
+            // data
+            T* ptr;
+        };
+
         template <typename T>
         struct interleaved {
             SIMDEE_INL constexpr explicit interleaved(T* r, int rs) : ptr(r), step(rs) {}
@@ -49,6 +71,36 @@ namespace sd {
             int step;
         };
 
+        template <typename T, typename Idx>
+        struct indexed {
+            SIMDEE_INL constexpr explicit indexed(T* r, const Idx& ri) : ptr(r), idx(ri) {}
+
+            template <typename Simd_t>
+            SIMDEE_INL void operator=(const Simd_t& r) const {
+                r.scatter_store(ptr, idx);
+            }
+
+            // data
+            T* ptr;
+            Idx idx;
+        };
+
+        template <typename T, typename Init>
+        struct partial {
+            SIMDEE_INL constexpr explicit partial(T* r, std::size_t rc, const Init& rf)
+                : ptr(r), count(rc), fill(rf) {}
+
+            template <typename Simd_t>
+            SIMDEE_INL void operator=(const Simd_t& r) const {
+                r.partial_store(ptr, count);
+            }
+
+            // data
+            T* ptr;
+            std::size_t count;
+            Init fill;
+        };
+
         template <typename Crtp>
         struct init {
             SIMDEE_INL constexpr const Crtp& self() const {
@@ -75,7 +127,7 @@ namespace sd {
             template <typename Target>
             SIMDEE_INL constexpr Target to() const {
                 using u_t = select_uint_t<sizeof(Target)>;
-                return dirty::cast<u_t, Target>(~u_t(0));
+                return dirty::cast<u_t, Target>(std::numeric_limits<u_t>::max());
             }
         };
 
@@ -83,7 +135,7 @@ namespace sd {
             template <typename Target>
             SIMDEE_INL constexpr Target to() const {
                 using u_t = select_uint_t<sizeof(Target)>;
-                return dirty::cast<u_t, Target>(~(~u_t(0) >> 1));
+                return dirty::cast<u_t, Target>(std::numeric_limits<u_t>::max() / 2 + 1);
             }
         };
 
@@ -91,7 +143,7 @@ namespace sd {
             template <typename Target>
             SIMDEE_INL constexpr Target to() const {
                 using u_t = select_uint_t<sizeof(Target)>;
-                return dirty::cast<u_t, Target>(~u_t(0) >> 1);
+                return dirty::cast<u_t, Target>(std::numeric_limits<u_t>::max() / 2);
             }
         };
 
@@ -129,9 +181,111 @@ namespace sd {
         return expr::unaligned<T>(r);
     }
     template <typename T>
+    SIMDEE_INL constexpr expr::streaming<T> streaming(T* const& r) {
+        return expr::streaming<T>(r);
+    }
+    template <typename T>
     SIMDEE_INL constexpr expr::interleaved<T> interleaved(T* const& r, int rs) {
         return expr::interleaved<T>(r, rs);
     }
+    template <typename T, typename Init>
+    SIMDEE_INL constexpr expr::partial<T, Init> partial(T* const& r, std::size_t rc,
+                                                        const Init& rf) {
+        return expr::partial<T, Init>(r, rc, rf);
+    }
+    template <typename T>
+    SIMDEE_INL constexpr expr::partial<T, expr::zero> partial(T* const& r, std::size_t rc) {
+        return expr::partial<T, expr::zero>(r, rc, expr::zero{});
+    }
+    template <typename T, typename Idx>
+    SIMDEE_INL constexpr expr::indexed<T, Idx> gather(T* const& r, const Idx& ri) {
+        return expr::indexed<T, Idx>(r, ri);
+    }
+    template <typename T, typename Idx, typename Simd_t>
+    SIMDEE_INL void scatter(T* const& r, const Idx& ri, const Simd_t& v) {
+        v.scatter_store(r, ri);
+    }
+
+    // orders preceding streaming stores before any later stores, call it after a streaming pass
+    // and before the data is handed over to another thread
+    SIMDEE_INL void stream_fence() {
+#if SIMDEE_SSE2
+        _mm_sfence();
+#else
+        std::atomic_thread_fence(std::memory_order_release);
+#endif
+    }
+
+    // how long prefetched data is expected to stay in use, from none, which avoids polluting the
+    // outer caches where possible, to high, which fetches the data into all cache levels
+    enum class locality : int { none, low, moderate, high };
+
+    namespace impl {
+        constexpr std::size_t cache_line_bytes = 64;
+
+#if !defined(__GNUC__) && SIMDEE_SSE2
+        constexpr int prefetch_hint(locality l) {
+            return l == locality::none ? _MM_HINT_NTA
+                                       : l == locality::low ? _MM_HINT_T2
+                                                            : l == locality::moderate ? _MM_HINT_T1
+                                                                                      : _MM_HINT_T0;
+        }
+#endif
+    }
+
+    // hints that the cache line holding ptr will be read soon; a prefetch never faults, so ptr
+    // may point past the end of an array, and it does nothing without compiler support
+    template <locality L = locality::high, typename T>
+    SIMDEE_INL void prefetch(const T* ptr) {
+#if defined(__GNUC__)
+        __builtin_prefetch(ptr, 0, int(L));
+#elif SIMDEE_SSE2
+        _mm_prefetch(reinterpret_cast<const char*>(ptr), impl::prefetch_hint(L));
+#else
+        (void)ptr;
+#endif
+    }
+
+    namespace impl {
+        // prefetches each cache line of the given number of bytes at ptr
+        template <locality L>
+        SIMDEE_INL void prefetch_bytes(const void* ptr, std::size_t bytes) {
+            const std::uintptr_t first = std::uintptr_t(ptr) & ~(cache_line_bytes - 1);
+            const std::uintptr_t end = std::uintptr_t(ptr) + bytes;
+            for (std::uintptr_t line = first; line < end; line += cache_line_bytes) {
+                prefetch<L>(reinterpret_cast<const char*>(line));
+            }
+        }
+    }
+
+    // prefetches the scalars that a load of Simd_t from src would read, where src is a load
+    // expression such as sd::unaligned(ptr) or sd::interleaved(ptr, step)
+    template <typename Simd_t, locality L = locality::high, typename T>
+    SIMDEE_INL void prefetch_load(const expr::aligned<T>& src) {
+        impl::prefetch_bytes<L>(src.ptr, sizeof(T) * Simd_t::width);
+    }
+    template <typename Simd_t, locality L = locality::high, typename T>
+    SIMDEE_INL void prefetch_load(const expr::unaligned<T>& src) {
+        impl::prefetch_bytes<L>(src.ptr, sizeof(T) * Simd_t::width);
+    }
+    template <typename Simd_t, locality L = locality::high, typename T>
+    SIMDEE_INL void prefetch_load(const expr::interleaved<T>& src) {
+        const std::size_t step = std::size_t(src.step < 0 ? -src.step : src.step);
+        if (step * sizeof(T) < impl::cache_line_bytes) {
+            // the lanes share cache lines, which are prefetched once each
+            const T* first = src.step < 0 ? src.ptr + src.step * int(Simd_t::width - 1) : src.ptr;
+            impl::prefetch_bytes<L>(first, sizeof(T) * (step * (Simd_t::width - 1) + 1));
+        } else {
+            for (std::size_t i = 0; i < Simd_t::width; ++i) {
+                prefetch<L>(src.ptr + std::ptrdiff_t(i) * src.step);
+            }
+        }
+    }
+    template <typename Simd_t, locality L = locality::high, typename T, typename Idx>
+    SIMDEE_INL void prefetch_load(const expr::indexed<T, Idx>& src) {
+        const typename Idx::storage_t idx(src.idx);
+        for (std::size_t i = 0; i < Simd_t::width; ++i) { prefetch<L>(src.ptr + idx[i]); }
+    }
 
     SIMDEE_INL constexpr expr::zero zero() { return expr::zero{}; }
     SIMDEE_INL constexpr expr::all_bits all_bits() { return expr::all_bits{}; }
@@ -140,6 +294,7 @@ namespace sd {
     SIMDEE_INL constexpr expr::inf inf() { return expr::inf{}; }
     SIMDEE_INL constexpr expr::ninf ninf() { return expr::ninf{}; }
     SIMDEE_INL constexpr expr::nan nan() { return expr::nan{}; }
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_COMMON_EXPR_HPP
@@ -59,6 +59,24 @@
 #endif
 #endif
 
+//
+// fix borked FMA in MSVC, where /arch:AVX2 implies FMA3
+//
+#if defined(_MSC_VER) && defined(__AVX2__)
+#if !defined(__FMA__)
+#define __FMA__
+#endif
+#endif
+
+//
+// enforce instruction sets implied by FMA
+//
+#if defined(__FMA__)
+#if !defined(__AVX__)
+#define __AVX__
+#endif
+#endif
+
 //
 // enforce instruction sets implied by AVX2
 //
@@ -116,6 +134,11 @@
 #else
 #define SIMDEE_SSE41 0
 #endif
+#if defined(__SSE4_2__)
+#define SIMDEE_SSE42 1
+#else
+#define SIMDEE_SSE42 0
+#endif
 #if defined(__AVX__)
 #define SIMDEE_AVX 1
 #else
@@ -126,6 +149,11 @@
 #else
 #define SIMDEE_AVX2 0
 #endif
+#if defined(__FMA__) || (defined(__ARM_NEON) && defined(__ARM_FEATURE_FMA))
+#define SIMDEE_FMA 1
+#else
+#define SIMDEE_FMA 0
+#endif
 #if defined(__ARM_NEON)
 #define SIMDEE_NEON 1
 #else
@@ -136,5 +164,16 @@
 #else
 #define SIMDEE_ARM64 0
 #endif
+#if defined(__GNUC__) // GCC, Clang
+#define SIMDEE_GNU_VECTORS 1
+#else
+#define SIMDEE_GNU_VECTORS 0
+#endif
+#if defined(__i386__) || defined(_M_IX86) || defined(__amd64__) || defined(__x86_64__) ||            \
+    defined(_M_X64) || defined(_M_AMD64)
+#define SIMDEE_X86 1
+#else
+#define SIMDEE_X86 0
+#endif
 
 #endif // SIMDEE_COMMON_INIT_HPP
@@ -9,17 +9,30 @@
 #include <cstdint>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     namespace impl {
-        template <uint32_t AllBitsMask>
+        // masks of up to 32 lanes are stored in a uint32_t, wider ones in a uint64_t
+        template <uint64_t AllBitsMask, bool Wide = (AllBitsMask > 0xffffffffU)>
+        struct mask_bits {
+            using type = uint32_t;
+        };
+        template <uint64_t AllBitsMask>
+        struct mask_bits<AllBitsMask, true> {
+            using type = uint64_t;
+        };
+
+        template <uint64_t AllBitsMask>
         struct mask {
-            enum : uint32_t { all_bits = AllBitsMask };
+            using bits_t = typename mask_bits<AllBitsMask>::type;
+            using iterator = basic_bit_iterator<bits_t>;
+            enum : bits_t { all_bits = AllBitsMask };
 
             SIMDEE_INL mask(const mask&) = default;
             SIMDEE_INL mask& operator=(const mask&) = default;
 
-            SIMDEE_INL constexpr explicit mask(uint32_t i) : value(i) {}
+            SIMDEE_INL constexpr explicit mask(bits_t i) : value(i) {}
 
-            SIMDEE_INL constexpr bool operator[](int i) const { return (value & (1U << i)) != 0; }
+            SIMDEE_INL constexpr bool operator[](int i) const { return ((value >> i) & 1) != 0; }
             SIMDEE_INL constexpr mask operator&(mask r) const { return mask(value & r.value); }
             SIMDEE_INL constexpr mask operator|(mask r) const { return mask(value | r.value); }
             SIMDEE_INL constexpr mask operator^(mask r) const { return mask(value ^ r.value); }
@@ -38,16 +51,29 @@ namespace sd {
             SIMDEE_INL constexpr mask operator~() const { return mask(value ^ all_bits); }
             SIMDEE_INL constexpr bool operator==(mask r) const { return value == r.value; }
             SIMDEE_INL constexpr bool operator!=(mask r) const { return value != r.value; }
-            SIMDEE_INL constexpr bit_iterator begin() const { return bit_iterator(value); }
-            SIMDEE_INL constexpr bit_iterator end() const { return bit_iterator(0); }
+            SIMDEE_INL constexpr iterator begin() const { return iterator(value); }
+            SIMDEE_INL constexpr iterator end() const { return iterator(0); }
 
             SIMDEE_INL friend constexpr bool any(mask l) { return l.value != 0; }
             SIMDEE_INL friend constexpr bool all(mask l) { return l.value == all_bits; }
+            SIMDEE_INL friend constexpr bool none(mask l) { return l.value == 0; }
+
+            // number of set lanes
+            SIMDEE_INL friend int popcount(mask l) { return int(detail::popcount(l.value)); }
+
+            // index of the lowest or the highest set lane, -1 if no lane is set
+            SIMDEE_INL friend int find_first(mask l) {
+                return l.value != 0 ? int(detail::lsb(l.value)) : -1;
+            }
+            SIMDEE_INL friend int find_last(mask l) {
+                return l.value != 0 ? int(detail::msb(l.value)) : -1;
+            }
 
             // data
-            uint32_t value;
+            bits_t value;
         };
     }
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_COMMON_MASK_HPP
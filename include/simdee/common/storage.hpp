@@ -10,6 +10,7 @@
 #include <initializer_list>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     namespace impl {
         template <typename Simd_t, typename Scalar_t, std::size_t Align>
         struct alignas(Align) storage : std::array<Scalar_t, Simd_t::width> {
@@ -39,6 +40,7 @@ namespace sd {
 
     template <typename T>
     using storage = typename T::storage_t;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_COMMON_STORAGE_HPP
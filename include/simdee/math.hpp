@@ -0,0 +1,13 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_HPP
+#define SIMDEE_MATH_HPP
+
+#include "common/init.hpp"
+#include "math/exp.hpp"
+#include "math/log.hpp"
+#include "math/pow.hpp"
+#include "math/trig.hpp"
+
+#endif // SIMDEE_MATH_HPP
@@ -0,0 +1,113 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_COMMON_HPP
+#define SIMDEE_MATH_COMMON_HPP
+
+#include "../common/casts.hpp"
+#include "../common/expr.hpp"
+#include "../common/init.hpp"
+#include "../simd_vectors/common.hpp"
+#include "../simd_vectors/dual.hpp"
+#include "../util/inline.hpp"
+#include <type_traits>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+
+        // the math functions accept single-precision float vectors only
+        template <typename Simd_t>
+        using math_float_t = typename std::enable_if<
+            std::is_same<typename Simd_t::scalar_t, float>::value &&
+                std::is_same<typename Simd_t::vec_f, Simd_t>::value,
+            const Simd_t>::type;
+
+        // reinterpret the bits of a vector as another vector of the same width
+        template <typename To, typename From>
+        struct math_bits {
+            SIMDEE_INL static To cast(const From& r) {
+                return To(dirty::cast<typename From::vector_t, typename To::vector_t>(r.data()));
+            }
+        };
+        template <typename To, typename From>
+        struct math_bits<dual<To>, dual<From>> {
+            SIMDEE_INL static dual<To> cast(const dual<From>& r) {
+                return typename dual<To>::vector_t{math_bits<To, From>::cast(r.data().l),
+                                                         math_bits<To, From>::cast(r.data().r)};
+            }
+        };
+
+        template <typename To, typename From>
+        SIMDEE_INL To bit_cast(const From& r) {
+            return math_bits<To, From>::cast(r);
+        }
+
+        // evaluate c0 + c1*x + c2*x^2 + ... using Horner's scheme
+        template <typename T>
+        SIMDEE_INL T horner(const T&, float c0) {
+            return T(c0);
+        }
+        template <typename T, typename... Coefs>
+        SIMDEE_INL T horner(const T& x, float c0, Coefs... cs) {
+            return fma(horner(x, cs...), x, T(c0));
+        }
+
+        // round to the nearest integer, ties to even, valid for |x| < 2^22
+        template <typename F>
+        SIMDEE_INL F round_small(const F& x) {
+            const F magic(12582912.f); // 1.5 * 2^23
+            return (x + magic) - magic;
+        }
+
+        // the sign bit of a float vector, as a mask
+        template <typename F>
+        SIMDEE_INL typename F::vec_b signbit(const F& x) {
+            using S = typename F::vec_s;
+            return bit_cast<S>(x) < S(0);
+        }
+
+        // magnitude of x with the sign of y
+        template <typename F>
+        SIMDEE_INL F copysign(const F& x, const F& y) {
+            using U = typename F::vec_u;
+            return bit_cast<F>((bit_cast<U>(x) & U(abs_mask())) | (bit_cast<U>(y) & U(sign_bit())));
+        }
+
+        // round to the nearest integer, ties to even, valid for any x
+        template <typename F>
+        SIMDEE_INL F round_any(const F& x) {
+            const F magic(8388608.f); // 2^23, beyond which all floats are integers
+            const F ax = abs(x);
+            const F r = (ax + magic) - magic;
+            return cond(ax < magic, copysign(r, x), x);
+        }
+
+        // x with the sign flipped where y has its sign bit set
+        template <typename F>
+        SIMDEE_INL F mulsign(const F& x, const F& y) {
+            using U = typename F::vec_u;
+            return bit_cast<F>(bit_cast<U>(x) ^ (bit_cast<U>(y) & U(sign_bit())));
+        }
+
+        // 2^n for integral n in [-126, 127]
+        template <typename F>
+        SIMDEE_INL F pow2i(const F& n) {
+            using S = typename F::vec_s;
+            return bit_cast<F>(S((n + F(127.f)) * F(8388608.f)));
+        }
+
+        // x * 2^n for integral n in [-252, 254]
+        template <typename F>
+        SIMDEE_INL F ldexp_small(const F& x, const F& n) {
+            const F n1 = round_small(n * F(0.5f));
+            return x * pow2i(n1) * pow2i(n - n1);
+        }
+
+    } // namespace impl
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_MATH_COMMON_HPP
@@ -0,0 +1,50 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_EXP_HPP
+#define SIMDEE_MATH_EXP_HPP
+
+#include "common.hpp"
+
+#if SIMDEE_NEED_INT
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+
+        // e^r for |r| <= ln(2)/2, Cephes expf polynomial
+        template <typename F>
+        SIMDEE_INL F exp_reduced(const F& r) {
+            const F p = horner(r, 5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f,
+                               8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f);
+            return p * r * r + r + F(1.f);
+        }
+
+    } // namespace impl
+
+    // e^x, max. error 1 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> exp(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        const F x = l.self();
+
+        // clamp so that all intermediate results stay finite; NaNs are restored at the end
+        F xc = cond(x == x, x, F(zero()));
+        xc = min(max(xc, F(-104.f)), F(89.f));
+
+        // x = n * ln(2) + r, with ln(2) split in two parts so that n * ln2_hi is exact
+        const F n = impl::round_small(xc * F(1.44269504088896341f));
+        F r = xc - n * F(0.693359375f);
+        r = r - n * F(-2.12194440e-4f);
+
+        const F y = impl::ldexp_small(impl::exp_reduced(r), n);
+        return cond(x == x, y, x);
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_NEED_INT
+
+#endif // SIMDEE_MATH_EXP_HPP
@@ -0,0 +1,76 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_LOG_HPP
+#define SIMDEE_MATH_LOG_HPP
+
+#include "common.hpp"
+
+#if SIMDEE_NEED_INT
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+
+        // split a positive finite x into x = 2^e * (1 + m), with sqrt(1/2) <= 1 + m < sqrt(2)
+        template <typename F>
+        SIMDEE_INL F log_split(const F& x, F& e) {
+            using U = typename F::vec_u;
+            using S = typename F::vec_s;
+
+            // bring subnormals into the normal range
+            const auto tiny = x < F(1.17549435e-38f);
+            const U bits = bit_cast<U>(cond(tiny, x * F(8388608.f), x));
+
+            e = F(S(bits & U(0x7f800000u))) * F(1.1920928955078125e-7f) - F(126.f);
+            e = cond(tiny, e - F(23.f), e);
+
+            // mantissa in [0.5, 1)
+            const F m = bit_cast<F>((bits & U(0x807fffffu)) | U(0x3f000000u));
+            const auto lo = m < F(0.707106781186547524f);
+            e = cond(lo, e - F(1.f), e);
+            return cond(lo, m + m, m) - F(1.f);
+        }
+
+        // ln(1 + m) - m for sqrt(1/2) <= 1 + m < sqrt(2), Cephes logf polynomial
+        template <typename F>
+        SIMDEE_INL F log1p_reduced(const F& m) {
+            const F z = m * m;
+            const F p = horner(m, 3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f,
+                               -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f,
+                               1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f);
+            return p * m * z - F(0.5f) * z;
+        }
+
+        // apply the special cases of log() for x <= 0, x == inf and NaN
+        template <typename F>
+        SIMDEE_INL F log_special(const F& x, const F& y) {
+            F r = cond(x == F(inf()), x, y);
+            r = cond(x == F(zero()), F(ninf()), r);
+            return cond(x < F(zero()) || x != x, F(nan()), r);
+        }
+
+    } // namespace impl
+
+    // natural logarithm of x, max. error 0.9 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> log(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        const F x = l.self();
+
+        F e;
+        const F m = impl::log_split(x, e);
+        const F y = impl::log1p_reduced(m);
+
+        // ln(x) = e * ln(2) + ln(1 + m), with ln(2) split in two parts
+        const F r = ((y + e * F(-2.12194440e-4f)) + m) + e * F(0.693359375f);
+        return impl::log_special(x, r);
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_NEED_INT
+
+#endif // SIMDEE_MATH_LOG_HPP
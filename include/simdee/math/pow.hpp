@@ -0,0 +1,124 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_POW_HPP
+#define SIMDEE_MATH_POW_HPP
+
+#include "common.hpp"
+#include "exp.hpp"
+#include "log.hpp"
+
+#if SIMDEE_NEED_INT
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+
+        // a * b = p + err, exactly; with FMA the rounding error of the product is computed
+        // directly, otherwise a and b are split into halves of at most 12 significant bits
+        // (Veltkamp) whose products are exact (Dekker), which is only correct if the compiler
+        // doesn't contract them into FMAs, as it can't without FMA instructions
+#if SIMDEE_FMA
+        template <typename F>
+        SIMDEE_INL F two_prod(const F& a, const F& b, F& err) {
+            const F p = a * b;
+            err = fms(a, b, p);
+            return p;
+        }
+#else
+        template <typename F>
+        SIMDEE_INL void split(const F& x, F& hi, F& lo) {
+            const F c = x * F(4097.f);
+            hi = c - (c - x);
+            lo = x - hi;
+        }
+
+        template <typename F>
+        SIMDEE_INL F two_prod(const F& a, const F& b, F& err) {
+            F ah, al, bh, bl;
+            split(a, ah, al);
+            split(b, bh, bl);
+            const F p = a * b;
+            err = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+            return p;
+        }
+#endif
+
+    } // namespace impl
+
+    // x raised to the power of y, max. error 2.9 ulp; special cases follow C99
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> pow(const simd_base<Simd_t>& l,
+                                              const simd_base<Simd_t>& r) {
+        using F = Simd_t;
+        const F x = l.self();
+        const F y = r.self();
+        const F ax = abs(x);
+
+        // log2(|x|) = e + lg_hi + lg_lo, where ln(1 + m) = 2 * atanh(m / (2 + m)) and the
+        // leading term of the series is carried as a float pair
+        F e;
+        const F m = impl::log_split(ax, e);
+        const F d = F(2.f) + m;
+        const F d_lo = (F(2.f) - d) + m;
+        const F s = m / d;
+        F p_lo;
+        const F p = impl::two_prod(s, d, p_lo);
+        const F s_lo = (((m - p) - p_lo) - s * d_lo) / d;
+        const F z = s * s;
+        const F c = impl::horner(z, 3.33333333e-1f, 2.0e-1f, 1.42857143e-1f, 1.11111111e-1f,
+                                 9.09090909e-2f, 7.69230769e-2f) *
+                    z * s;
+        const F t = s + s;
+        const F t_lo = (s_lo + c) + (s_lo + c);
+        F lg_err;
+        const F lg = impl::two_prod(t, F(1.44269502162933349609375f), lg_err);
+        lg_err = lg_err + (t_lo * F(1.44269502162933349609375f) + t * F(1.925963033500011e-8f));
+        const F lg_hi = lg + lg_err;
+        const F lg_lo = (lg - lg_hi) + lg_err;
+
+        // results out of the float range saturate; y is replaced in those lanes so that the
+        // precise path below doesn't overflow
+        const F wa = y * (e + lg_hi);
+        const auto sat = abs(wa) > F(300.f) || wa != wa;
+        const F ys = cond(sat, F(zero()), y);
+
+        // y * log2(|x|) = n + f, with n integral and |f| <= 1/2
+        F a_lo, b_lo;
+        const F a = impl::two_prod(ys, e, a_lo);
+        const F b = impl::two_prod(ys, lg_hi, b_lo);
+        const F na = impl::round_small(a);
+        const F nb = impl::round_small(b);
+        F f = (a - na) + (b - nb);
+        const F nf = impl::round_small(f);
+        F n = (na + nb) + nf;
+        f = (f - nf) + (a_lo + b_lo + ys * lg_lo);
+
+        n = min(max(n, F(-200.f)), F(200.f));
+        F res = impl::ldexp_small(impl::exp_reduced(f * F(0.693147180559945309f)), n);
+        res = cond(sat, cond(wa > F(zero()), F(inf()), F(zero())), res);
+
+        // zero and infinite x
+        res = cond(ax == F(zero()), cond(y < F(zero()), F(inf()), F(zero())), res);
+        res = cond(ax == F(inf()), cond(y < F(zero()), F(zero()), F(inf())), res);
+
+        // negative x: odd integral y flips the sign, non-integral y has no real result
+        const F half = y * F(0.5f);
+        const F yr = impl::round_any(y);
+        const auto y_odd = yr == y && impl::round_any(half) != half;
+        res = cond(impl::signbit(x) && y_odd, -res, res);
+        res = cond(x < F(zero()) && x != F(ninf()) && yr != y, F(nan()), res);
+
+        // NaNs propagate, except for pow(x, 0) == pow(1, y) == pow(-1, +-inf) == 1
+        res = cond(x != x || y != y, x + y, res);
+        return cond(y == F(zero()) || x == F(1.f) || (x == F(-1.f) && abs(y) == F(inf())),
+                    F(1.f), res);
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_NEED_INT
+
+#endif // SIMDEE_MATH_POW_HPP
@@ -0,0 +1,192 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_MATH_TRIG_HPP
+#define SIMDEE_MATH_TRIG_HPP
+
+#include "common.hpp"
+#include <cmath>
+
+#if SIMDEE_NEED_INT
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+
+        // reduce |x| <= 8192 to r in [-pi/4, pi/4], where |x| = j * pi/4 + r and j is even
+        template <typename F>
+        SIMDEE_INL F trig_reduce(const F& ax, typename F::vec_s& j) {
+            using S = typename F::vec_s;
+            j = S(ax * F(1.27323954473516f));
+            j = (j + S(1)) & S(~1);
+            const F y = F(j);
+
+            // pi/4 split in four parts, the first three products are exact
+            F r = ax - y * F(0.78515625f);
+            r = r - y * F(2.41756439208984375e-4f);
+            r = r - y * F(1.5692785382270812988e-7f);
+            return r - y * F(3.0385503141383551905e-11f);
+        }
+
+        // sin(r) for |r| <= pi/4
+        template <typename F>
+        SIMDEE_INL F sin_reduced(const F& r, const F& z) {
+            return horner(z, -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f) * z * r + r;
+        }
+
+        // cos(r) for |r| <= pi/4
+        template <typename F>
+        SIMDEE_INL F cos_reduced(const F& z) {
+            const F p = horner(z, 4.166664568298827e-2f, -1.388731625493765e-3f,
+                               2.443315711809948e-5f);
+            return p * z * z - F(0.5f) * z + F(1.f);
+        }
+
+        // lanes that the fast path can't handle: |x| > 8192, infinities and NaNs
+        template <typename F>
+        SIMDEE_INL typename F::vec_b trig_large(const F& ax) {
+            return ax > F(8192.f) || ax != ax;
+        }
+
+        // recompute the lanes flagged in large with the standard library, which reduces the
+        // argument exactly
+        template <typename F, typename Fn>
+        SIMDEE_INL F trig_fixup(const F& x, const F& y, const typename F::vec_b& large, Fn fn) {
+            if (!any(large)) { return y; }
+            typename F::storage_t xs(x), ys(y);
+            const F lanes = cond(large, F(all_bits()), F(zero()));
+            typename F::storage_t ls(lanes);
+            for (std::size_t i = 0; i < F::width; ++i) {
+                if (dirty::as_u(ls[i]) != 0) { ys[i] = fn(xs[i]); }
+            }
+            return F(ys);
+        }
+
+        // atan(t) for |t| <= tan(pi/8)
+        template <typename F>
+        SIMDEE_INL F atan_reduced(const F& t) {
+            const F z = t * t;
+            return horner(z, -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f,
+                          8.05374449538e-2f) *
+                       z * t +
+                   t;
+        }
+
+    } // namespace impl
+
+    // sine of x, max. error 2.5 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> sin(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        using S = typename F::vec_s;
+        const F x = l.self();
+        F ax = abs(x);
+        const auto large = impl::trig_large(ax);
+        ax = cond(large, F(zero()), ax);
+
+        S j;
+        const F r = impl::trig_reduce(ax, j);
+        const F z = r * r;
+
+        // octants 2 and 6 use the cosine polynomial, octants 4 and 6 flip the sign
+        const F y = cond((j & S(2)) == S(0), impl::sin_reduced(r, z), impl::cos_reduced(z));
+        const F res = cond((j & S(4)) == S(0), y, -y);
+        return impl::trig_fixup(x, impl::mulsign(res, x), large,
+                                [](float v) { return std::sin(v); });
+    }
+
+    // cosine of x, max. error 2.5 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> cos(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        using S = typename F::vec_s;
+        const F x = l.self();
+        F ax = abs(x);
+        const auto large = impl::trig_large(ax);
+        ax = cond(large, F(zero()), ax);
+
+        S j;
+        const F r = impl::trig_reduce(ax, j);
+        const F z = r * r;
+
+        // octants 2 and 6 use the sine polynomial, octants 2 and 4 flip the sign
+        const F y = cond((j & S(2)) == S(0), impl::cos_reduced(z), impl::sin_reduced(r, z));
+        const F res = cond(((j + S(2)) & S(4)) == S(0), y, -y);
+        return impl::trig_fixup(x, res, large, [](float v) { return std::cos(v); });
+    }
+
+    // tangent of x, max. error 4.2 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> tan(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        using S = typename F::vec_s;
+        const F x = l.self();
+        F ax = abs(x);
+        const auto large = impl::trig_large(ax);
+        ax = cond(large, F(zero()), ax);
+
+        S j;
+        const F r = impl::trig_reduce(ax, j);
+        const F z = r * r;
+        const F s = impl::sin_reduced(r, z);
+        const F c = impl::cos_reduced(z);
+
+        // tan(r + pi/2) = -1 / tan(r)
+        const F res = cond((j & S(2)) == S(0), s / c, -c / s);
+        return impl::trig_fixup(x, impl::mulsign(res, x), large,
+                                [](float v) { return std::tan(v); });
+    }
+
+    // arc tangent of x, max. error 2.9 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> atan(const simd_base<Simd_t>& l) {
+        using F = Simd_t;
+        const F x = l.self();
+        const F ax = abs(x);
+
+        // atan(x) = pi/2 + atan(-1/x) = pi/4 + atan((x - 1) / (x + 1))
+        const auto hi = ax > F(2.414213562373095f);
+        const auto mid = ax > F(0.4142135623730950f);
+        F t = cond(mid, (ax - F(1.f)) / (ax + F(1.f)), ax);
+        t = cond(hi, F(-1.f) / ax, t);
+        F y = cond(mid, F(0.785398163397448f), F(zero()));
+        y = cond(hi, F(1.57079632679490f), y);
+
+        return impl::mulsign(y + impl::atan_reduced(t), x);
+    }
+
+    // arc tangent of y / x, using the signs of both arguments to pick the quadrant,
+    // max. error 3.3 ulp
+    template <typename Simd_t>
+    SIMDEE_INL impl::math_float_t<Simd_t> atan2(const simd_base<Simd_t>& l,
+                                                const simd_base<Simd_t>& r) {
+        using F = Simd_t;
+        const F y = l.self();
+        const F x = r.self();
+        const F ax = abs(x);
+        const F ay = abs(y);
+
+        // atan(t) for t = min / max in [0, 1], with 0 / 0 and inf / inf taken as 0 and 1
+        const F hi = max(ax, ay);
+        const F lo = min(ax, ay);
+        F t = lo / hi;
+        t = cond(hi == F(zero()), F(zero()), t);
+        t = cond(lo == F(inf()), F(1.f), t);
+        const auto mid = t > F(0.4142135623730950f);
+        F a = cond(mid, F(0.785398163397448f), F(zero()));
+        a = a + impl::atan_reduced(cond(mid, (t - F(1.f)) / (t + F(1.f)), t));
+
+        // move to the correct octant and quadrant
+        a = cond(ay > ax, F(1.57079632679490f) - a, a);
+        a = cond(impl::signbit(x), F(3.14159265358979f) - a, a);
+        a = impl::copysign(a, y);
+        return cond(x != x || y != y, x + y, a);
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_NEED_INT
+
+#endif // SIMDEE_MATH_TRIG_HPP
@@ -16,13 +16,429 @@
 #include <immintrin.h>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    namespace impl {
+        SIMDEE_INL __m256 avx_set1(float r) { return _mm256_broadcast_ss(&r); }
+        SIMDEE_INL __m256 avx_set1(double r) { return _mm256_castpd_ps(_mm256_broadcast_sd(&r)); }
+        template <typename T>
+        SIMDEE_INL __m256 avx_set1(T r) {
+            return avx_set1(dirty::as_f(r));
+        }
+
+#if SIMDEE_AVX2
+        SIMDEE_INL __m256 avx_set1(bool8_t r) {
+            return _mm256_castsi256_ps(_mm256_set1_epi8(char(uint8_t(r))));
+        }
+        SIMDEE_INL __m256 avx_set1(uint8_t r) {
+            return _mm256_castsi256_ps(_mm256_set1_epi8(char(r)));
+        }
+        SIMDEE_INL __m256 avx_set1(int8_t r) {
+            return _mm256_castsi256_ps(_mm256_set1_epi8(char(r)));
+        }
+        SIMDEE_INL __m256 avx_set1(bool16_t r) {
+            return _mm256_castsi256_ps(_mm256_set1_epi16(int16_t(r)));
+        }
+        SIMDEE_INL __m256 avx_set1(uint16_t r) {
+            return _mm256_castsi256_ps(_mm256_set1_epi16(int16_t(r)));
+        }
+        SIMDEE_INL __m256 avx_set1(int16_t r) { return _mm256_castsi256_ps(_mm256_set1_epi16(r)); }
+
+        SIMDEE_INL __m256i avx_mullo_epi8(__m256i l, __m256i r) {
+            // multiply even and odd bytes separately, in 16-bit lanes
+            __m256i even = _mm256_mullo_epi16(l, r);
+            __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(l, 8), _mm256_srli_epi16(r, 8));
+            return _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                                   _mm256_and_si256(even, _mm256_set1_epi16(0xff)));
+        }
+
+        // rounding average of signed lanes, shifted into the unsigned range and back
+        SIMDEE_INL __m256i avx_avg_epi8(__m256i l, __m256i r) {
+            __m256i low = _mm256_set1_epi8(char(0x80));
+            return _mm256_xor_si256(
+                _mm256_avg_epu8(_mm256_xor_si256(l, low), _mm256_xor_si256(r, low)), low);
+        }
+        SIMDEE_INL __m256i avx_avg_epi16(__m256i l, __m256i r) {
+            __m256i low = _mm256_set1_epi16(int16_t(0x8000));
+            return _mm256_xor_si256(
+                _mm256_avg_epu16(_mm256_xor_si256(l, low), _mm256_xor_si256(r, low)), low);
+        }
+
+        // packing works within 128-bit halves, this puts the 64-bit quarters back in order
+        SIMDEE_INL __m256i avx_fix_pack(__m256i l) {
+            return _mm256_permute4x64_epi64(l, _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        SIMDEE_INL __m256i avx_cmpgt_epu64(__m256i l, __m256i r) {
+            __m256i low = _mm256_set1_epi64x(int64_t(0x8000000000000000ULL));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(l, low), _mm256_xor_si256(r, low));
+        }
+
+        SIMDEE_INL __m256i avx_imul64(__m256i l, __m256i r) {
+            __m256i lolo = _mm256_mul_epu32(l, r);
+            __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(l, _mm256_srli_epi64(r, 32)),
+                                             _mm256_mul_epu32(_mm256_srli_epi64(l, 32), r));
+            return _mm256_add_epi64(lolo, _mm256_slli_epi64(cross, 32));
+        }
+
+        // unsigned integers to floats: both 16-bit halves convert exactly, and the sum is rounded
+        // only once
+        SIMDEE_INL __m256 avx_cvtepu32_ps(__m256i x) {
+            const __m256 hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(x, 16));
+            const __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(x, _mm256_set1_epi32(0xffff)));
+            return _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(65536.f)), lo);
+        }
+
+        // floats in [0, 2^32) to unsigned integers, truncating; values of at least 2^31 are
+        // moved to the signed range first and get their top bit back afterwards
+        SIMDEE_INL __m256i avx_cvttps_epu32(__m256 x) {
+            const __m256 two31 = _mm256_set1_ps(2147483648.f);
+            const __m256 big = _mm256_cmp_ps(x, two31, _CMP_GE_OQ);
+            const __m256i r = _mm256_cvttps_epi32(_mm256_sub_ps(x, _mm256_and_ps(big, two31)));
+            return _mm256_xor_si256(r, _mm256_slli_epi32(_mm256_castps_si256(big), 31));
+        }
+#endif
+
+        // swaps neighbouring groups of Bytes bytes
+        template <std::size_t Bytes>
+        struct avx_swap;
+#if SIMDEE_AVX2
+        template <>
+        struct avx_swap<1> {
+            SIMDEE_INL static __m256 apply(__m256 l) {
+                __m256i i = _mm256_castps_si256(l);
+                return _mm256_castsi256_ps(
+                    _mm256_or_si256(_mm256_slli_epi16(i, 8), _mm256_srli_epi16(i, 8)));
+            }
+        };
+        template <>
+        struct avx_swap<2> {
+            SIMDEE_INL static __m256 apply(__m256 l) {
+                __m256i i = _mm256_castps_si256(l);
+                i = _mm256_shufflelo_epi16(i, _MM_SHUFFLE(2, 3, 0, 1));
+                return _mm256_castsi256_ps(_mm256_shufflehi_epi16(i, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        };
+#endif
+        template <>
+        struct avx_swap<4> {
+            SIMDEE_INL static __m256 apply(__m256 l) {
+                return _mm256_permute_ps(l, _MM_SHUFFLE(2, 3, 0, 1));
+            }
+        };
+        template <>
+        struct avx_swap<8> {
+            SIMDEE_INL static __m256 apply(__m256 l) {
+                return _mm256_permute_ps(l, _MM_SHUFFLE(1, 0, 3, 2));
+            }
+        };
+        template <>
+        struct avx_swap<16> {
+            SIMDEE_INL static __m256 apply(__m256 l) {
+                return _mm256_permute2f128_ps(l, l, _MM_SHUFFLE(0, 0, 0, 1));
+            }
+        };
+
+        template <std::size_t Bytes>
+        struct avx_reduce {
+            template <typename Simd_t, typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, Op_t f) {
+                Simd_t tmp = f(l, Simd_t(avx_swap<Bytes>::apply(l.data())));
+                return avx_reduce<Bytes * 2>::apply(tmp, f);
+            }
+        };
+        template <>
+        struct avx_reduce<32> {
+            template <typename Simd_t, typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, Op_t) {
+                return l;
+            }
+        };
+        // lane permutations, blends and interleaves with the best instruction for the lane width;
+        // the in-lane instructions work on 128-bit halves separately, so patterns that cross
+        // halves need either AVX2 or a copy of each half
+        template <std::size_t Bytes>
+        struct avx_lanes;
+
+        // the same pattern within both halves
+        constexpr bool avx_in_lane(std::size_t a, std::size_t b, std::size_t c, std::size_t d,
+                                   std::size_t e, std::size_t f, std::size_t g, std::size_t h) {
+            return a < 4 && b < 4 && c < 4 && d < 4 && e == a + 4 && f == b + 4 && g == c + 4 &&
+                   h == d + 4;
+        }
+        // every lane taken from its own half
+        constexpr bool avx_in_lane(std::size_t a, std::size_t b, std::size_t c, std::size_t d) {
+            return a < 2 && b < 2 && c >= 2 && d >= 2;
+        }
+
+        template <>
+        struct avx_lanes<4> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...> idx) {
+                return shuffle(l, idx, std::integral_constant<bool, avx_in_lane(I...)>{});
+            }
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...>, std::true_type) {
+                constexpr int imm = int(lane_at(0, I...) | lane_at(1, I...) << 2 |
+                                        lane_at(2, I...) << 4 | lane_at(3, I...) << 6);
+                return _mm256_permute_ps(l, imm);
+            }
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...>, std::false_type) {
+                const __m256i idx = _mm256_setr_epi32(int(I)...);
+#if SIMDEE_AVX2
+                return _mm256_permutevar8x32_ps(l, idx);
+#else
+                // both halves pick from a copy of the low half and from a copy of the high half
+                constexpr int from_hi = int(lane_bits((I >= 4)...));
+                const __m256 lo = _mm256_permute2f128_ps(l, l, 0x00);
+                const __m256 hi = _mm256_permute2f128_ps(l, l, 0x11);
+                return _mm256_blend_ps(_mm256_permutevar_ps(lo, idx), _mm256_permutevar_ps(hi, idx),
+                                       from_hi);
+#endif
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m256 blend(__m256 a, __m256 b, lane_mask<Mask>) {
+                return _mm256_blend_ps(a, b, int(Mask));
+            }
+            SIMDEE_INL static __m256 unpacklo(__m256 a, __m256 b) {
+                return _mm256_unpacklo_ps(a, b);
+            }
+            SIMDEE_INL static __m256 unpackhi(__m256 a, __m256 b) {
+                return _mm256_unpackhi_ps(a, b);
+            }
+        };
+        template <>
+        struct avx_lanes<8> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...> idx) {
+                return shuffle(l, idx, std::integral_constant<bool, avx_in_lane(I...)>{});
+            }
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...>, std::true_type) {
+                constexpr int imm = int((lane_at(0, I...) & 1) | (lane_at(1, I...) & 1) << 1 |
+                                        (lane_at(2, I...) & 1) << 2 | (lane_at(3, I...) & 1) << 3);
+                return _mm256_castpd_ps(_mm256_permute_pd(_mm256_castps_pd(l), imm));
+            }
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...>, std::false_type) {
+                const __m256d d = _mm256_castps_pd(l);
+#if SIMDEE_AVX2
+                constexpr int imm = int(lane_at(0, I...) | lane_at(1, I...) << 2 |
+                                        lane_at(2, I...) << 4 | lane_at(3, I...) << 6);
+                return _mm256_castpd_ps(_mm256_permute4x64_pd(d, imm));
+#else
+                // both halves pick from a copy of the low half and from a copy of the high half
+                constexpr int imm = int((lane_at(0, I...) & 1) | (lane_at(1, I...) & 1) << 1 |
+                                        (lane_at(2, I...) & 1) << 2 | (lane_at(3, I...) & 1) << 3);
+                constexpr int from_hi = int(lane_bits((I >= 2)...));
+                const __m256d lo = _mm256_permute2f128_pd(d, d, 0x00);
+                const __m256d hi = _mm256_permute2f128_pd(d, d, 0x11);
+                return _mm256_castpd_ps(_mm256_blend_pd(_mm256_permute_pd(lo, imm),
+                                                        _mm256_permute_pd(hi, imm), from_hi));
+#endif
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m256 blend(__m256 a, __m256 b, lane_mask<Mask>) {
+                return _mm256_castpd_ps(
+                    _mm256_blend_pd(_mm256_castps_pd(a), _mm256_castps_pd(b), int(Mask)));
+            }
+            SIMDEE_INL static __m256 unpacklo(__m256 a, __m256 b) {
+                return _mm256_castpd_ps(
+                    _mm256_unpacklo_pd(_mm256_castps_pd(a), _mm256_castps_pd(b)));
+            }
+            SIMDEE_INL static __m256 unpackhi(__m256 a, __m256 b) {
+                return _mm256_castpd_ps(
+                    _mm256_unpackhi_pd(_mm256_castps_pd(a), _mm256_castps_pd(b)));
+            }
+        };
+#if SIMDEE_AVX2
+        // constant byte vectors for lanes of Bytes bytes: the pshufb index that moves lane I_j to
+        // lane j within a half, the bytes that come from the other half, and the blend mask
+        template <std::size_t Bytes, typename K = typename make_lanes<32>::type>
+        struct avx_bytes;
+        template <std::size_t Bytes, std::size_t... K>
+        struct avx_bytes<Bytes, lanes<K...>> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m256i index(lanes<I...>) {
+                return _mm256_setr_epi8(
+                    char((lane_at(K / Bytes, I...) * Bytes + K % Bytes) % 16)...);
+            }
+            template <std::size_t... I>
+            static constexpr std::uint64_t crossing(lanes<I...>) {
+                return lane_bits((lane_at(K / Bytes, I...) * Bytes / 16 != K / 16)...);
+            }
+            template <std::size_t... I>
+            SIMDEE_INL static __m256i cross(lanes<I...>) {
+                return _mm256_setr_epi8(
+                    char(lane_at(K / Bytes, I...) * Bytes / 16 != K / 16 ? -1 : 0)...);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m256i mask(lane_mask<Mask>) {
+                return _mm256_setr_epi8(char(((Mask >> (K / Bytes)) & 1) ? -1 : 0)...);
+            }
+        };
+
+        // 8-bit and 16-bit lanes
+        template <std::size_t Bytes>
+        struct avx_narrow_lanes {
+            template <std::size_t... I>
+            SIMDEE_INL static __m256 shuffle(__m256 l, lanes<I...> idx) {
+                const __m256i x = _mm256_castps_si256(l);
+                const __m256i i = avx_bytes<Bytes>::index(idx);
+                const __m256i same = _mm256_shuffle_epi8(x, i);
+                if (avx_bytes<Bytes>::crossing(idx) == 0) { return _mm256_castsi256_ps(same); }
+
+                // the bytes that cross halves are picked from l with its halves swapped
+                const __m256i other = _mm256_shuffle_epi8(_mm256_permute2x128_si256(x, x, 0x01), i);
+                return _mm256_castsi256_ps(
+                    _mm256_blendv_epi8(same, other, avx_bytes<Bytes>::cross(idx)));
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m256 blend(__m256 a, __m256 b, lane_mask<Mask> m) {
+                const __m256i x = _mm256_castps_si256(a);
+                const __m256i y = _mm256_castps_si256(b);
+                if (Bytes == 2 && (Mask & 0xff) == (Mask >> 8)) {
+                    return _mm256_castsi256_ps(_mm256_blend_epi16(x, y, int(Mask & 0xff)));
+                }
+                return _mm256_castsi256_ps(_mm256_blendv_epi8(x, y, avx_bytes<Bytes>::mask(m)));
+            }
+        };
+        template <>
+        struct avx_lanes<1> : avx_narrow_lanes<1> {
+            SIMDEE_INL static __m256 unpacklo(__m256 a, __m256 b) {
+                return _mm256_castsi256_ps(
+                    _mm256_unpacklo_epi8(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+            }
+            SIMDEE_INL static __m256 unpackhi(__m256 a, __m256 b) {
+                return _mm256_castsi256_ps(
+                    _mm256_unpackhi_epi8(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+            }
+        };
+        template <>
+        struct avx_lanes<2> : avx_narrow_lanes<2> {
+            SIMDEE_INL static __m256 unpacklo(__m256 a, __m256 b) {
+                return _mm256_castsi256_ps(
+                    _mm256_unpacklo_epi16(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+            }
+            SIMDEE_INL static __m256 unpackhi(__m256 a, __m256 b) {
+                return _mm256_castsi256_ps(
+                    _mm256_unpackhi_epi16(_mm256_castps_si256(a), _mm256_castps_si256(b)));
+            }
+        };
+#endif
+
+        // unpacks work within 128-bit halves, the halves of the two results are reordered to give
+        // the first and the second half of a0, b0, a1, b1, ...
+        template <std::size_t Bytes>
+        SIMDEE_INL __m256 avx_interleave_lo(__m256 a, __m256 b) {
+            return _mm256_permute2f128_ps(avx_lanes<Bytes>::unpacklo(a, b),
+                                          avx_lanes<Bytes>::unpackhi(a, b), 0x20);
+        }
+        template <std::size_t Bytes>
+        SIMDEE_INL __m256 avx_interleave_hi(__m256 a, __m256 b) {
+            return _mm256_permute2f128_ps(avx_lanes<Bytes>::unpacklo(a, b),
+                                          avx_lanes<Bytes>::unpackhi(a, b), 0x31);
+        }
+
+        SIMDEE_INL __m256i avx_tail_mask(std::size_t bytes) {
+            return _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(tail_mask<>::bytes + (32 - bytes)));
+        }
+
+        template <std::size_t Size>
+        struct avx_gather : std::false_type {};
+#if SIMDEE_AVX2
+        // masked gathers with a zeroed source, the unmasked ones leave the source undefined, which
+        // costs a false dependency and trips uninitialized warnings in GCC
+        template <>
+        struct avx_gather<4> : std::true_type {
+            SIMDEE_INL static __m256 gather(const void* base, __m256i idx) {
+                const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                return _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                                static_cast<const float*>(base), idx, all, 4);
+            }
+            SIMDEE_INL static __m256 load(const void* base, __m256 idx) {
+                return gather(base, _mm256_castps_si256(idx));
+            }
+            SIMDEE_INL static __m256 interleaved_load(const void* base, int step) {
+                const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                return gather(base, _mm256_mullo_epi32(_mm256_set1_epi32(step), iota));
+            }
+        };
+        template <>
+        struct avx_gather<8> : std::true_type {
+            SIMDEE_INL static __m256d all() { return _mm256_castsi256_pd(_mm256_set1_epi32(-1)); }
+            SIMDEE_INL static __m256 load(const void* base, __m256 idx) {
+                return _mm256_castpd_ps(
+                    _mm256_mask_i64gather_pd(_mm256_setzero_pd(), static_cast<const double*>(base),
+                                             _mm256_castps_si256(idx), all(), 8));
+            }
+            SIMDEE_INL static __m256 interleaved_load(const void* base, int step) {
+                const __m128i iota = _mm_setr_epi32(0, 1, 2, 3);
+                const __m128i idx = _mm_mullo_epi32(_mm_set1_epi32(step), iota);
+                return _mm256_castpd_ps(_mm256_mask_i32gather_pd(
+                    _mm256_setzero_pd(), static_cast<const double*>(base), idx, all(), 8));
+            }
+        };
+#endif
+
+        // compress and expand through memory, except for 32-bit and 64-bit lanes with AVX2
+        template <std::size_t Bytes, bool Expand>
+        struct avx_pack {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+                return pack_fallback<Expand>(l, m);
+            }
+        };
+#if SIMDEE_AVX2
+        // vpermd indices for compress and expand, 4 bits per 32-bit slot, where Per slots make up
+        // a lane; bit 3 marks the zeroed slots
+        template <std::size_t Per, bool Expand>
+        constexpr std::uint32_t pack_nibbles(std::uint64_t m, std::size_t k = 0) {
+            return k == 8 ? 0
+                          : (std::uint32_t(pack_zero(Expand, m, k / Per)
+                                               ? 8
+                                               : pack_source(Expand, m, k / Per) * Per + k % Per)
+                             << (4 * k)) |
+                                pack_nibbles<Per, Expand>(m, k + 1);
+        }
+        template <std::size_t Per, bool Expand,
+                  typename M = typename make_lanes<(std::size_t(1) << (8 / Per))>::type>
+        struct avx_permute_pack;
+        template <std::size_t Per, bool Expand, std::size_t... M>
+        struct avx_permute_pack<Per, Expand, lanes<M...>> {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+                static constexpr std::uint32_t rows[] = {pack_nibbles<Per, Expand>(M)...};
+                const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+                const __m256i idx =
+                    _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(rows[m])), shifts);
+                const __m256 res = _mm256_permutevar8x32_ps(l.data(), idx);
+                const __m256 zeroed = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+                return Simd_t(_mm256_blendv_ps(res, _mm256_setzero_ps(), zeroed));
+            }
+        };
+        template <bool Expand>
+        struct avx_pack<4, Expand> : avx_permute_pack<1, Expand> {};
+        template <bool Expand>
+        struct avx_pack<8, Expand> : avx_permute_pack<2, Expand> {};
+#endif
+    } // namespace impl
+
     struct avxb;
     struct avxf;
     struct avxu;
     struct avxs;
+    struct avxb64;
+    struct avxd;
+    struct avxu64;
+    struct avxs64;
     using not_avxb = expr::deferred_lognot<avxb>;
     using not_avxu = expr::deferred_bitnot<avxu>;
     using not_avxs = expr::deferred_bitnot<avxs>;
+    using not_avxb64 = expr::deferred_lognot<avxb64>;
+    using not_avxu64 = expr::deferred_bitnot<avxu64>;
+    using not_avxs64 = expr::deferred_bitnot<avxs64>;
 
     template <>
     struct is_simd_vector<avxb> : std::integral_constant<bool, true> {};
@@ -32,6 +448,20 @@ namespace sd {
     struct is_simd_vector<avxu> : std::integral_constant<bool, true> {};
     template <>
     struct is_simd_vector<avxs> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxb64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxd> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxu64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxs64> : std::integral_constant<bool, true> {};
+
+    namespace impl {
+        // _mm256_rcp_ps and _mm256_rsqrt_ps are accurate to 12 bits
+        template <>
+        struct refine_steps<avxf> : std::integral_constant<int, 1> {};
+    } // namespace impl
 
     template <typename Simd_t, typename Scalar_t>
     struct avx_traits {
@@ -55,24 +485,116 @@ namespace sd {
     template <>
     struct simd_vector_traits<avxs> : avx_traits<avxs, int32_t> {};
 
+    template <typename Simd_t, typename Scalar_t>
+    struct avx64_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m256;
+        using scalar_t = Scalar_t;
+        using vec_b = avxb64;
+        using vec_f = avxd;
+        using vec_u = avxu64;
+        using vec_s = avxs64;
+        using mask_t = impl::mask<0xfU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<avxb64> : avx64_traits<avxb64, bool64_t> {};
+    template <>
+    struct simd_vector_traits<avxd> : avx64_traits<avxd, double> {};
+    template <>
+    struct simd_vector_traits<avxu64> : avx64_traits<avxu64, uint64_t> {};
+    template <>
+    struct simd_vector_traits<avxs64> : avx64_traits<avxs64, int64_t> {};
+
+#if SIMDEE_AVX2
+    struct avxb8;
+    struct avxu8;
+    struct avxs8;
+    struct avxb16;
+    struct avxu16;
+    struct avxs16;
+    using not_avxb8 = expr::deferred_lognot<avxb8>;
+    using not_avxu8 = expr::deferred_bitnot<avxu8>;
+    using not_avxs8 = expr::deferred_bitnot<avxs8>;
+    using not_avxb16 = expr::deferred_lognot<avxb16>;
+    using not_avxu16 = expr::deferred_bitnot<avxu16>;
+    using not_avxs16 = expr::deferred_bitnot<avxs16>;
+
+    template <>
+    struct is_simd_vector<avxb8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxu8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxs8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxb16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxu16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<avxs16> : std::integral_constant<bool, true> {};
+
+    template <typename Simd_t, typename Scalar_t>
+    struct avx8_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m256;
+        using scalar_t = Scalar_t;
+        using vec_b = avxb8;
+        using vec_f = void;
+        using vec_u = avxu8;
+        using vec_s = avxs8;
+        using mask_t = impl::mask<0xffffffffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<avxb8> : avx8_traits<avxb8, bool8_t> {};
+    template <>
+    struct simd_vector_traits<avxu8> : avx8_traits<avxu8, uint8_t> {};
+    template <>
+    struct simd_vector_traits<avxs8> : avx8_traits<avxs8, int8_t> {};
+
+    template <typename Simd_t, typename Scalar_t>
+    struct avx16_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m256;
+        using scalar_t = Scalar_t;
+        using vec_b = avxb16;
+        using vec_f = void;
+        using vec_u = avxu16;
+        using vec_s = avxs16;
+        using mask_t = impl::mask<0xffffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<avxb16> : avx16_traits<avxb16, bool16_t> {};
+    template <>
+    struct simd_vector_traits<avxu16> : avx16_traits<avxu16, uint16_t> {};
+    template <>
+    struct simd_vector_traits<avxs16> : avx16_traits<avxs16, int16_t> {};
+#endif
+
     template <typename Crtp>
     struct avx_base : simd_base<Crtp> {
     protected:
         using simd_base<Crtp>::mm;
         SIMDEE_INL __m256i mmi() const { return _mm256_castps_si256(mm); }
+        SIMDEE_INL __m256d mmd() const { return _mm256_castps_pd(mm); }
 
     public:
         using vector_t = typename simd_base<Crtp>::vector_t;
         using scalar_t = typename simd_base<Crtp>::scalar_t;
         using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
         using simd_base<Crtp>::width;
         using simd_base<Crtp>::self;
 
         SIMDEE_TRIVIAL_TYPE(avx_base)
 
         SIMDEE_BASE_CTOR(avx_base, vector_t, mm = r)
-        SIMDEE_BASE_CTOR(avx_base, scalar_t,
-                         mm = _mm256_broadcast_ss(reinterpret_cast<const float*>(&r)))
+        SIMDEE_BASE_CTOR(avx_base, scalar_t, mm = impl::avx_set1(r))
         SIMDEE_BASE_CTOR_FLAG(avx_base, expr::zero, mm = _mm256_setzero_ps())
         SIMDEE_BASE_CTOR_TPL(avx_base, expr::aligned<T>, aligned_load(r.ptr))
         SIMDEE_BASE_CTOR_TPL(avx_base, expr::unaligned<T>, unaligned_load(r.ptr))
@@ -80,6 +602,26 @@ namespace sd {
         SIMDEE_BASE_CTOR_TPL(avx_base, expr::init<T>, *this = r.template to<scalar_t>())
         SIMDEE_BASE_CTOR(avx_base, storage_t, aligned_load(r.data()))
 
+        template <typename T, typename Init>
+        SIMDEE_INL avx_base(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename T, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename T>
+        SIMDEE_INL avx_base(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename T>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
         SIMDEE_INL void aligned_load(const scalar_t* r) {
             mm = _mm256_load_ps(reinterpret_cast<const float*>(r));
         }
@@ -92,11 +634,12 @@ namespace sd {
         SIMDEE_INL void unaligned_store(scalar_t* r) const {
             _mm256_storeu_ps(reinterpret_cast<float*>(r), mm);
         }
+        SIMDEE_INL void streaming_store(scalar_t* r) const {
+            _mm256_stream_ps(reinterpret_cast<float*>(r), mm);
+        }
 
-        void interleaved_load(const scalar_t* r, int step) {
-            alignas(avx_base) scalar_t temp[width];
-            for (std::size_t i = 0; i < width; ++i, r += step) { temp[i] = *r; }
-            aligned_load(temp);
+        SIMDEE_INL void interleaved_load(const scalar_t* r, int step) {
+            interleaved_load(r, step, has_gather{});
         }
 
         void interleaved_store(scalar_t* r, int step) const {
@@ -105,11 +648,78 @@ namespace sd {
             for (std::size_t i = 0; i < width; ++i, r += step) { *r = temp[i]; }
         }
 
+        // lanes from count onwards are taken from fill, or left untouched when storing
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            partial_load(r, count < width ? count : std::size_t(width), fill, has_maskload{});
+        }
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count) const {
+            partial_store(r, count < width ? count : std::size_t(width), has_maskload{});
+        }
+
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx) {
+            gather_load(base, idx, has_gather{});
+        }
+
+        // there is no scatter instruction in AVX2
+        void scatter_store(scalar_t* base, const vec_s& idx) const {
+            alignas(avx_base) scalar_t temp[width];
+            const typename vec_s::storage_t offsets(idx);
+            aligned_store(temp);
+            for (std::size_t i = 0; i < width; ++i) { base[offsets[i]] = temp[i]; }
+        }
+
         template <typename Op_t>
         friend const Crtp reduce(const Crtp& l, Op_t f) {
-            Crtp tmp = f(l, _mm256_permute_ps(l.mm, _MM_SHUFFLE(2, 3, 0, 1)));
-            tmp = f(tmp, _mm256_permute_ps(tmp.mm, _MM_SHUFFLE(1, 0, 3, 2)));
-            return f(tmp, _mm256_permute2f128_ps(tmp.mm, tmp.mm, _MM_SHUFFLE(0, 0, 0, 1)));
+            return impl::avx_reduce<sizeof(scalar_t)>::apply(l.self(), f);
+        }
+
+        template <typename Op_t>
+        friend const Crtp reduce_rows(const Crtp* rows, Op_t f) {
+            // the first and the second half of the rows are reduced within 128-bit halves, which
+            // needs no lane crossing, and the halves of the two results are combined at the end
+            using lanes_t = impl::avx_lanes<sizeof(scalar_t)>;
+            const std::size_t w = width / 2;
+            Crtp t[width];
+            for (std::size_t j = 0; j < width; ++j) { t[j] = rows[j]; }
+            for (std::size_t n = w; n > 1; n /= 2) {
+                for (std::size_t j = 0; j < n / 2; ++j) {
+                    for (std::size_t g = 0; g < width; g += w) {
+                        const __m256 a = t[g + j].data();
+                        const __m256 b = t[g + j + n / 2].data();
+                        t[g + j] = f(Crtp(lanes_t::unpacklo(a, b)), Crtp(lanes_t::unpackhi(a, b)));
+                    }
+                }
+            }
+            const __m256 x = t[0].data();
+            const __m256 y = t[w].data();
+            return f(Crtp(_mm256_permute2f128_ps(x, y, 0x20)),
+                     Crtp(_mm256_permute2f128_ps(x, y, 0x31)));
+        }
+
+        template <std::size_t... I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I...> idx) {
+            return impl::avx_lanes<sizeof(scalar_t)>::shuffle(l.data(), idx);
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask> m) {
+            return impl::avx_lanes<sizeof(scalar_t)>::blend(a.data(), b.data(), m);
+        }
+
+        // the first and the second half of a0, b0, a1, b1, ...
+        friend SIMDEE_INL const Crtp interleave_lo(const Crtp& a, const Crtp& b) {
+            return impl::avx_interleave_lo<sizeof(scalar_t)>(a.data(), b.data());
+        }
+        friend SIMDEE_INL const Crtp interleave_hi(const Crtp& a, const Crtp& b) {
+            return impl::avx_interleave_hi<sizeof(scalar_t)>(a.data(), b.data());
+        }
+
+        // the lanes selected by m moved to the front, or the front lanes moved to the lanes
+        // selected by m, in order; the other lanes are zero
+        friend SIMDEE_INL const Crtp compress(const Crtp& l, mask_t m) {
+            return impl::avx_pack<sizeof(scalar_t), false>::apply(l, m.value);
+        }
+        friend SIMDEE_INL const Crtp expand(const Crtp& l, mask_t m) {
+            return impl::avx_pack<sizeof(scalar_t), true>::apply(l, m.value);
         }
 
 #if SIMDEE_AVX2
@@ -126,6 +736,51 @@ namespace sd {
             return self();
         }
 #endif
+
+    private:
+        using has_gather = typename impl::avx_gather<sizeof(scalar_t)>::type;
+        using has_maskload = std::integral_constant<bool, (sizeof(scalar_t) >= 4)>;
+
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill,
+                                     std::true_type) {
+            const __m256i mask = impl::avx_tail_mask(count * sizeof(scalar_t));
+            const __m256 loaded = _mm256_maskload_ps(reinterpret_cast<const float*>(r), mask);
+            mm = _mm256_blendv_ps(fill.data(), loaded, _mm256_castsi256_ps(mask));
+        }
+        void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill,
+                          std::false_type) {
+            storage_t temp(fill);
+            for (std::size_t i = 0; i < count; ++i) { temp[i] = r[i]; }
+            aligned_load(temp.data());
+        }
+
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count, std::true_type) const {
+            const __m256i mask = impl::avx_tail_mask(count * sizeof(scalar_t));
+            _mm256_maskstore_ps(reinterpret_cast<float*>(r), mask, mm);
+        }
+        void partial_store(scalar_t* r, std::size_t count, std::false_type) const {
+            const storage_t temp(self());
+            for (std::size_t i = 0; i < count; ++i) { r[i] = temp[i]; }
+        }
+
+        SIMDEE_INL void interleaved_load(const scalar_t* r, int step, std::true_type) {
+            mm = impl::avx_gather<sizeof(scalar_t)>::interleaved_load(r, step);
+        }
+        void interleaved_load(const scalar_t* r, int step, std::false_type) {
+            alignas(avx_base) scalar_t temp[width];
+            for (std::size_t i = 0; i < width; ++i, r += step) { temp[i] = *r; }
+            aligned_load(temp);
+        }
+
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx, std::true_type) {
+            mm = impl::avx_gather<sizeof(scalar_t)>::load(base, idx.data());
+        }
+        void gather_load(const scalar_t* base, const vec_s& idx, std::false_type) {
+            alignas(avx_base) scalar_t temp[width];
+            const typename vec_s::storage_t offsets(idx);
+            for (std::size_t i = 0; i < width; ++i) { temp[i] = base[offsets[i]]; }
+            aligned_load(temp);
+        }
     };
 
     struct avxb : avx_base<avxb> {
@@ -170,6 +825,7 @@ namespace sd {
 
         using avx_base::avx_base;
         SIMDEE_INL explicit avxf(const avxs&);
+        SIMDEE_INL explicit avxf(const avxu&);
         SIMDEE_INL avxf(float v0, float v1, float v2, float v3, float v4, float v5, float v6,
                         float v7) {
             mm = _mm256_setr_ps(v0, v1, v2, v3, v4, v5, v6, v7);
@@ -182,7 +838,7 @@ namespace sd {
         SIMDEE_BINOP(avxf, avxb, operator<=, _mm256_cmp_ps(l.mm, r.mm, _CMP_LE_OQ))
         SIMDEE_BINOP(avxf, avxb, operator>=, _mm256_cmp_ps(l.mm, r.mm, _CMP_GE_OQ))
         SIMDEE_BINOP(avxf, avxb, operator==, _mm256_cmp_ps(l.mm, r.mm, _CMP_EQ_OQ))
-        SIMDEE_BINOP(avxf, avxb, operator!=, _mm256_cmp_ps(l.mm, r.mm, _CMP_NEQ_OQ))
+        SIMDEE_BINOP(avxf, avxb, operator!=, _mm256_cmp_ps(l.mm, r.mm, _CMP_NEQ_UQ))
 
         SIMDEE_UNOP(avxf, avxf, operator-, _mm256_xor_ps(l.mm, avxf(sign_bit()).mm))
         SIMDEE_BINOP(avxf, avxf, operator+, _mm256_add_ps(l.mm, r.mm))
@@ -196,6 +852,23 @@ namespace sd {
         SIMDEE_UNOP(avxf, avxf, rsqrt, _mm256_rsqrt_ps(l.mm))
         SIMDEE_UNOP(avxf, avxf, rcp, _mm256_rcp_ps(l.mm))
         SIMDEE_UNOP(avxf, avxf, abs, _mm256_and_ps(l.mm, avxf(abs_mask()).mm))
+        SIMDEE_UNOP(avxf, avxf, floor,
+                    _mm256_round_ps(l.mm, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxf, avxf, ceil,
+                    _mm256_round_ps(l.mm, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxf, avxf, trunc,
+                    _mm256_round_ps(l.mm, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxf, avxf, round, impl::round_away(l, trunc(l)))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(avxf, avxf, fma, _mm256_fmadd_ps(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(avxf, avxf, fms, _mm256_fmsub_ps(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(avxf, avxf, fnma, _mm256_fnmadd_ps(l.mm, m.mm, r.mm))
+#else
+        SIMDEE_TRIOP(avxf, avxf, fma, _mm256_add_ps(_mm256_mul_ps(l.mm, m.mm), r.mm))
+        SIMDEE_TRIOP(avxf, avxf, fms, _mm256_sub_ps(_mm256_mul_ps(l.mm, m.mm), r.mm))
+        SIMDEE_TRIOP(avxf, avxf, fnma, _mm256_sub_ps(r.mm, _mm256_mul_ps(l.mm, m.mm)))
+#endif
     };
 
     struct avxu : avx_base<avxu> {
@@ -204,6 +877,7 @@ namespace sd {
         using avx_base::avx_base;
         SIMDEE_INL explicit avxu(const avxb&);
         SIMDEE_INL explicit avxu(const avxs&);
+        SIMDEE_INL explicit avxu(const avxf&);
         SIMDEE_INL avxu(uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4,
                         uint32_t v5, uint32_t v6, uint32_t v7) {
             mm = _mm256_castsi256_ps(_mm256_setr_epi32(int32_t(v0), int32_t(v1), int32_t(v2),
@@ -231,6 +905,10 @@ namespace sd {
         SIMDEE_BINOP(avxu, avxu, operator+, _mm256_add_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxu, avxu, operator-, _mm256_sub_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxu, avxu, operator*, _mm256_mullo_epi32(l.mmi(), r.mmi()))
+        SIMDEE_SHIFTOP(avxu, operator<<, _mm256_slli_epi32(l.mmi(), r))
+        SIMDEE_SHIFTOP(avxu, operator>>, _mm256_srli_epi32(l.mmi(), r))
+        SIMDEE_BINOP(avxu, avxu, operator<<, _mm256_sllv_epi32(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu, avxu, operator>>, _mm256_srlv_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxu, avxu, min, _mm256_min_epu32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxu, avxu, max, _mm256_max_epu32(l.mmi(), r.mmi()))
 #endif
@@ -269,6 +947,10 @@ namespace sd {
         SIMDEE_BINOP(avxs, avxs, operator+, _mm256_add_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxs, avxs, operator-, _mm256_sub_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxs, avxs, operator*, _mm256_mullo_epi32(l.mmi(), r.mmi()))
+        SIMDEE_SHIFTOP(avxs, operator<<, _mm256_slli_epi32(l.mmi(), r))
+        SIMDEE_SHIFTOP(avxs, operator>>, _mm256_srai_epi32(l.mmi(), r))
+        SIMDEE_BINOP(avxs, avxs, operator<<, _mm256_sllv_epi32(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs, avxs, operator>>, _mm256_srav_epi32(l.mmi(), r.mmi()))
 
         SIMDEE_BINOP(avxs, avxs, min, _mm256_min_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(avxs, avxs, max, _mm256_max_epi32(l.mmi(), r.mmi()))
@@ -276,6 +958,459 @@ namespace sd {
 #endif
     };
 
+    struct avxb64 : avx_base<avxb64> {
+        SIMDEE_TRIVIAL_TYPE(avxb64)
+        SIMDEE_INL avxb64(bool64_t v0, bool64_t v1, bool64_t v2, bool64_t v3) {
+            mm = _mm256_castsi256_ps(
+                _mm256_set_epi64x(int64_t(v3), int64_t(v2), int64_t(v1), int64_t(v0)));
+        }
+
+        using avx_base::avx_base;
+        SIMDEE_CTOR(avxb64, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxb64, __m256d, mm = _mm256_castpd_ps(r))
+
+#if SIMDEE_AVX2
+        SIMDEE_CTOR(avxb64, not_avxb64,
+                    mm = _mm256_xor_ps(r.neg.mm, _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                                                     _mm256_castps_si256(r.neg.mm),
+                                                     _mm256_castps_si256(r.neg.mm)))))
+#else
+        SIMDEE_CTOR(avxb64, not_avxb64, mm = _mm256_cmp_ps(r.neg.mm, r.neg.mm, _CMP_ORD_Q))
+#endif
+
+        SIMDEE_UNOP(avxb64, mask_t, mask, mask_t(cast_u(_mm256_movemask_pd(l.mmd()))))
+        SIMDEE_UNOP(avxb64, scalar_t, first_scalar,
+                    dirty::as_b(_mm_cvtsd_f64(_mm256_castpd256_pd128(l.mmd()))))
+
+#if SIMDEE_AVX2
+        SIMDEE_BINOP(avxb64, avxb64, operator==, _mm256_cmpeq_epi32(l.mmi(), r.mmi()))
+#else
+        SIMDEE_BINOP(avxb64, not_avxb64, operator==, not_avxb64(_mm256_xor_ps(l.mm, r.mm)))
+#endif
+        SIMDEE_BINOP(avxb64, avxb64, operator!=, _mm256_xor_ps(l.mm, r.mm))
+
+        SIMDEE_BINOP(avxb64, avxb64, operator&&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxb64, avxb64, operator||, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxb64, not_avxb64, operator!, not_avxb64(l))
+    };
+
+    struct avxd : avx_base<avxd> {
+        SIMDEE_TRIVIAL_TYPE(avxd)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxd(const avxs64&);
+        SIMDEE_INL avxd(double v0, double v1, double v2, double v3) {
+            mm = _mm256_castpd_ps(_mm256_setr_pd(v0, v1, v2, v3));
+        }
+        SIMDEE_CTOR(avxd, __m256d, mm = _mm256_castpd_ps(r))
+
+        SIMDEE_UNOP(avxd, scalar_t, first_scalar, _mm_cvtsd_f64(_mm256_castpd256_pd128(l.mmd())))
+
+        SIMDEE_BINOP(avxd, avxb64, operator<, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_LT_OQ))
+        SIMDEE_BINOP(avxd, avxb64, operator>, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_GT_OQ))
+        SIMDEE_BINOP(avxd, avxb64, operator<=, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_LE_OQ))
+        SIMDEE_BINOP(avxd, avxb64, operator>=, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_GE_OQ))
+        SIMDEE_BINOP(avxd, avxb64, operator==, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_EQ_OQ))
+        SIMDEE_BINOP(avxd, avxb64, operator!=, _mm256_cmp_pd(l.mmd(), r.mmd(), _CMP_NEQ_UQ))
+
+        SIMDEE_UNOP(avxd, avxd, operator-, _mm256_xor_ps(l.mm, avxd(sign_bit()).mm))
+        SIMDEE_BINOP(avxd, avxd, operator+, _mm256_add_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(avxd, avxd, operator-, _mm256_sub_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(avxd, avxd, operator*, _mm256_mul_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(avxd, avxd, operator/, _mm256_div_pd(l.mmd(), r.mmd()))
+
+        SIMDEE_BINOP(avxd, avxd, min, _mm256_min_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(avxd, avxd, max, _mm256_max_pd(l.mmd(), r.mmd()))
+        SIMDEE_UNOP(avxd, avxd, sqrt, _mm256_sqrt_pd(l.mmd()))
+        SIMDEE_UNOP(avxd, avxd, rsqrt, _mm256_div_pd(_mm256_set1_pd(1.), _mm256_sqrt_pd(l.mmd())))
+        SIMDEE_UNOP(avxd, avxd, rcp, _mm256_div_pd(_mm256_set1_pd(1.), l.mmd()))
+        SIMDEE_UNOP(avxd, avxd, abs, _mm256_and_ps(l.mm, avxd(abs_mask()).mm))
+        SIMDEE_UNOP(avxd, avxd, floor,
+                    _mm256_round_pd(l.mmd(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxd, avxd, ceil,
+                    _mm256_round_pd(l.mmd(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxd, avxd, trunc,
+                    _mm256_round_pd(l.mmd(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(avxd, avxd, round, impl::round_away(l, trunc(l)))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(avxd, avxd, fma, _mm256_fmadd_pd(l.mmd(), m.mmd(), r.mmd()))
+        SIMDEE_TRIOP(avxd, avxd, fms, _mm256_fmsub_pd(l.mmd(), m.mmd(), r.mmd()))
+        SIMDEE_TRIOP(avxd, avxd, fnma, _mm256_fnmadd_pd(l.mmd(), m.mmd(), r.mmd()))
+#else
+        SIMDEE_TRIOP(avxd, avxd, fma, _mm256_add_pd(_mm256_mul_pd(l.mmd(), m.mmd()), r.mmd()))
+        SIMDEE_TRIOP(avxd, avxd, fms, _mm256_sub_pd(_mm256_mul_pd(l.mmd(), m.mmd()), r.mmd()))
+        SIMDEE_TRIOP(avxd, avxd, fnma, _mm256_sub_pd(r.mmd(), _mm256_mul_pd(l.mmd(), m.mmd())))
+#endif
+    };
+
+    struct avxu64 : avx_base<avxu64> {
+        SIMDEE_TRIVIAL_TYPE(avxu64)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxu64(const avxb64&);
+        SIMDEE_INL explicit avxu64(const avxs64&);
+        SIMDEE_INL avxu64(uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3) {
+            mm = _mm256_castsi256_ps(
+                _mm256_set_epi64x(int64_t(v3), int64_t(v2), int64_t(v1), int64_t(v0)));
+        }
+        SIMDEE_CTOR(avxu64, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxu64, not_avxu64, mm = _mm256_xor_ps(r.neg.mm, avxu64(all_bits()).mm))
+
+        SIMDEE_UNOP(avxu64, scalar_t, first_scalar,
+                    dirty::as_u(_mm_cvtsd_f64(_mm256_castpd256_pd128(l.mmd()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxu64, avxb64, operator<, impl::avx_cmpgt_epu64(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(avxu64, avxb64, operator>, impl::avx_cmpgt_epu64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu64, not_avxb64, operator<=,
+                     not_avxb64(impl::avx_cmpgt_epu64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxu64, not_avxb64, operator>=,
+                     not_avxb64(impl::avx_cmpgt_epu64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxu64, avxb64, operator==, _mm256_cmpeq_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu64, not_avxb64, operator!=,
+                     not_avxb64(_mm256_cmpeq_epi64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxu64, avxu64, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu64, avxu64, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu64, avxu64, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxu64, not_avxu64, operator~, not_avxu64(l))
+        SIMDEE_UNOP(avxu64, avxu64, operator-, _mm256_sub_epi64(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxu64, avxu64, operator+, _mm256_add_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu64, avxu64, operator-, _mm256_sub_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu64, avxu64, operator*, impl::avx_imul64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu64, avxu64, min,
+                     _mm256_blendv_epi8(r.mmi(), l.mmi(), impl::avx_cmpgt_epu64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxu64, avxu64, max,
+                     _mm256_blendv_epi8(r.mmi(), l.mmi(), impl::avx_cmpgt_epu64(l.mmi(), r.mmi())))
+#endif
+    };
+
+    struct avxs64 : avx_base<avxs64> {
+        SIMDEE_TRIVIAL_TYPE(avxs64)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxs64(const avxd&);
+        SIMDEE_INL explicit avxs64(const avxu64&);
+        SIMDEE_INL avxs64(int64_t v0, int64_t v1, int64_t v2, int64_t v3) {
+            mm = _mm256_castsi256_ps(_mm256_set_epi64x(v3, v2, v1, v0));
+        }
+        SIMDEE_CTOR(avxs64, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxs64, not_avxs64, mm = _mm256_xor_ps(r.neg.mm, avxs64(all_bits()).mm))
+
+        SIMDEE_UNOP(avxs64, scalar_t, first_scalar,
+                    dirty::as_s(_mm_cvtsd_f64(_mm256_castpd256_pd128(l.mmd()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxs64, avxb64, operator<, _mm256_cmpgt_epi64(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(avxs64, avxb64, operator>, _mm256_cmpgt_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs64, not_avxb64, operator<=,
+                     not_avxb64(_mm256_cmpgt_epi64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxs64, not_avxb64, operator>=,
+                     not_avxb64(_mm256_cmpgt_epi64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxs64, avxb64, operator==, _mm256_cmpeq_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs64, not_avxb64, operator!=,
+                     not_avxb64(_mm256_cmpeq_epi64(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(avxs64, avxs64, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs64, avxs64, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs64, avxs64, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxs64, not_avxs64, operator~, not_avxs64(l))
+
+        SIMDEE_UNOP(avxs64, avxs64, operator-, _mm256_sub_epi64(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxs64, avxs64, operator+, _mm256_add_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs64, avxs64, operator-, _mm256_sub_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs64, avxs64, operator*, impl::avx_imul64(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(avxs64, avxs64, min,
+                     _mm256_blendv_epi8(r.mmi(), l.mmi(), _mm256_cmpgt_epi64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxs64, avxs64, max,
+                     _mm256_blendv_epi8(r.mmi(), l.mmi(), _mm256_cmpgt_epi64(l.mmi(), r.mmi())))
+        SIMDEE_INL friend const avxs64 abs(const avxs64& l) {
+            __m256i neg = _mm256_cmpgt_epi64(_mm256_setzero_si256(), l.mmi());
+            return _mm256_sub_epi64(_mm256_xor_si256(l.mmi(), neg), neg);
+        }
+#endif
+    };
+
+#if SIMDEE_AVX2
+    struct avxb8 : avx_base<avxb8> {
+        SIMDEE_TRIVIAL_TYPE(avxb8)
+
+        using avx_base::avx_base;
+        SIMDEE_INL avxb8(bool8_t v0, bool8_t v1, bool8_t v2, bool8_t v3, bool8_t v4, bool8_t v5,
+                         bool8_t v6, bool8_t v7, bool8_t v8, bool8_t v9, bool8_t v10, bool8_t v11,
+                         bool8_t v12, bool8_t v13, bool8_t v14, bool8_t v15, bool8_t v16,
+                         bool8_t v17, bool8_t v18, bool8_t v19, bool8_t v20, bool8_t v21,
+                         bool8_t v22, bool8_t v23, bool8_t v24, bool8_t v25, bool8_t v26,
+                         bool8_t v27, bool8_t v28, bool8_t v29, bool8_t v30, bool8_t v31) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi8(char(uint8_t(v0)), char(uint8_t(v1)),
+                                                      char(uint8_t(v2)), char(uint8_t(v3)),
+                                                      char(uint8_t(v4)), char(uint8_t(v5)),
+                                                      char(uint8_t(v6)), char(uint8_t(v7)),
+                                                      char(uint8_t(v8)), char(uint8_t(v9)),
+                                                      char(uint8_t(v10)), char(uint8_t(v11)),
+                                                      char(uint8_t(v12)), char(uint8_t(v13)),
+                                                      char(uint8_t(v14)), char(uint8_t(v15)),
+                                                      char(uint8_t(v16)), char(uint8_t(v17)),
+                                                      char(uint8_t(v18)), char(uint8_t(v19)),
+                                                      char(uint8_t(v20)), char(uint8_t(v21)),
+                                                      char(uint8_t(v22)), char(uint8_t(v23)),
+                                                      char(uint8_t(v24)), char(uint8_t(v25)),
+                                                      char(uint8_t(v26)), char(uint8_t(v27)),
+                                                      char(uint8_t(v28)), char(uint8_t(v29)),
+                                                      char(uint8_t(v30)), char(uint8_t(v31))));
+        }
+        SIMDEE_CTOR(avxb8, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxb8, not_avxb8, mm = _mm256_xor_ps(r.neg.mm, avxb8(all_bits()).mm))
+
+        SIMDEE_UNOP(avxb8, mask_t, mask, mask_t(cast_u(_mm256_movemask_epi8(l.mmi()))))
+        SIMDEE_UNOP(avxb8, scalar_t, first_scalar,
+                    scalar_t(uint8_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi())))))
+
+        SIMDEE_BINOP(avxb8, avxb8, operator==, _mm256_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxb8, avxb8, operator!=, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxb8, avxb8, operator&&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxb8, avxb8, operator||, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxb8, not_avxb8, operator!, not_avxb8(l))
+    };
+
+    struct avxu8 : avx_base<avxu8> {
+        SIMDEE_TRIVIAL_TYPE(avxu8)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxu8(const avxb8&);
+        SIMDEE_INL explicit avxu8(const avxs8&);
+        SIMDEE_INL avxu8(uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5,
+                         uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11,
+                         uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16,
+                         uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21,
+                         uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26,
+                         uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi8(char(v0), char(v1), char(v2), char(v3),
+                                                      char(v4), char(v5), char(v6), char(v7),
+                                                      char(v8), char(v9), char(v10), char(v11),
+                                                      char(v12), char(v13), char(v14), char(v15),
+                                                      char(v16), char(v17), char(v18), char(v19),
+                                                      char(v20), char(v21), char(v22), char(v23),
+                                                      char(v24), char(v25), char(v26), char(v27),
+                                                      char(v28), char(v29), char(v30), char(v31)));
+        }
+        SIMDEE_CTOR(avxu8, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxu8, not_avxu8, mm = _mm256_xor_ps(r.neg.mm, avxu8(all_bits()).mm))
+
+        SIMDEE_UNOP(avxu8, scalar_t, first_scalar,
+                    scalar_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxu8, not_avxb8, operator<, max(l, r) != l)
+        SIMDEE_BINOP(avxu8, not_avxb8, operator>, max(l, r) != r)
+        SIMDEE_BINOP(avxu8, avxb8, operator<=, max(l, r) == r)
+        SIMDEE_BINOP(avxu8, avxb8, operator>=, max(l, r) == l)
+        SIMDEE_BINOP(avxu8, avxb8, operator==, _mm256_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, not_avxb8, operator!=,
+                     not_avxb8(_mm256_cmpeq_epi8(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxu8, avxu8, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu8, avxu8, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu8, avxu8, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxu8, not_avxu8, operator~, not_avxu8(l))
+        SIMDEE_UNOP(avxu8, avxu8, operator-, _mm256_sub_epi8(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, operator+, _mm256_add_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, operator-, _mm256_sub_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, operator*, impl::avx_mullo_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, min, _mm256_min_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, max, _mm256_max_epu8(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(avxu8, avxu8, add_sat, _mm256_adds_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, sub_sat, _mm256_subs_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu8, avxu8, avg, _mm256_avg_epu8(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct avxs8 : avx_base<avxs8> {
+        SIMDEE_TRIVIAL_TYPE(avxs8)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxs8(const avxu8&);
+        SIMDEE_INL avxs8(int8_t v0, int8_t v1, int8_t v2, int8_t v3, int8_t v4, int8_t v5,
+                         int8_t v6, int8_t v7, int8_t v8, int8_t v9, int8_t v10, int8_t v11,
+                         int8_t v12, int8_t v13, int8_t v14, int8_t v15, int8_t v16, int8_t v17,
+                         int8_t v18, int8_t v19, int8_t v20, int8_t v21, int8_t v22, int8_t v23,
+                         int8_t v24, int8_t v25, int8_t v26, int8_t v27, int8_t v28, int8_t v29,
+                         int8_t v30, int8_t v31) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi8(char(v0), char(v1), char(v2), char(v3),
+                                                      char(v4), char(v5), char(v6), char(v7),
+                                                      char(v8), char(v9), char(v10), char(v11),
+                                                      char(v12), char(v13), char(v14), char(v15),
+                                                      char(v16), char(v17), char(v18), char(v19),
+                                                      char(v20), char(v21), char(v22), char(v23),
+                                                      char(v24), char(v25), char(v26), char(v27),
+                                                      char(v28), char(v29), char(v30), char(v31)));
+        }
+        SIMDEE_CTOR(avxs8, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxs8, not_avxs8, mm = _mm256_xor_ps(r.neg.mm, avxs8(all_bits()).mm))
+
+        SIMDEE_UNOP(avxs8, scalar_t, first_scalar,
+                    scalar_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxs8, avxb8, operator<, _mm256_cmpgt_epi8(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(avxs8, avxb8, operator>, _mm256_cmpgt_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, not_avxb8, operator<=,
+                     not_avxb8(_mm256_cmpgt_epi8(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxs8, not_avxb8, operator>=,
+                     not_avxb8(_mm256_cmpgt_epi8(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxs8, avxb8, operator==, _mm256_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, not_avxb8, operator!=,
+                     not_avxb8(_mm256_cmpeq_epi8(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(avxs8, avxs8, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs8, avxs8, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs8, avxs8, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxs8, not_avxs8, operator~, not_avxs8(l))
+
+        SIMDEE_UNOP(avxs8, avxs8, operator-, _mm256_sub_epi8(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, operator+, _mm256_add_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, operator-, _mm256_sub_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, operator*, impl::avx_mullo_epi8(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(avxs8, avxs8, min, _mm256_min_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, max, _mm256_max_epi8(l.mmi(), r.mmi()))
+        SIMDEE_UNOP(avxs8, avxs8, abs, _mm256_abs_epi8(l.mmi()))
+
+        SIMDEE_BINOP(avxs8, avxs8, add_sat, _mm256_adds_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, sub_sat, _mm256_subs_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs8, avxs8, avg, impl::avx_avg_epi8(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct avxb16 : avx_base<avxb16> {
+        SIMDEE_TRIVIAL_TYPE(avxb16)
+
+        using avx_base::avx_base;
+        SIMDEE_INL avxb16(bool16_t v0, bool16_t v1, bool16_t v2, bool16_t v3, bool16_t v4,
+                          bool16_t v5, bool16_t v6, bool16_t v7, bool16_t v8, bool16_t v9,
+                          bool16_t v10, bool16_t v11, bool16_t v12, bool16_t v13, bool16_t v14,
+                          bool16_t v15) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi16(int16_t(v0), int16_t(v1), int16_t(v2),
+                                                       int16_t(v3), int16_t(v4), int16_t(v5),
+                                                       int16_t(v6), int16_t(v7), int16_t(v8),
+                                                       int16_t(v9), int16_t(v10), int16_t(v11),
+                                                       int16_t(v12), int16_t(v13), int16_t(v14),
+                                                       int16_t(v15)));
+        }
+        SIMDEE_CTOR(avxb16, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxb16, not_avxb16, mm = _mm256_xor_ps(r.neg.mm, avxb16(all_bits()).mm))
+
+        SIMDEE_UNOP(avxb16, mask_t, mask,
+                    mask_t(cast_u(_mm256_movemask_epi8(impl::avx_fix_pack(
+                        _mm256_packs_epi16(l.mmi(), _mm256_setzero_si256()))))))
+        SIMDEE_UNOP(avxb16, scalar_t, first_scalar,
+                    scalar_t(uint16_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi())))))
+
+        SIMDEE_BINOP(avxb16, avxb16, operator==, _mm256_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxb16, avxb16, operator!=, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxb16, avxb16, operator&&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxb16, avxb16, operator||, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxb16, not_avxb16, operator!, not_avxb16(l))
+    };
+
+    struct avxu16 : avx_base<avxu16> {
+        SIMDEE_TRIVIAL_TYPE(avxu16)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxu16(const avxb16&);
+        SIMDEE_INL explicit avxu16(const avxs16&);
+        SIMDEE_INL avxu16(uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4,
+                          uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9,
+                          uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14,
+                          uint16_t v15) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi16(int16_t(v0), int16_t(v1), int16_t(v2),
+                                                       int16_t(v3), int16_t(v4), int16_t(v5),
+                                                       int16_t(v6), int16_t(v7), int16_t(v8),
+                                                       int16_t(v9), int16_t(v10), int16_t(v11),
+                                                       int16_t(v12), int16_t(v13), int16_t(v14),
+                                                       int16_t(v15)));
+        }
+        SIMDEE_CTOR(avxu16, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxu16, not_avxu16, mm = _mm256_xor_ps(r.neg.mm, avxu16(all_bits()).mm))
+
+        SIMDEE_UNOP(avxu16, scalar_t, first_scalar,
+                    scalar_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxu16, not_avxb16, operator<, max(l, r) != l)
+        SIMDEE_BINOP(avxu16, not_avxb16, operator>, max(l, r) != r)
+        SIMDEE_BINOP(avxu16, avxb16, operator<=, max(l, r) == r)
+        SIMDEE_BINOP(avxu16, avxb16, operator>=, max(l, r) == l)
+        SIMDEE_BINOP(avxu16, avxb16, operator==, _mm256_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, not_avxb16, operator!=,
+                     not_avxb16(_mm256_cmpeq_epi16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxu16, avxu16, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu16, avxu16, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxu16, avxu16, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxu16, not_avxu16, operator~, not_avxu16(l))
+        SIMDEE_UNOP(avxu16, avxu16, operator-, _mm256_sub_epi16(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, operator+, _mm256_add_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, operator-, _mm256_sub_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, operator*, _mm256_mullo_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, min, _mm256_min_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, max, _mm256_max_epu16(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(avxu16, avxu16, add_sat, _mm256_adds_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, sub_sat, _mm256_subs_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxu16, avxu16, avg, _mm256_avg_epu16(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct avxs16 : avx_base<avxs16> {
+        SIMDEE_TRIVIAL_TYPE(avxs16)
+
+        using avx_base::avx_base;
+        SIMDEE_INL explicit avxs16(const avxu16&);
+        SIMDEE_INL avxs16(int16_t v0, int16_t v1, int16_t v2, int16_t v3, int16_t v4, int16_t v5,
+                          int16_t v6, int16_t v7, int16_t v8, int16_t v9, int16_t v10, int16_t v11,
+                          int16_t v12, int16_t v13, int16_t v14, int16_t v15) {
+            mm = _mm256_castsi256_ps(_mm256_setr_epi16(v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10,
+                                                       v11, v12, v13, v14, v15));
+        }
+        SIMDEE_CTOR(avxs16, __m256i, mm = _mm256_castsi256_ps(r))
+        SIMDEE_CTOR(avxs16, not_avxs16, mm = _mm256_xor_ps(r.neg.mm, avxs16(all_bits()).mm))
+
+        SIMDEE_UNOP(avxs16, scalar_t, first_scalar,
+                    scalar_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(l.mmi()))))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(avxs16, avxb16, operator<, _mm256_cmpgt_epi16(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(avxs16, avxb16, operator>, _mm256_cmpgt_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, not_avxb16, operator<=,
+                     not_avxb16(_mm256_cmpgt_epi16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(avxs16, not_avxb16, operator>=,
+                     not_avxb16(_mm256_cmpgt_epi16(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(avxs16, avxb16, operator==, _mm256_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, not_avxb16, operator!=,
+                     not_avxb16(_mm256_cmpeq_epi16(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(avxs16, avxs16, operator&, _mm256_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs16, avxs16, operator|, _mm256_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(avxs16, avxs16, operator^, _mm256_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(avxs16, not_avxs16, operator~, not_avxs16(l))
+
+        SIMDEE_UNOP(avxs16, avxs16, operator-, _mm256_sub_epi16(_mm256_setzero_si256(), l.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, operator+, _mm256_add_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, operator-, _mm256_sub_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, operator*, _mm256_mullo_epi16(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(avxs16, avxs16, min, _mm256_min_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, max, _mm256_max_epi16(l.mmi(), r.mmi()))
+        SIMDEE_UNOP(avxs16, avxs16, abs, _mm256_abs_epi16(l.mmi()))
+
+        SIMDEE_BINOP(avxs16, avxs16, add_sat, _mm256_adds_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, sub_sat, _mm256_subs_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(avxs16, avxs16, avg, impl::avx_avg_epi16(l.mmi(), r.mmi()))
+#endif
+    };
+#endif
+
     SIMDEE_INL avxf::avxf(const avxs& r) { mm = _mm256_cvtepi32_ps(_mm256_castps_si256(r.data())); }
     SIMDEE_INL avxs::avxs(const avxf& r) {
         mm = _mm256_castsi256_ps(_mm256_cvttps_epi32(r.data()));
@@ -283,6 +1418,102 @@ namespace sd {
     SIMDEE_INL avxu::avxu(const avxb& r) { mm = r.data(); }
     SIMDEE_INL avxu::avxu(const avxs& r) { mm = r.data(); }
     SIMDEE_INL avxs::avxs(const avxu& r) { mm = r.data(); }
+#if SIMDEE_AVX2
+    SIMDEE_INL avxf::avxf(const avxu& r) {
+        mm = impl::avx_cvtepu32_ps(_mm256_castps_si256(r.data()));
+    }
+    SIMDEE_INL avxu::avxu(const avxf& r) {
+        mm = _mm256_castsi256_ps(impl::avx_cvttps_epu32(r.data()));
+    }
+#else
+    SIMDEE_INL avxf::avxf(const avxu& r) {
+        avxu::storage_t s(r);
+        avxf::storage_t res;
+        for (std::size_t i = 0; i < width; ++i) { res[i] = float(s[i]); }
+        aligned_load(res.data());
+    }
+    SIMDEE_INL avxu::avxu(const avxf& r) {
+        avxf::storage_t s(r);
+        avxu::storage_t res;
+        for (std::size_t i = 0; i < width; ++i) { res[i] = uint32_t(s[i]); }
+        aligned_load(res.data());
+    }
+#endif
+
+    // conversion to int, rounding to the nearest integer with ties to even
+    SIMDEE_INL const avxs to_int_round(const avxf& l) { return _mm256_cvtps_epi32(l.data()); }
+
+    SIMDEE_INL avxd::avxd(const avxs64& r) {
+        avxs64::storage_t s(r);
+        mm = _mm256_castpd_ps(
+            _mm256_setr_pd(double(s[0]), double(s[1]), double(s[2]), double(s[3])));
+    }
+    SIMDEE_INL avxs64::avxs64(const avxd& r) {
+        avxd::storage_t s(r);
+        mm = _mm256_castsi256_ps(
+            _mm256_set_epi64x(int64_t(s[3]), int64_t(s[2]), int64_t(s[1]), int64_t(s[0])));
+    }
+    SIMDEE_INL avxu64::avxu64(const avxb64& r) { mm = r.data(); }
+    SIMDEE_INL avxu64::avxu64(const avxs64& r) { mm = r.data(); }
+    SIMDEE_INL avxs64::avxs64(const avxu64& r) { mm = r.data(); }
+
+#if SIMDEE_AVX2
+    SIMDEE_INL avxu8::avxu8(const avxb8& r) { mm = r.data(); }
+    SIMDEE_INL avxu8::avxu8(const avxs8& r) { mm = r.data(); }
+    SIMDEE_INL avxs8::avxs8(const avxu8& r) { mm = r.data(); }
+
+    SIMDEE_INL avxu16::avxu16(const avxb16& r) { mm = r.data(); }
+    SIMDEE_INL avxu16::avxu16(const avxs16& r) { mm = r.data(); }
+    SIMDEE_INL avxs16::avxs16(const avxu16& r) { mm = r.data(); }
+
+#if SIMDEE_NEED_INT
+    SIMDEE_INL const avxu16 widen_lo(const avxu8& l) {
+        return _mm256_cvtepu8_epi16(_mm256_castsi256_si128(_mm256_castps_si256(l.data())));
+    }
+    SIMDEE_INL const avxu16 widen_hi(const avxu8& l) {
+        return _mm256_cvtepu8_epi16(_mm256_extracti128_si256(_mm256_castps_si256(l.data()), 1));
+    }
+    SIMDEE_INL const avxs16 widen_lo(const avxs8& l) {
+        return _mm256_cvtepi8_epi16(_mm256_castsi256_si128(_mm256_castps_si256(l.data())));
+    }
+    SIMDEE_INL const avxs16 widen_hi(const avxs8& l) {
+        return _mm256_cvtepi8_epi16(_mm256_extracti128_si256(_mm256_castps_si256(l.data()), 1));
+    }
+    SIMDEE_INL const avxu widen_lo(const avxu16& l) {
+        return _mm256_cvtepu16_epi32(_mm256_castsi256_si128(_mm256_castps_si256(l.data())));
+    }
+    SIMDEE_INL const avxu widen_hi(const avxu16& l) {
+        return _mm256_cvtepu16_epi32(_mm256_extracti128_si256(_mm256_castps_si256(l.data()), 1));
+    }
+    SIMDEE_INL const avxs widen_lo(const avxs16& l) {
+        return _mm256_cvtepi16_epi32(_mm256_castsi256_si128(_mm256_castps_si256(l.data())));
+    }
+    SIMDEE_INL const avxs widen_hi(const avxs16& l) {
+        return _mm256_cvtepi16_epi32(_mm256_extracti128_si256(_mm256_castps_si256(l.data()), 1));
+    }
+
+    SIMDEE_INL const avxu8 narrow(const avxu16& lo, const avxu16& hi) {
+        __m256i top = _mm256_set1_epi16(0xff);
+        return impl::avx_fix_pack(
+            _mm256_packus_epi16(_mm256_min_epu16(_mm256_castps_si256(lo.data()), top),
+                                _mm256_min_epu16(_mm256_castps_si256(hi.data()), top)));
+    }
+    SIMDEE_INL const avxs8 narrow(const avxs16& lo, const avxs16& hi) {
+        return impl::avx_fix_pack(
+            _mm256_packs_epi16(_mm256_castps_si256(lo.data()), _mm256_castps_si256(hi.data())));
+    }
+    SIMDEE_INL const avxu16 narrow(const avxu& lo, const avxu& hi) {
+        __m256i top = _mm256_set1_epi32(0xffff);
+        return impl::avx_fix_pack(
+            _mm256_packus_epi32(_mm256_min_epu32(_mm256_castps_si256(lo.data()), top),
+                                _mm256_min_epu32(_mm256_castps_si256(hi.data()), top)));
+    }
+    SIMDEE_INL const avxs16 narrow(const avxs& lo, const avxs& hi) {
+        return impl::avx_fix_pack(
+            _mm256_packs_epi32(_mm256_castps_si256(lo.data()), _mm256_castps_si256(hi.data())));
+    }
+#endif
+#endif
 
     SIMDEE_INL const avxb cond(const avxb& pred, const avxb& if_true, const avxb& if_false) {
         return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
@@ -297,6 +1528,58 @@ namespace sd {
         return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
     }
 
+    SIMDEE_INL const avxb64 cond(const avxb64& pred, const avxb64& if_true,
+                                 const avxb64& if_false) {
+        return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
+    }
+    SIMDEE_INL const avxd cond(const avxb64& pred, const avxd& if_true, const avxd& if_false) {
+        return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
+    }
+    SIMDEE_INL const avxu64 cond(const avxb64& pred, const avxu64& if_true,
+                                 const avxu64& if_false) {
+        return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
+    }
+    SIMDEE_INL const avxs64 cond(const avxb64& pred, const avxs64& if_true,
+                                 const avxs64& if_false) {
+        return _mm256_blendv_ps(if_false.data(), if_true.data(), pred.data());
+    }
+
+#if SIMDEE_AVX2
+    SIMDEE_INL const avxb8 cond(const avxb8& pred, const avxb8& if_true, const avxb8& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+    SIMDEE_INL const avxu8 cond(const avxb8& pred, const avxu8& if_true, const avxu8& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+    SIMDEE_INL const avxs8 cond(const avxb8& pred, const avxs8& if_true, const avxs8& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+    SIMDEE_INL const avxb16 cond(const avxb16& pred, const avxb16& if_true,
+                                 const avxb16& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+    SIMDEE_INL const avxu16 cond(const avxb16& pred, const avxu16& if_true,
+                                 const avxu16& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+    SIMDEE_INL const avxs16 cond(const avxb16& pred, const avxs16& if_true,
+                                 const avxs16& if_false) {
+        return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(if_false.data()),
+                                                      _mm256_castps_si256(if_true.data()),
+                                                      _mm256_castps_si256(pred.data())));
+    }
+#endif
+
     namespace impl {
 
         template <typename T, typename NotT>
@@ -319,8 +1602,101 @@ namespace sd {
         template <>
         struct special_ops<avxs> : avx_special_ops<avxs, not_avxs> {};
 
+        template <>
+        struct special_ops<avxb64> : avx_special_ops<avxb64, not_avxb64> {};
+
+        template <>
+        struct special_ops<avxu64> : avx_special_ops<avxu64, not_avxu64> {};
+
+        template <>
+        struct special_ops<avxs64> : avx_special_ops<avxs64, not_avxs64> {};
+
+#if SIMDEE_AVX2
+        template <>
+        struct special_ops<avxb8> : avx_special_ops<avxb8, not_avxb8> {};
+
+        template <>
+        struct special_ops<avxu8> : avx_special_ops<avxu8, not_avxu8> {};
+
+        template <>
+        struct special_ops<avxs8> : avx_special_ops<avxs8, not_avxs8> {};
+
+        template <>
+        struct special_ops<avxb16> : avx_special_ops<avxb16, not_avxb16> {};
+
+        template <>
+        struct special_ops<avxu16> : avx_special_ops<avxu16, not_avxu16> {};
+
+        template <>
+        struct special_ops<avxs16> : avx_special_ops<avxs16, not_avxs16> {};
+#endif
+
+        struct avx_network_ops {
+            using type = __m256;
+
+            SIMDEE_INL static __m256 unpacklo(__m256 a, __m256 b) {
+                return _mm256_unpacklo_ps(a, b);
+            }
+            SIMDEE_INL static __m256 unpackhi(__m256 a, __m256 b) {
+                return _mm256_unpackhi_ps(a, b);
+            }
+            template <int Imm>
+            SIMDEE_INL static __m256 shuffle(__m256 a, __m256 b) {
+                return _mm256_shuffle_ps(a, b, Imm);
+            }
+        };
+
+        // two to four channels of 32-bit scalars go through shuffle_network<>, which works within
+        // the 128-bit halves, so the lower halves are loaded with records 0 to 3 and the upper
+        // halves with records 4 to 7
+        template <std::size_t N, typename Simd_t>
+        struct avx_channels {
+            using scalar_t = typename Simd_t::scalar_t;
+
+            SIMDEE_INL static void load(const scalar_t* ptr, Simd_t* out) {
+                const float* p = reinterpret_cast<const float*>(ptr);
+                __m256 in[N], res[N];
+                auto load_one = [&](std::size_t s) {
+                    const __m256 lo = _mm256_castps128_ps256(_mm_loadu_ps(p + 4 * s));
+                    in[s] = _mm256_insertf128_ps(lo, _mm_loadu_ps(p + 4 * (N + s)), 1);
+                };
+                static_for<N>::apply(load_one);
+                shuffle_network<N, avx_network_ops>::load(in, res);
+                auto copy = [&](std::size_t c) { out[c] = res[c]; };
+                static_for<N>::apply(copy);
+            }
+            SIMDEE_INL static void store(scalar_t* ptr, const Simd_t* in) {
+                float* p = reinterpret_cast<float*>(ptr);
+                __m256 mm[N], res[N];
+                auto copy = [&](std::size_t c) { mm[c] = in[c].data(); };
+                static_for<N>::apply(copy);
+                shuffle_network<N, avx_network_ops>::store(mm, res);
+                auto store_one = [&](std::size_t s) {
+                    _mm_storeu_ps(p + 4 * s, _mm256_castps256_ps128(res[s]));
+                    _mm_storeu_ps(p + 4 * (N + s), _mm256_extractf128_ps(res[s], 1));
+                };
+                static_for<N>::apply(store_one);
+            }
+        };
+
+        template <std::size_t N>
+        struct channels<N, avxf>
+            : std::conditional<(N >= 2 && N <= 4), avx_channels<N, avxf>,
+                               blend_channels<N, avxf>>::type {};
+
+        template <std::size_t N>
+        struct channels<N, avxu>
+            : std::conditional<(N >= 2 && N <= 4), avx_channels<N, avxu>,
+                               blend_channels<N, avxu>>::type {};
+
+        template <std::size_t N>
+        struct channels<N, avxs>
+            : std::conditional<(N >= 2 && N <= 4), avx_channels<N, avxs>,
+                               blend_channels<N, avxs>>::type {};
+
     } // namespace impl
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_SIMD_TYPES_AVX_HPP
@@ -13,15 +13,33 @@
 #include "../util/inline.hpp"
 #include "../util/macros.hpp"
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     template <typename T>
     struct is_simd_vector : std::integral_constant<bool, false> {};
     template <typename T>
     struct simd_vector_traits;
 
+    namespace impl {
+        // sliding window for masking loop tails, the mask that enables the first n bytes of a
+        // vector starts at bytes + 32 - n
+        template <typename Dummy = void>
+        struct tail_mask {
+            alignas(64) static const int8_t bytes[64];
+        };
+        template <typename Dummy>
+        const int8_t tail_mask<Dummy>::bytes[64] = {
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+            0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
+    } // namespace impl
+
     template <typename Crtp>
     struct simd_base {
         using traits_t = simd_vector_traits<Crtp>;
@@ -68,6 +86,16 @@ namespace sd {
         return l.self();
     }
     template <typename Simd_t, typename Rhs_t>
+    SIMDEE_INL Simd_t& operator<<=(simd_base<Simd_t>& l, const Rhs_t& r) {
+        l.self() = l.self() << r;
+        return l.self();
+    }
+    template <typename Simd_t, typename Rhs_t>
+    SIMDEE_INL Simd_t& operator>>=(simd_base<Simd_t>& l, const Rhs_t& r) {
+        l.self() = l.self() >> r;
+        return l.self();
+    }
+    template <typename Simd_t, typename Rhs_t>
     SIMDEE_INL Simd_t& operator+=(simd_base<Simd_t>& l, const Rhs_t& r) {
         l.self() = l.self() + r;
         return l.self();
@@ -91,6 +119,32 @@ namespace sd {
     SIMDEE_INL const Simd_t operator+(const simd_base<Simd_t>& l) {
         return l.self();
     }
+    // scalar-wise bit rotation to the left and to the right, by n modulo the scalar width
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t rotl(const simd_base<Simd_t>& l, int n) {
+        using U = typename Simd_t::vec_u;
+        const int bits = int(sizeof(typename Simd_t::scalar_t) * 8);
+        const U x(l.self());
+        n &= bits - 1;
+        return Simd_t((x << n) | (x >> (bits - n)));
+    }
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t rotr(const simd_base<Simd_t>& l, int n) {
+        return rotl(l, -n);
+    }
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t rotl(const simd_base<Simd_t>& l, const simd_base<Simd_t>& r) {
+        using U = typename Simd_t::vec_u;
+        using u_t = typename U::scalar_t;
+        const U bits(u_t(sizeof(u_t) * 8));
+        const U x(l.self());
+        const U n = U(r.self()) & (bits - U(u_t(1)));
+        return Simd_t((x << n) | (x >> (bits - n)));
+    }
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t rotr(const simd_base<Simd_t>& l, const simd_base<Simd_t>& r) {
+        return rotl(l.self(), Simd_t(-r.self()));
+    }
     template <typename Simd_t>
     SIMDEE_INL bool any(const simd_base<Simd_t>& l) {
         return any(mask(l.self()));
@@ -100,47 +154,91 @@ namespace sd {
         return all(mask(l.self()));
     }
 
+    namespace impl {
+        // the smallest and the largest value of T, infinite if T has infinities
+        template <typename T, bool Inf = std::numeric_limits<T>::has_infinity>
+        struct extremes {
+            static constexpr T lowest() { return std::numeric_limits<T>::lowest(); }
+            static constexpr T highest() { return std::numeric_limits<T>::max(); }
+        };
+        template <typename T>
+        struct extremes<T, true> {
+            static constexpr T lowest() { return -std::numeric_limits<T>::infinity(); }
+            static constexpr T highest() { return std::numeric_limits<T>::infinity(); }
+        };
+    } // namespace impl
+
+    // reduction operators for reduce(), reduce_n() and the scans; identity<T>() is the value
+    // that leaves the other operand unchanged
     struct op_add {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l + r) {
             return l + r;
         }
+        template <typename T>
+        static constexpr T identity() {
+            return T(0);
+        }
     };
     struct op_mul {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l * r) {
             return l * r;
         }
+        template <typename T>
+        static constexpr T identity() {
+            return T(1);
+        }
     };
     struct op_min {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(min(l, r)) {
             return min(l, r);
         }
+        template <typename T>
+        static constexpr T identity() {
+            return impl::extremes<T>::highest();
+        }
     };
     struct op_max {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(max(l, r)) {
             return max(l, r);
         }
+        template <typename T>
+        static constexpr T identity() {
+            return impl::extremes<T>::lowest();
+        }
     };
     struct op_bitand {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l & r) {
             return l & r;
         }
+        template <typename T>
+        static constexpr T identity() {
+            return T(~T(0));
+        }
     };
     struct op_bitor {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l | r) {
             return l | r;
         }
+        template <typename T>
+        static constexpr T identity() {
+            return T(0);
+        }
     };
     struct op_bitxor {
         template <typename L, typename R>
         SIMDEE_INL auto operator()(const L& l, const R& r) -> decltype(l ^ r) {
             return l ^ r;
         }
+        template <typename T>
+        static constexpr T identity() {
+            return T(0);
+        }
     };
     struct op_logand {
         template <typename L, typename R>
@@ -154,6 +252,738 @@ namespace sd {
             return l || r;
         }
     };
+
+    // horizontal reductions to a single scalar
+    template <typename Simd_t>
+    SIMDEE_INL typename Simd_t::scalar_t hsum(const simd_base<Simd_t>& l) {
+        return first_scalar(reduce(l.self(), op_add{}));
+    }
+    template <typename Simd_t>
+    SIMDEE_INL typename Simd_t::scalar_t hprod(const simd_base<Simd_t>& l) {
+        return first_scalar(reduce(l.self(), op_mul{}));
+    }
+    template <typename Simd_t>
+    SIMDEE_INL typename Simd_t::scalar_t hmin(const simd_base<Simd_t>& l) {
+        return first_scalar(reduce(l.self(), op_min{}));
+    }
+    template <typename Simd_t>
+    SIMDEE_INL typename Simd_t::scalar_t hmax(const simd_base<Simd_t>& l) {
+        return first_scalar(reduce(l.self(), op_max{}));
+    }
+
+    namespace impl {
+        // lane i of the result is the reduction of rows[i], for width rows; each level halves the
+        // number of vectors by reducing interleaved pairs, and pairing row j with row j + n/2
+        // leaves the results in order
+        template <typename Simd_t, typename Op_t>
+        const Simd_t reduce_rows_tree(const Simd_t* rows, Op_t f) {
+            Simd_t t[Simd_t::width];
+            for (std::size_t j = 0; j < Simd_t::width; ++j) { t[j] = rows[j]; }
+            for (std::size_t n = Simd_t::width; n > 1; n /= 2) {
+                for (std::size_t j = 0; j < n / 2; ++j) {
+                    const Simd_t& a = t[j];
+                    const Simd_t& b = t[j + n / 2];
+                    t[j] = f(interleave_lo(a, b), interleave_hi(a, b));
+                }
+            }
+            return t[0];
+        }
+    } // namespace impl
+
+    // lane i of the result is the reduction of v[i] with f, for up to width vectors, the lanes
+    // from N onwards repeat the last result; the vectors are transposed and reduced together,
+    // which takes far fewer operations than N calls to reduce()
+    template <typename Simd_t, std::size_t N, typename Op_t>
+    SIMDEE_INL const Simd_t reduce_n(const Simd_t (&v)[N], Op_t f) {
+        static_assert(is_simd_vector<Simd_t>::value, "reduce_n(): expected SIMD vectors");
+        static_assert(N >= 1 && N <= Simd_t::width, "reduce_n(): expected 1 to width vectors");
+        if (N == Simd_t::width) return reduce_rows(v, f);
+        Simd_t rows[Simd_t::width];
+        for (std::size_t i = 0; i < Simd_t::width; ++i) { rows[i] = v[i < N ? i : N - 1]; }
+        return reduce_rows(rows, f);
+    }
+
+    // accuracy of rcp, rsqrt and sqrt:
+    // fast -- the hardware estimate as is, its error depends on the instruction set
+    // refined -- the estimate refined by Newton-Raphson steps to 2 ulp, 1 ulp with FMA, and the
+    //            square root to 1 ulp, on every platform
+    // exact -- IEEE division and square root
+    namespace precision {
+        struct fast {};
+        struct refined {};
+        struct exact {};
+    } // namespace precision
+
+    namespace impl {
+        // number of Newton-Raphson steps that refine the estimates of rcp and rsqrt to 2 ulp, 1 ulp
+        // with FMA; zero for vector types where they are already exact
+        template <typename Simd_t>
+        struct refine_steps : std::integral_constant<int, 0> {};
+
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rcp_tier(const Simd_t& x, precision::fast) {
+            return rcp(x);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rcp_tier(const Simd_t& x, precision::refined) {
+            const Simd_t r0 = rcp(x);
+            Simd_t r = r0;
+            for (int i = 0; i < refine_steps<Simd_t>::value; ++i) {
+                // third-order step, 1/x = r / (1 - e) ~ r * (1 + e + e^2)
+                const Simd_t e = fnma(x, r, Simd_t(1.f));
+                r = fma(r, fma(e, e, e), r);
+            }
+            // x = 0, x = inf and results out of range turn the step into 0 * inf
+            return cond(r == r, r, r0);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rcp_tier(const Simd_t& x, precision::exact) {
+            return Simd_t(1.f) / x;
+        }
+
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rsqrt_tier(const Simd_t& x, precision::fast) {
+            return rsqrt(x);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rsqrt_tier(const Simd_t& x, precision::refined) {
+            const Simd_t r0 = rsqrt(x);
+            Simd_t r = r0;
+            for (int i = 0; i < refine_steps<Simd_t>::value; ++i) {
+                // third-order step, 1/sqrt(x) = r / sqrt(1 - e) ~ r * (1 + e/2 + 3e^2/8)
+                const Simd_t e = fnma(x * r, r, Simd_t(1.f));
+                r = fma(r * e, fma(Simd_t(0.375f), e, Simd_t(0.5f)), r);
+            }
+            return cond(r == r, r, r0);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t rsqrt_tier(const Simd_t& x, precision::exact) {
+            return Simd_t(1.f) / sqrt(x);
+        }
+
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t sqrt_tier(const Simd_t& x, precision::fast) {
+            // where rsqrt is exact, so is sqrt, and it is both faster and more precise
+            if (refine_steps<Simd_t>::value == 0) return sqrt(x);
+            const Simd_t y = x * rsqrt(x);
+            return cond(x == Simd_t(zero()) || x == Simd_t(inf()), x, y);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t sqrt_tier(const Simd_t& x, precision::refined) {
+            if (refine_steps<Simd_t>::value == 0) return sqrt(x);
+            const Simd_t r = rsqrt_tier(x, precision::refined{});
+            Simd_t y = x * r;
+            // one Newton-Raphson step on the square root itself removes the rounding of x * r
+            y = fma(Simd_t(0.5f) * r, fnma(y, y, x), y);
+            return cond(x == Simd_t(zero()) || x == Simd_t(inf()), x, y);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t sqrt_tier(const Simd_t& x, precision::exact) {
+            return sqrt(x);
+        }
+
+        // rounding for targets without a rounding instruction: adding and subtracting
+        // 2^(digits - 1) rounds to the nearest integer, ties to even, and scalars of at least that
+        // magnitude are integers already
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t nearest_emulated(const Simd_t& x) {
+            using scalar_t = typename Simd_t::scalar_t;
+            const Simd_t magic(scalar_t(1) / std::numeric_limits<scalar_t>::epsilon());
+            const Simd_t zero(scalar_t(0));
+            const Simd_t ax = abs(x);
+            const Simd_t r = (ax + magic) - magic;
+            return cond(ax < magic && x != zero, cond(x < zero, -r, r), x);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t trunc_emulated(const Simd_t& x) {
+            using scalar_t = typename Simd_t::scalar_t;
+            const Simd_t zero(scalar_t(0));
+            const Simd_t ax = abs(x);
+            Simd_t t = nearest_emulated(ax);
+            t = cond(t > ax, t - Simd_t(scalar_t(1)), t);
+            return cond(x < zero, -t, cond(x == zero, x, t));
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t floor_emulated(const Simd_t& x) {
+            using scalar_t = typename Simd_t::scalar_t;
+            const Simd_t t = trunc_emulated(x);
+            return cond(t > x, t - Simd_t(scalar_t(1)), t);
+        }
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t ceil_emulated(const Simd_t& x) {
+            using scalar_t = typename Simd_t::scalar_t;
+            const Simd_t t = trunc_emulated(x);
+            return cond(t < x, t + Simd_t(scalar_t(1)), t);
+        }
+
+        // round to the nearest integer with ties away from zero, given t = trunc(x); the
+        // fractional part x - t is exact
+        template <typename Simd_t>
+        SIMDEE_INL const Simd_t round_away(const Simd_t& x, const Simd_t& t) {
+            using scalar_t = typename Simd_t::scalar_t;
+            const Simd_t one(scalar_t(1));
+            const Simd_t step = cond(x < Simd_t(scalar_t(0)), -one, one);
+            return cond(abs(x - t) >= Simd_t(scalar_t(0.5)), t + step, t);
+        }
+    } // namespace impl
+
+    // scalar-wise reciprocal with selectable precision, e.g. sd::rcp<sd::precision::refined>(x)
+    template <typename Precision = precision::fast, typename Simd_t>
+    SIMDEE_INL const Simd_t rcp(const simd_base<Simd_t>& l) {
+        return impl::rcp_tier(l.self(), Precision{});
+    }
+
+    // scalar-wise reciprocal square root with selectable precision
+    template <typename Precision = precision::fast, typename Simd_t>
+    SIMDEE_INL const Simd_t rsqrt(const simd_base<Simd_t>& l) {
+        return impl::rsqrt_tier(l.self(), Precision{});
+    }
+
+    // scalar-wise square root with selectable precision, exact by default
+    template <typename Precision = precision::exact, typename Simd_t>
+    SIMDEE_INL const Simd_t sqrt(const simd_base<Simd_t>& l) {
+        return impl::sqrt_tier(l.self(), Precision{});
+    }
+
+    namespace impl {
+        // compile-time lane indices and lane masks, the arguments of the shuffle and blend friends
+        template <std::size_t... I>
+        struct lanes {};
+        template <std::uint64_t Mask>
+        struct lane_mask {};
+
+        // lanes<0, 1, ..., N - 1>
+        template <std::size_t N, std::size_t... I>
+        struct make_lanes : make_lanes<N - 1, N - 1, I...> {};
+        template <std::size_t... I>
+        struct make_lanes<0, I...> {
+            using type = lanes<I...>;
+        };
+
+        // the j-th element of the index list
+        constexpr std::size_t lane_at(std::size_t) { return 0; }
+        template <typename... T>
+        constexpr std::size_t lane_at(std::size_t j, std::size_t i, T... rest) {
+            return j == 0 ? i : lane_at(j - 1, rest...);
+        }
+
+        // the mask with bit j set when the j-th argument is true
+        constexpr std::uint64_t lane_bits() { return 0; }
+        template <typename... T>
+        constexpr std::uint64_t lane_bits(bool b, T... rest) {
+            return std::uint64_t(b) | (lane_bits(rest...) << 1);
+        }
+
+        // true when every index is below width
+        constexpr bool lanes_below(std::size_t) { return true; }
+        template <typename... T>
+        constexpr bool lanes_below(std::size_t width, std::size_t i, T... rest) {
+            return i < width && lanes_below(width, rest...);
+        }
+
+        // lanes<Fn::at(0), ..., Fn::at(N - 1)>
+        template <typename Fn, typename Seq>
+        struct map_lanes;
+        template <typename Fn, std::size_t... J>
+        struct map_lanes<Fn, lanes<J...>> {
+            using type = lanes<Fn::at(J)...>;
+        };
+
+        template <std::size_t W>
+        struct reverse_fn {
+            static constexpr std::size_t at(std::size_t j) { return W - 1 - j; }
+        };
+        template <std::size_t W, std::size_t K>
+        struct rotate_fn {
+            static constexpr std::size_t at(std::size_t j) { return (j + K) % W; }
+        };
+        template <std::size_t K>
+        struct broadcast_fn {
+            static constexpr std::size_t at(std::size_t) { return K; }
+        };
+
+        template <typename Simd_t, typename Fn>
+        using mapped_lanes =
+            typename map_lanes<Fn, typename make_lanes<Simd_t::width>::type>::type;
+
+        // permutations that no instruction handles go through memory
+        template <typename Simd_t, std::size_t... I>
+        const Simd_t shuffle_fallback(const Simd_t& l, lanes<I...>) {
+            using storage_t = typename Simd_t::storage_t;
+            const storage_t s(l);
+            const storage_t r{s[I]...};
+            return Simd_t(r);
+        }
+    } // namespace impl
+
+    // lane i of the result is lane I_i of l, e.g. sd::shuffle<1, 0, 3, 2>(x) swaps neighbouring
+    // lanes of a 4-lane vector; the best instruction for the pattern is picked at compile time
+    template <std::size_t... I, typename Simd_t>
+    SIMDEE_INL const Simd_t shuffle(const simd_base<Simd_t>& l) {
+        static_assert(sizeof...(I) == Simd_t::width, "shuffle(): expected one index per lane");
+        static_assert(impl::lanes_below(Simd_t::width, I...), "shuffle(): index out of range");
+        return shuffle(l.self(), impl::lanes<I...>{});
+    }
+
+    // lane i of the result is lane i of b if bit i of Mask is set, lane i of a otherwise
+    template <std::uint64_t Mask, typename Simd_t>
+    SIMDEE_INL const Simd_t blend(const simd_base<Simd_t>& a, const simd_base<Simd_t>& b) {
+        static_assert(Simd_t::width >= 64 || (Mask >> Simd_t::width) == 0,
+                      "blend(): mask has bits above the vector width");
+        return blend(a.self(), b.self(), impl::lane_mask<Mask>{});
+    }
+
+    // lanes in reverse order
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t reverse(const simd_base<Simd_t>& l) {
+        return shuffle(l.self(), impl::mapped_lanes<Simd_t, impl::reverse_fn<Simd_t::width>>{});
+    }
+
+    // lane i of the result is lane (i + K) % width of l, i.e. lanes move K places towards lane 0
+    template <std::size_t K, typename Simd_t>
+    SIMDEE_INL const Simd_t rotate_lanes(const simd_base<Simd_t>& l) {
+        using fn = impl::rotate_fn<Simd_t::width, K % Simd_t::width>;
+        return shuffle(l.self(), impl::mapped_lanes<Simd_t, fn>{});
+    }
+
+    // lane K of l in every lane
+    template <std::size_t K, typename Simd_t>
+    SIMDEE_INL const Simd_t broadcast_lane(const simd_base<Simd_t>& l) {
+        static_assert(K < Simd_t::width, "broadcast_lane(): index out of range");
+        return shuffle(l.self(), impl::mapped_lanes<Simd_t, impl::broadcast_fn<K>>{});
+    }
+
+    namespace impl {
+        // lane j of the result is lane j - K of the source, lanes below K are left in place
+        template <std::size_t K>
+        struct shift_up_fn {
+            static constexpr std::size_t at(std::size_t j) { return j >= K ? j - K : j; }
+        };
+
+        // mask of lanes K to W - 1, K < W <= 64
+        constexpr std::uint64_t lanes_from(std::size_t k, std::size_t w) {
+            return (~std::uint64_t(0) >> (64 - w)) & ~((std::uint64_t(1) << k) - 1);
+        }
+
+        // log-step scan: after the step with shift K, each lane holds the reduction of up to 2K
+        // preceding lanes; lanes below K are complete and are kept by the blend
+        template <typename Simd_t, std::size_t K, bool Done = (K >= Simd_t::width)>
+        struct scan_steps {
+            template <typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& x, Op_t f) {
+                using shifted = mapped_lanes<Simd_t, shift_up_fn<K>>;
+                using upper = lane_mask<lanes_from(K, Simd_t::width)>;
+                const Simd_t y = blend(x, f(shuffle(x, shifted{}), x), upper{});
+                return scan_steps<Simd_t, K * 2>::apply(y, f);
+            }
+        };
+        template <typename Simd_t, std::size_t K>
+        struct scan_steps<Simd_t, K, true> {
+            template <typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& x, Op_t) {
+                return x;
+            }
+        };
+
+        template <typename Simd_t>
+        struct scan {
+            template <typename Op_t>
+            SIMDEE_INL static const Simd_t inclusive(const Simd_t& x, Op_t f) {
+                return scan_steps<Simd_t, 1>::apply(x, f);
+            }
+        };
+    } // namespace impl
+
+    // lane i of the result is the reduction of lanes 0 to i of l, e.g. the running sum with
+    // sd::op_add
+    template <typename Simd_t, typename Op_t>
+    SIMDEE_INL const Simd_t inclusive_scan(const simd_base<Simd_t>& l, Op_t f) {
+        return impl::scan<Simd_t>::inclusive(l.self(), f);
+    }
+
+    // lane i of the result is the reduction of init and lanes 0 to i - 1 of l; init defaults to
+    // the identity of f
+    template <typename Simd_t, typename Op_t>
+    SIMDEE_INL const Simd_t exclusive_scan(
+        const simd_base<Simd_t>& l, Op_t f,
+        typename Simd_t::scalar_t init = Op_t::template identity<typename Simd_t::scalar_t>()) {
+        using shifted = impl::mapped_lanes<Simd_t, impl::shift_up_fn<1>>;
+        using upper = impl::lane_mask<impl::lanes_from(1, Simd_t::width)>;
+        const Simd_t first(init);
+        const Simd_t incl = impl::scan<Simd_t>::inclusive(l.self(), f);
+        return blend(first, f(first, shuffle(incl, shifted{})), upper{});
+    }
+
+    namespace impl {
+        // number of bits set in the lowest j bits of m
+        constexpr std::size_t bits_below(std::uint64_t m, std::size_t j) {
+            return (j == 0 || m == 0) ? 0 : ((m & 1) ? 1 : 0) + bits_below(m >> 1, j - 1);
+        }
+
+        // index of the j-th bit set in m
+        constexpr std::size_t nth_bit(std::uint64_t m, std::size_t j, std::size_t i = 0) {
+            return m == 0 ? 0
+                          : (m & 1) ? (j == 0 ? i : nth_bit(m >> 1, j - 1, i + 1))
+                                    : nth_bit(m >> 1, j, i + 1);
+        }
+
+        // whether lane j of compress(x, m) (Expand false) or expand(x, m) (Expand true) is zero,
+        // and which lane of x it takes otherwise
+        constexpr bool pack_zero(bool expand, std::uint64_t m, std::size_t j) {
+            return expand ? ((m >> j) & 1) == 0 : j >= bits_below(m, 64);
+        }
+        constexpr std::size_t pack_source(bool expand, std::uint64_t m, std::size_t j) {
+            return expand ? bits_below(m, j) : nth_bit(m, j);
+        }
+
+        // byte indices for compress and expand of a 16-byte vector with Bytes-byte lanes, one row
+        // per value of the mask; the zeroed bytes have the top bit set, as pshufb and tbl expect
+        struct alignas(16) pack_row {
+            std::uint8_t b[16];
+        };
+        template <std::size_t Bytes, bool Expand, std::size_t... K>
+        constexpr pack_row make_pack_row(std::uint64_t m, lanes<K...>) {
+            return pack_row{{std::uint8_t(pack_zero(Expand, m, K / Bytes)
+                                              ? 0x80
+                                              : pack_source(Expand, m, K / Bytes) * Bytes +
+                                                    K % Bytes)...}};
+        }
+        template <std::size_t Bytes, bool Expand,
+                  typename M = typename make_lanes<(std::size_t(1) << (16 / Bytes))>::type>
+        struct pack_bytes;
+        template <std::size_t Bytes, bool Expand, std::size_t... M>
+        struct pack_bytes<Bytes, Expand, lanes<M...>> {
+            SIMDEE_INL static const std::uint8_t* row(std::uint64_t m) {
+                static constexpr pack_row rows[] = {
+                    make_pack_row<Bytes, Expand>(M, typename make_lanes<16>::type{})...};
+                return rows[m].b;
+            }
+        };
+
+        // compress and expand through memory, for the vectors without a suitable instruction
+        template <bool Expand, typename Simd_t>
+        const Simd_t pack_fallback(const Simd_t& l, std::uint64_t m) {
+            using storage_t = typename Simd_t::storage_t;
+            const storage_t s(l);
+            const Simd_t zeros(zero());
+            storage_t r(zeros);
+            for (std::size_t i = 0, n = 0; i < Simd_t::width; ++i) {
+                if ((m >> i) & 1) {
+                    if (Expand) {
+                        r[i] = s[n++];
+                    } else {
+                        r[n++] = s[i];
+                    }
+                }
+            }
+            return Simd_t(r);
+        }
+
+        template <typename Simd_t>
+        struct compaction {
+            using scalar_t = typename Simd_t::scalar_t;
+            using mask_t = typename Simd_t::mask_t;
+
+            SIMDEE_INL static std::size_t store(scalar_t* ptr, const Simd_t& x, mask_t m) {
+                const std::size_t n = detail::popcount(m.value);
+                compress(x, m).partial_store(ptr, n);
+                return n;
+            }
+            SIMDEE_INL static const Simd_t load(const scalar_t* ptr, mask_t m) {
+                Simd_t res;
+                res.partial_load(ptr, detail::popcount(m.value), Simd_t(zero()));
+                return expand(res, m);
+            }
+        };
+    } // namespace impl
+
+    // writes the scalars of v selected by m to consecutive locations starting at ptr and returns
+    // their count; nothing past the last selected scalar is written, e.g.
+    // ptr += sd::compress_store(ptr, v, mask(v < limit)) keeps the scalars below limit
+    template <typename Simd_t>
+    SIMDEE_INL std::size_t compress_store(typename Simd_t::scalar_t* ptr,
+                                          const simd_base<Simd_t>& v,
+                                          typename Simd_t::mask_t m) {
+        return impl::compaction<Simd_t>::store(ptr, v.self(), m);
+    }
+
+    // the inverse of compress_store(): consecutive scalars starting at ptr, placed in the lanes
+    // selected by m in order; the other lanes are zero and nothing past the last scalar is read
+    template <typename Simd_t>
+    SIMDEE_INL const Simd_t expand_load(const typename Simd_t::scalar_t* ptr,
+                                        typename Simd_t::mask_t m) {
+        return impl::compaction<Simd_t>::load(ptr, m);
+    }
+
+    namespace impl {
+        // each lane of the result tests its own bit of m, which is broadcast when a lane has room
+        // for the whole mask; narrower lanes take the byte of m that holds their bit
+        template <typename Simd_t,
+                  bool Fits = (Simd_t::width <= 8 * sizeof(typename Simd_t::scalar_t))>
+        struct mask_lanes {
+            using vec_u = typename Simd_t::vec_u;
+            using u_t = typename vec_u::scalar_t;
+
+            SIMDEE_INL static const typename Simd_t::vec_b apply(std::uint64_t m) {
+                typename vec_u::storage_t bit;
+                for (std::size_t i = 0; i < Simd_t::width; ++i) { bit[i] = u_t(1ULL << i); }
+                const vec_u b(bit);
+                return (vec_u(u_t(m)) & b) == b;
+            }
+        };
+        template <typename Simd_t>
+        struct mask_lanes<Simd_t, false> {
+            using vec_u = typename Simd_t::vec_u;
+            using u_t = typename vec_u::scalar_t;
+
+            SIMDEE_INL static const typename Simd_t::vec_b apply(std::uint64_t m) {
+                typename vec_u::storage_t bit, bits;
+                for (std::size_t i = 0; i < Simd_t::width; ++i) {
+                    bit[i] = u_t(1U << (i % 8));
+                    bits[i] = u_t(m >> (i - i % 8));
+                }
+                const vec_u b(bit);
+                return (vec_u(bits) & b) == b;
+            }
+        };
+    } // namespace impl
+
+    // lane i of the result is true when lane i of m is set, the inverse of mask(); the vector
+    // type is given explicitly, e.g. sd::from_mask<sd::vec8f>(m) is a sd::vec8b
+    template <typename Simd_t>
+    SIMDEE_INL const typename Simd_t::vec_b from_mask(typename Simd_t::mask_t m) {
+        return impl::mask_lanes<Simd_t>::apply(m.value);
+    }
+
+    // indices of the lanes set in m in increasing order, followed by zeros; the result can be
+    // used with sd::gather() to fetch the selected scalars
+    template <typename Simd_t>
+    SIMDEE_INL const typename Simd_t::vec_s lane_indices(typename Simd_t::mask_t m) {
+        using vec_s = typename Simd_t::vec_s;
+        using s_t = typename vec_s::scalar_t;
+        typename vec_s::storage_t iota;
+        for (std::size_t i = 0; i < Simd_t::width; ++i) { iota[i] = s_t(i); }
+        return compress(vec_s(iota), m);
+    }
+
+    namespace impl {
+        // calls fn(0), ..., fn(K - 1); once inlined, the indices are constants and an array of
+        // vectors indexed by them stays in registers, which a runtime loop doesn't guarantee
+        template <std::size_t K>
+        struct static_for {
+            template <typename Fn>
+            static SIMDEE_INL void apply(Fn& fn) {
+                static_for<K - 1>::apply(fn);
+                fn(K - 1);
+            }
+        };
+        template <>
+        struct static_for<0> {
+            template <typename Fn>
+            static SIMDEE_INL void apply(Fn&) {}
+        };
+
+        // lane i of channel C is scalar k = i * N + C of the interleaved data, found in lane k % W
+        // of the loaded vector S = k / W; the other lanes are left in place
+        template <std::size_t N, std::size_t W, std::size_t C, std::size_t S>
+        struct deinterleave_fn {
+            static constexpr bool takes(std::size_t i) { return (i * N + C) / W == S; }
+            static constexpr std::size_t at(std::size_t i) {
+                return takes(i) ? (i * N + C) % W : i;
+            }
+        };
+
+        // lane j of the stored vector S is scalar k = S * W + j, found in lane k / N of channel
+        // C = k % N; the other lanes are left in place
+        template <std::size_t N, std::size_t W, std::size_t S, std::size_t C>
+        struct interleave_fn {
+            static constexpr bool takes(std::size_t j) { return (S * W + j) % N == C; }
+            static constexpr std::size_t at(std::size_t j) {
+                return takes(j) ? (S * W + j) / N : j;
+            }
+        };
+
+        // the lanes for which Fn::takes() holds
+        template <typename Fn, typename Seq>
+        struct taken_lanes;
+        template <typename Fn, std::size_t... J>
+        struct taken_lanes<Fn, lanes<J...>> {
+            static constexpr std::uint64_t value = lane_bits(Fn::takes(J)...);
+        };
+
+        // output vector Out gathered from the inputs 0 to K, with one shuffle and blend for each
+        // input that contributes to it
+        template <typename Simd_t, template <std::size_t, std::size_t, std::size_t, std::size_t>
+                                   class Fn,
+                  std::size_t N, std::size_t Out, std::size_t K>
+        struct transpose_step {
+            using fn = Fn<N, Simd_t::width, Out, K>;
+            static constexpr std::uint64_t bits =
+                taken_lanes<fn, typename make_lanes<Simd_t::width>::type>::value;
+
+            SIMDEE_INL static const Simd_t apply(const Simd_t* in) {
+                const Simd_t rest = transpose_step<Simd_t, Fn, N, Out, K - 1>::apply(in);
+                const Simd_t x = shuffle(in[K], mapped_lanes<Simd_t, fn>{});
+                if (bits == 0) { return rest; }
+                if (bits == ~std::uint64_t(0) >> (64 - Simd_t::width)) { return x; }
+                return blend(rest, x, lane_mask<bits>{});
+            }
+        };
+        template <typename Simd_t, template <std::size_t, std::size_t, std::size_t, std::size_t>
+                                   class Fn,
+                  std::size_t N, std::size_t Out>
+        struct transpose_step<Simd_t, Fn, N, Out, 0> {
+            SIMDEE_INL static const Simd_t apply(const Simd_t* in) {
+                return shuffle(in[0], mapped_lanes<Simd_t, Fn<N, Simd_t::width, Out, 0>>{});
+            }
+        };
+
+        // N-channel interleaved data: N consecutive vectors of scalars x0 y0 z0 x1 y1 z1 ...,
+        // transposed to and from one vector per channel with shuffles and blends
+        template <std::size_t N, typename Simd_t>
+        struct blend_channels {
+            using scalar_t = typename Simd_t::scalar_t;
+
+            SIMDEE_INL static void load(const scalar_t* ptr, Simd_t* out) {
+                Simd_t in[N];
+                auto load_one = [&](std::size_t s) { in[s] = unaligned(ptr + s * Simd_t::width); };
+                static_for<N>::apply(load_one);
+                transpose(in, out, typename make_lanes<N>::type{});
+            }
+            SIMDEE_INL static void store(scalar_t* ptr, const Simd_t* in) {
+                Simd_t out[N];
+                interleave(in, out, typename make_lanes<N>::type{});
+                auto store_one = [&](std::size_t s) {
+                    unaligned(ptr + s * Simd_t::width) = out[s];
+                };
+                static_for<N>::apply(store_one);
+            }
+
+        private:
+            template <std::size_t... C>
+            SIMDEE_INL static void transpose(const Simd_t* in, Simd_t* out, lanes<C...>) {
+                const Simd_t res[] = {
+                    transpose_step<Simd_t, deinterleave_fn, N, C, N - 1>::apply(in)...};
+                auto copy = [&](std::size_t c) { out[c] = res[c]; };
+                static_for<N>::apply(copy);
+            }
+            template <std::size_t... S>
+            SIMDEE_INL static void interleave(const Simd_t* in, Simd_t* out, lanes<S...>) {
+                const Simd_t res[] = {
+                    transpose_step<Simd_t, interleave_fn, N, S, N - 1>::apply(in)...};
+                auto copy = [&](std::size_t s) { out[s] = res[s]; };
+                static_for<N>::apply(copy);
+            }
+        };
+
+        // the immediate of _mm_shuffle_ps() that takes lanes A, B of the first argument and
+        // lanes C, D of the second
+        constexpr int shuffle_imm(int a, int b, int c, int d) {
+            return a | (b << 2) | (c << 4) | (d << 6);
+        }
+
+        // transposition of N-channel data held in vectors of four 32-bit lanes, with a handful of
+        // two-source shuffles instead of one shuffle and blend per input; Ops::type is __m128, or
+        // __m256 when the two 128-bit halves hold independent groups of four records, and Ops
+        // provides unpacklo(), unpackhi() and shuffle<Imm>() with the semantics of the SSE
+        // instructions
+        template <std::size_t N, typename Ops>
+        struct shuffle_network;
+        template <typename Ops>
+        struct shuffle_network<2, Ops> {
+            using V = typename Ops::type;
+
+            // x0 y0 x1 y1 | x2 y2 x3 y3
+            SIMDEE_INL static void load(const V* in, V* out) {
+                out[0] = Ops::template shuffle<shuffle_imm(0, 2, 0, 2)>(in[0], in[1]);
+                out[1] = Ops::template shuffle<shuffle_imm(1, 3, 1, 3)>(in[0], in[1]);
+            }
+            SIMDEE_INL static void store(const V* in, V* out) {
+                out[0] = Ops::unpacklo(in[0], in[1]);
+                out[1] = Ops::unpackhi(in[0], in[1]);
+            }
+        };
+        template <typename Ops>
+        struct shuffle_network<3, Ops> {
+            using V = typename Ops::type;
+
+            // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            SIMDEE_INL static void load(const V* in, V* out) {
+                const V x23 = Ops::template shuffle<shuffle_imm(2, 3, 0, 1)>(in[1], in[2]);
+                const V y01 = Ops::template shuffle<shuffle_imm(1, 2, 0, 1)>(in[0], in[1]);
+                const V y23 = Ops::template shuffle<shuffle_imm(3, 3, 2, 2)>(in[1], in[2]);
+                const V z23 = Ops::template shuffle<shuffle_imm(0, 0, 3, 3)>(in[2], in[2]);
+                out[0] = Ops::template shuffle<shuffle_imm(0, 3, 0, 3)>(in[0], x23);
+                out[1] = Ops::template shuffle<shuffle_imm(0, 2, 0, 2)>(y01, y23);
+                out[2] = Ops::template shuffle<shuffle_imm(1, 3, 0, 2)>(y01, z23);
+            }
+            SIMDEE_INL static void store(const V* in, V* out) {
+                const V xy01 = Ops::unpacklo(in[0], in[1]);
+                const V zx01 = Ops::template shuffle<shuffle_imm(0, 0, 1, 1)>(in[2], in[0]);
+                const V yz11 = Ops::template shuffle<shuffle_imm(1, 1, 1, 1)>(in[1], in[2]);
+                const V xy22 = Ops::template shuffle<shuffle_imm(2, 2, 2, 2)>(in[0], in[1]);
+                const V zx23 = Ops::template shuffle<shuffle_imm(2, 2, 3, 3)>(in[2], in[0]);
+                const V yz33 = Ops::template shuffle<shuffle_imm(3, 3, 3, 3)>(in[1], in[2]);
+                out[0] = Ops::template shuffle<shuffle_imm(0, 1, 0, 2)>(xy01, zx01);
+                out[1] = Ops::template shuffle<shuffle_imm(0, 2, 0, 2)>(yz11, xy22);
+                out[2] = Ops::template shuffle<shuffle_imm(0, 2, 0, 2)>(zx23, yz33);
+            }
+        };
+        template <typename Ops>
+        struct shuffle_network<4, Ops> {
+            using V = typename Ops::type;
+
+            // a 4x4 transposition, which is its own inverse
+            SIMDEE_INL static void load(const V* in, V* out) {
+                const V t0 = Ops::unpacklo(in[0], in[1]);
+                const V t1 = Ops::unpacklo(in[2], in[3]);
+                const V t2 = Ops::unpackhi(in[0], in[1]);
+                const V t3 = Ops::unpackhi(in[2], in[3]);
+                out[0] = Ops::template shuffle<shuffle_imm(0, 1, 0, 1)>(t0, t1);
+                out[1] = Ops::template shuffle<shuffle_imm(2, 3, 2, 3)>(t0, t1);
+                out[2] = Ops::template shuffle<shuffle_imm(0, 1, 0, 1)>(t2, t3);
+                out[3] = Ops::template shuffle<shuffle_imm(2, 3, 2, 3)>(t2, t3);
+            }
+            SIMDEE_INL static void store(const V* in, V* out) { load(in, out); }
+        };
+
+        // the backends specialize channels<> for the vectors with a faster transposition
+        template <std::size_t N, typename Simd_t>
+        struct channels : blend_channels<N, Simd_t> {};
+
+        template <typename Simd_t>
+        SIMDEE_INL void assign_channels(const Simd_t*) {}
+        template <typename Simd_t, typename... Rest>
+        SIMDEE_INL void assign_channels(const Simd_t* res, Simd_t& v, Rest&... vs) {
+            v = res[0];
+            assign_channels(res + 1, vs...);
+        }
+
+    } // namespace impl
+
+    // reads N * width scalars of interleaved N-channel data, such as xyz points or RGBA pixels,
+    // and puts channel c into the c-th vector, e.g. sd::load_deinterleave<3>(ptr, x, y, z) loads
+    // the x, y and z coordinates of width points; each scalar is read once, unlike with
+    // sd::interleaved(ptr, step), and the transposition happens in registers
+    template <std::size_t N, typename Simd_t, typename... Rest>
+    SIMDEE_INL void load_deinterleave(const typename Simd_t::scalar_t* ptr, simd_base<Simd_t>& v0,
+                                      Rest&... vs) {
+        static_assert(sizeof...(Rest) + 1 == N, "load_deinterleave(): expected N vectors");
+        Simd_t res[N];
+        impl::channels<N, Simd_t>::load(ptr, res);
+        impl::assign_channels(res, v0.self(), vs...);
+    }
+
+    // the inverse of load_deinterleave(): writes N * width scalars, lane i of the c-th vector
+    // going to ptr[i * N + c]
+    template <std::size_t N, typename Simd_t, typename... Rest>
+    SIMDEE_INL void store_interleave(typename Simd_t::scalar_t* ptr, const simd_base<Simd_t>& v0,
+                                     const Rest&... vs) {
+        static_assert(sizeof...(Rest) + 1 == N, "store_interleave(): expected N vectors");
+        const Simd_t in[] = {v0.self(), static_cast<const Simd_t&>(vs)...};
+        impl::channels<N, Simd_t>::store(ptr, in);
+    }
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_SIMD_TYPES_COMMON_HPP
@@ -8,6 +8,7 @@
 #include <utility>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     namespace impl {
         template <typename T>
         struct pair {
@@ -18,7 +19,25 @@ namespace sd {
         };
 
         template <typename Mask_t>
-        using dual_mask_t = impl::mask<((Mask_t::all_bits + 1) * (Mask_t::all_bits + 1)) - 1>;
+        using dual_mask_t =
+            impl::mask<((uint64_t(Mask_t::all_bits) + 1) * (uint64_t(Mask_t::all_bits) + 1)) - 1>;
+
+        // the lanes of the right half follow those of the left half
+        template <typename Mask_t, typename Half_t>
+        SIMDEE_INL Mask_t join_masks(Half_t l, Half_t r, std::size_t w) {
+            const typename Mask_t::bits_t hi = r.value;
+            return Mask_t(l.value | (hi << w));
+        }
+
+        // the left and the right half of a mask
+        template <typename Half_t, typename Mask_t>
+        SIMDEE_INL Half_t mask_lo(Mask_t m) {
+            return Half_t(typename Half_t::bits_t(m.value & Half_t::all_bits));
+        }
+        template <typename Half_t, typename Mask_t>
+        SIMDEE_INL Half_t mask_hi(Mask_t m, std::size_t w) {
+            return Half_t(typename Half_t::bits_t(m.value >> w));
+        }
     }
 
     template <typename T, typename Enable = void>
@@ -27,6 +46,92 @@ namespace sd {
     template <typename T>
     struct is_simd_vector<dual<T>> : std::integral_constant<bool, true> {};
 
+    namespace impl {
+        template <typename T>
+        struct refine_steps<dual<T>> : refine_steps<T> {};
+
+        // both halves are scanned on their own, and the last lane of the left half is carried
+        // into the right half
+        template <typename T>
+        struct scan<dual<T>> {
+            template <typename Op_t>
+            SIMDEE_INL static const dual<T> inclusive(const dual<T>& x, Op_t f) {
+                typename dual<T>::vector_t res;
+                res.l = scan<T>::inclusive(x.data().l, f);
+                res.r = f(broadcast_lane<T::width - 1>(res.l), scan<T>::inclusive(x.data().r, f));
+                return res;
+            }
+        };
+
+        // the halves are stored and loaded one after the other
+        template <typename T>
+        struct compaction<dual<T>> {
+            using scalar_t = typename dual<T>::scalar_t;
+            using mask_t = typename dual<T>::mask_t;
+            using half_mask_t = typename T::mask_t;
+
+            SIMDEE_INL static std::size_t store(scalar_t* ptr, const dual<T>& x, mask_t m) {
+                const half_mask_t lo = mask_lo<half_mask_t>(m);
+                const half_mask_t hi = mask_hi<half_mask_t>(m, T::width);
+                const std::size_t n = compaction<T>::store(ptr, x.data().l, lo);
+                return n + compaction<T>::store(ptr + n, x.data().r, hi);
+            }
+            SIMDEE_INL static const dual<T> load(const scalar_t* ptr, mask_t m) {
+                const half_mask_t lo = mask_lo<half_mask_t>(m);
+                typename dual<T>::vector_t res;
+                res.l = compaction<T>::load(ptr, lo);
+                res.r = compaction<T>::load(ptr + popcount(lo), mask_hi<half_mask_t>(m, T::width));
+                return res;
+            }
+        };
+
+        // the records of the left halves come first, followed by those of the right halves
+        template <std::size_t N, typename T>
+        struct channels<N, dual<T>> {
+            using scalar_t = typename dual<T>::scalar_t;
+
+            SIMDEE_INL static void load(const scalar_t* ptr, dual<T>* out) {
+                T l[N], r[N];
+                channels<N, T>::load(ptr, l);
+                channels<N, T>::load(ptr + N * T::width, r);
+                auto join = [&](std::size_t c) {
+                    typename dual<T>::vector_t res;
+                    res.l = l[c];
+                    res.r = r[c];
+                    out[c] = res;
+                };
+                static_for<N>::apply(join);
+            }
+            SIMDEE_INL static void store(scalar_t* ptr, const dual<T>* in) {
+                T l[N], r[N];
+                auto split = [&](std::size_t c) {
+                    l[c] = in[c].data().l;
+                    r[c] = in[c].data().r;
+                };
+                static_for<N>::apply(split);
+                channels<N, T>::store(ptr, l);
+                channels<N, T>::store(ptr + N * T::width, r);
+            }
+        };
+
+        // lanes Offset to Offset + W - 1 of a shuffle of dual<T>, where T has W lanes: the same
+        // shuffle of both halves of the source, blended
+        template <std::size_t W, std::size_t Offset, typename J, std::size_t... I>
+        struct dual_half;
+        template <std::size_t W, std::size_t Offset, std::size_t... J, std::size_t... I>
+        struct dual_half<W, Offset, lanes<J...>, I...> {
+            using idx = lanes<(lane_at(Offset + J, I...) % W)...>;
+            static constexpr std::uint64_t from_r = lane_bits((lane_at(Offset + J, I...) >= W)...);
+
+            template <typename T>
+            SIMDEE_INL static const T apply(const T& l, const T& r) {
+                if (from_r == 0) { return shuffle(l, idx{}); }
+                if (from_r == (std::uint64_t(1) << W) - 1) { return shuffle(r, idx{}); }
+                return blend(shuffle(l, idx{}), shuffle(r, idx{}), lane_mask<from_r>{});
+            }
+        };
+    } // namespace impl
+
     template <typename T>
     struct simd_vector_traits<dual<T>> {
         using simd_t = dual<T>;
@@ -89,6 +194,53 @@ namespace sd {
         }
     };
 
+    template <typename Crtp>
+    struct dual_base_base<Crtp, 16> : simd_base<Crtp> {
+    protected:
+        using T = typename simd_base<Crtp>::vector_t::l_t;
+        using simd_base<Crtp>::mm;
+
+    public:
+        using scalar_t = typename simd_base<Crtp>::scalar_t;
+        SIMDEE_TRIVIAL_TYPE(dual_base_base)
+        SIMDEE_INL dual_base_base(scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3, scalar_t v4,
+                                  scalar_t v5, scalar_t v6, scalar_t v7, scalar_t v8, scalar_t v9,
+                                  scalar_t v10, scalar_t v11, scalar_t v12, scalar_t v13,
+                                  scalar_t v14, scalar_t v15) {
+            mm.l = T(v0, v1, v2, v3, v4, v5, v6, v7);
+            mm.r = T(v8, v9, v10, v11, v12, v13, v14, v15);
+        }
+    };
+
+    template <typename Crtp>
+    struct dual_base_base<Crtp, 32> : simd_base<Crtp> {
+    protected:
+        using T = typename simd_base<Crtp>::vector_t::l_t;
+        using simd_base<Crtp>::mm;
+
+    public:
+        using scalar_t = typename simd_base<Crtp>::scalar_t;
+        SIMDEE_TRIVIAL_TYPE(dual_base_base)
+        SIMDEE_INL dual_base_base(scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3, scalar_t v4,
+                                  scalar_t v5, scalar_t v6, scalar_t v7, scalar_t v8, scalar_t v9,
+                                  scalar_t v10, scalar_t v11, scalar_t v12, scalar_t v13,
+                                  scalar_t v14, scalar_t v15, scalar_t v16, scalar_t v17,
+                                  scalar_t v18, scalar_t v19, scalar_t v20, scalar_t v21,
+                                  scalar_t v22, scalar_t v23, scalar_t v24, scalar_t v25,
+                                  scalar_t v26, scalar_t v27, scalar_t v28, scalar_t v29,
+                                  scalar_t v30, scalar_t v31) {
+            mm.l = T(v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15);
+            mm.r = T(v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30,
+                     v31);
+        }
+    };
+
+    // 64 lanes, which only come from a pair of 32-lane vectors, have no per-lane constructor
+    template <typename Crtp>
+    struct dual_base_base<Crtp, 64> : simd_base<Crtp> {
+        SIMDEE_TRIVIAL_TYPE(dual_base_base)
+    };
+
     template <typename Crtp>
     struct dual_base : dual_base_base<Crtp, simd_base<Crtp>::width> {
     protected:
@@ -99,6 +251,8 @@ namespace sd {
         using vector_t = typename simd_base<Crtp>::vector_t;
         using scalar_t = typename simd_base<Crtp>::scalar_t;
         using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
         using simd_base<Crtp>::width;
         using simd_base<Crtp>::self;
         using dual_base_base<Crtp, width>::dual_base_base;
@@ -113,6 +267,26 @@ namespace sd {
         SIMDEE_BASE_CTOR_TPL(dual_base, expr::init<T>, mm.l = r; mm.r = r)
         SIMDEE_BASE_CTOR(dual_base, storage_t, aligned_load(r.data()))
 
+        template <typename U, typename Init>
+        SIMDEE_INL dual_base(const expr::partial<U, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename U, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<U, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename U>
+        SIMDEE_INL dual_base(const expr::indexed<U, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename U>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<U, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
         SIMDEE_INL void aligned_load(const scalar_t* r) {
             mm.l.aligned_load(r);
             mm.r.aligned_load(r + T::width);
@@ -133,14 +307,48 @@ namespace sd {
             mm.r.unaligned_store(r + T::width);
         }
 
+        SIMDEE_INL void streaming_store(scalar_t* r) const {
+            mm.l.streaming_store(r);
+            mm.r.streaming_store(r + T::width);
+        }
+
         SIMDEE_INL void interleaved_load(const scalar_t* r, int step) {
             mm.l.interleaved_load(r, step);
-            mm.r.interleaved_load(r + (T::width * (127 & step)), step);
+            mm.r.interleaved_load(r + std::ptrdiff_t(T::width) * step, step);
         }
 
         SIMDEE_INL void interleaved_store(scalar_t* r, int step) const {
             mm.l.interleaved_store(r, step);
-            mm.r.interleaved_store(r + (T::width * (127 & step)), step);
+            mm.r.interleaved_store(r + std::ptrdiff_t(T::width) * step, step);
+        }
+
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            if (count <= T::width) {
+                mm.l.partial_load(r, count, fill.data().l);
+                mm.r = fill.data().r;
+            } else {
+                mm.l.unaligned_load(r);
+                mm.r.partial_load(r + T::width, count - T::width, fill.data().r);
+            }
+        }
+
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count) const {
+            if (count <= T::width) {
+                mm.l.partial_store(r, count);
+            } else {
+                mm.l.unaligned_store(r);
+                mm.r.partial_store(r + T::width, count - T::width);
+            }
+        }
+
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx) {
+            mm.l.gather_load(base, idx.data().l);
+            mm.r.gather_load(base, idx.data().r);
+        }
+
+        SIMDEE_INL void scatter_store(scalar_t* base, const vec_s& idx) const {
+            mm.l.scatter_store(base, idx.data().l);
+            mm.r.scatter_store(base, idx.data().r);
         }
 
         template <typename Op_t>
@@ -153,6 +361,66 @@ namespace sd {
             return res;
         }
 
+        // the halves of each row are reduced first, which leaves two sets of rows of T
+        template <typename Op_t>
+        friend const Crtp reduce_rows(const Crtp* rows, Op_t f) {
+            T halves[width];
+            for (std::size_t i = 0; i < width; ++i) {
+                halves[i] = f(rows[i].data().l, rows[i].data().r);
+            }
+            vector_t res;
+            res.l = reduce_rows(halves, f);
+            res.r = reduce_rows(halves + T::width, f);
+            return res;
+        }
+
+        // each half of the result is a blend of shuffles of both halves of the source
+        template <std::size_t... I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I...>) {
+            using half_lanes = typename impl::make_lanes<T::width>::type;
+            using lo = impl::dual_half<T::width, 0, half_lanes, I...>;
+            using hi = impl::dual_half<T::width, T::width, half_lanes, I...>;
+            vector_t res;
+            res.l = lo::apply(l.data().l, l.data().r);
+            res.r = hi::apply(l.data().l, l.data().r);
+            return res;
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask>) {
+            vector_t res;
+            constexpr std::uint64_t low = (std::uint64_t(1) << T::width) - 1;
+            res.l = blend(a.data().l, b.data().l, impl::lane_mask<Mask & low>{});
+            res.r = blend(a.data().r, b.data().r, impl::lane_mask<(Mask >> T::width)>{});
+            return res;
+        }
+
+        // the first and the second half of a0, b0, a1, b1, ...
+        friend SIMDEE_INL const Crtp interleave_lo(const Crtp& a, const Crtp& b) {
+            vector_t res;
+            res.l = interleave_lo(a.data().l, b.data().l);
+            res.r = interleave_hi(a.data().l, b.data().l);
+            return res;
+        }
+        friend SIMDEE_INL const Crtp interleave_hi(const Crtp& a, const Crtp& b) {
+            vector_t res;
+            res.l = interleave_lo(a.data().r, b.data().r);
+            res.r = interleave_hi(a.data().r, b.data().r);
+            return res;
+        }
+
+        // through memory, as the halves of the result depend on the number of lanes selected in
+        // the left half; see compaction<dual<T>> for the stores and loads, which don't need this
+        friend const Crtp compress(const Crtp& l, mask_t m) {
+            const Crtp zeros(zero());
+            storage_t res(zeros);
+            compress_store(res.data(), l, m);
+            return Crtp(res);
+        }
+        friend const Crtp expand(const Crtp& l, mask_t m) {
+            const storage_t src(l);
+            return expand_load<Crtp>(src.data(), m);
+        }
+
         SIMDEE_UNOP(dual_base, scalar_t, first_scalar, first_scalar(l.mm.l))
     };
 
@@ -174,7 +442,7 @@ namespace sd {
         SIMDEE_TRIVIAL_TYPE(dual)
 
         SIMDEE_UNOP(dual, mask_t, mask,
-                    mask_t(mask(l.mm.l).value | (mask(l.mm.r).value << T::width)))
+                    impl::join_masks<mask_t>(mask(l.mm.l), mask(l.mm.r), T::width))
 
         SIMDEE_BINOP(vec_b, vec_b, operator==, (vector_t{l.mm.l == r.mm.l, l.mm.r == r.mm.r}))
         SIMDEE_BINOP(vec_b, vec_b, operator!=, (vector_t{l.mm.l != r.mm.l, l.mm.r != r.mm.r}))
@@ -213,6 +481,11 @@ namespace sd {
             mm.r = decltype(mm.r)(r.data().r);
         }
 
+        SIMDEE_INL explicit dual(const vec_u& r) {
+            mm.l = decltype(mm.l)(r.data().l);
+            mm.r = decltype(mm.r)(r.data().r);
+        }
+
         SIMDEE_BINOP(vec_f, vec_b, operator<, (b_vector_t{l.mm.l < r.mm.l, l.mm.r < r.mm.r}))
         SIMDEE_BINOP(vec_f, vec_b, operator>, (b_vector_t{l.mm.l > r.mm.l, l.mm.r > r.mm.r}))
         SIMDEE_BINOP(vec_f, vec_b, operator<=, (b_vector_t{l.mm.l <= r.mm.l, l.mm.r <= r.mm.r}))
@@ -230,6 +503,18 @@ namespace sd {
         SIMDEE_UNOP(vec_f, vec_f, rsqrt, (vector_t{rsqrt(l.mm.l), rsqrt(l.mm.r)}))
         SIMDEE_UNOP(vec_f, vec_f, rcp, (vector_t{rcp(l.mm.l), rcp(l.mm.r)}))
         SIMDEE_UNOP(vec_f, vec_f, abs, (vector_t{abs(l.mm.l), abs(l.mm.r)}))
+        SIMDEE_UNOP(vec_f, vec_f, floor, (vector_t{floor(l.mm.l), floor(l.mm.r)}))
+        SIMDEE_UNOP(vec_f, vec_f, ceil, (vector_t{ceil(l.mm.l), ceil(l.mm.r)}))
+        SIMDEE_UNOP(vec_f, vec_f, trunc, (vector_t{trunc(l.mm.l), trunc(l.mm.r)}))
+        SIMDEE_UNOP(vec_f, vec_f, round, (vector_t{round(l.mm.l), round(l.mm.r)}))
+        SIMDEE_UNOP(vec_f, vec_s, to_int_round,
+                    (typename vec_s::vector_t{to_int_round(l.mm.l), to_int_round(l.mm.r)}))
+        SIMDEE_TRIOP(vec_f, vec_f, fma,
+                     (vector_t{fma(l.mm.l, m.mm.l, r.mm.l), fma(l.mm.r, m.mm.r, r.mm.r)}))
+        SIMDEE_TRIOP(vec_f, vec_f, fms,
+                     (vector_t{fms(l.mm.l, m.mm.l, r.mm.l), fms(l.mm.r, m.mm.r, r.mm.r)}))
+        SIMDEE_TRIOP(vec_f, vec_f, fnma,
+                     (vector_t{fnma(l.mm.l, m.mm.l, r.mm.l), fnma(l.mm.r, m.mm.r, r.mm.r)}))
 
         SIMDEE_INL friend const vec_f cond(const vec_b& pred, const vec_f& if_true,
                                            const vec_f& if_false) {
@@ -267,6 +552,11 @@ namespace sd {
             mm.r = decltype(mm.r)(r.data().r);
         }
 
+        SIMDEE_INL explicit dual(const vec_f& r) {
+            mm.l = decltype(mm.l)(r.data().l);
+            mm.r = decltype(mm.r)(r.data().r);
+        }
+
 #if SIMDEE_NEED_INT
         SIMDEE_BINOP(vec_u, vec_b, operator<, (b_vector_t{l.mm.l < r.mm.l, l.mm.r < r.mm.r}))
         SIMDEE_BINOP(vec_u, vec_b, operator>, (b_vector_t{l.mm.l > r.mm.l, l.mm.r > r.mm.r}))
@@ -282,8 +572,18 @@ namespace sd {
         SIMDEE_BINOP(vec_u, vec_u, operator+, (vector_t{l.mm.l + r.mm.l, l.mm.r + r.mm.r}))
         SIMDEE_BINOP(vec_u, vec_u, operator-, (vector_t{l.mm.l - r.mm.l, l.mm.r - r.mm.r}))
         SIMDEE_BINOP(vec_u, vec_u, operator*, (vector_t{l.mm.l * r.mm.l, l.mm.r* r.mm.r}))
+        SIMDEE_SHIFTOP(vec_u, operator<<, (vector_t{l.mm.l << r, l.mm.r << r}))
+        SIMDEE_SHIFTOP(vec_u, operator>>, (vector_t{l.mm.l >> r, l.mm.r >> r}))
+        SIMDEE_BINOP(vec_u, vec_u, operator<<, (vector_t{l.mm.l << r.mm.l, l.mm.r << r.mm.r}))
+        SIMDEE_BINOP(vec_u, vec_u, operator>>, (vector_t{l.mm.l >> r.mm.l, l.mm.r >> r.mm.r}))
         SIMDEE_BINOP(vec_u, vec_u, min, (vector_t{min(l.mm.l, r.mm.l), min(l.mm.r, r.mm.r)}))
         SIMDEE_BINOP(vec_u, vec_u, max, (vector_t{max(l.mm.l, r.mm.l), max(l.mm.r, r.mm.r)}))
+
+        SIMDEE_BINOP(vec_u, vec_u, add_sat,
+                     (vector_t{add_sat(l.mm.l, r.mm.l), add_sat(l.mm.r, r.mm.r)}))
+        SIMDEE_BINOP(vec_u, vec_u, sub_sat,
+                     (vector_t{sub_sat(l.mm.l, r.mm.l), sub_sat(l.mm.r, r.mm.r)}))
+        SIMDEE_BINOP(vec_u, vec_u, avg, (vector_t{avg(l.mm.l, r.mm.l), avg(l.mm.r, r.mm.r)}))
 #endif
 
         SIMDEE_INL friend const vec_u cond(const vec_b& pred, const vec_u& if_true,
@@ -339,10 +639,20 @@ namespace sd {
         SIMDEE_BINOP(vec_s, vec_s, operator+, (vector_t{l.mm.l + r.mm.l, l.mm.r + r.mm.r}))
         SIMDEE_BINOP(vec_s, vec_s, operator-, (vector_t{l.mm.l - r.mm.l, l.mm.r - r.mm.r}))
         SIMDEE_BINOP(vec_s, vec_s, operator*, (vector_t{l.mm.l * r.mm.l, l.mm.r* r.mm.r}))
+        SIMDEE_SHIFTOP(vec_s, operator<<, (vector_t{l.mm.l << r, l.mm.r << r}))
+        SIMDEE_SHIFTOP(vec_s, operator>>, (vector_t{l.mm.l >> r, l.mm.r >> r}))
+        SIMDEE_BINOP(vec_s, vec_s, operator<<, (vector_t{l.mm.l << r.mm.l, l.mm.r << r.mm.r}))
+        SIMDEE_BINOP(vec_s, vec_s, operator>>, (vector_t{l.mm.l >> r.mm.l, l.mm.r >> r.mm.r}))
 
         SIMDEE_BINOP(vec_s, vec_s, min, (vector_t{min(l.mm.l, r.mm.l), min(l.mm.r, r.mm.r)}))
         SIMDEE_BINOP(vec_s, vec_s, max, (vector_t{max(l.mm.l, r.mm.l), max(l.mm.r, r.mm.r)}))
         SIMDEE_UNOP(vec_s, vec_s, abs, (vector_t{abs(l.mm.l), abs(l.mm.r)}))
+
+        SIMDEE_BINOP(vec_s, vec_s, add_sat,
+                     (vector_t{add_sat(l.mm.l, r.mm.l), add_sat(l.mm.r, r.mm.r)}))
+        SIMDEE_BINOP(vec_s, vec_s, sub_sat,
+                     (vector_t{sub_sat(l.mm.l, r.mm.l), sub_sat(l.mm.r, r.mm.r)}))
+        SIMDEE_BINOP(vec_s, vec_s, avg, (vector_t{avg(l.mm.l, r.mm.l), avg(l.mm.r, r.mm.r)}))
 #endif
 
         SIMDEE_INL friend const vec_s cond(const vec_b& pred, const vec_s& if_true,
@@ -353,6 +663,56 @@ namespace sd {
             };
         }
     };
+
+#if SIMDEE_NEED_INT
+    namespace impl {
+        template <typename T>
+        using widen_one_t = typename std::decay<decltype(widen(std::declval<T>()))>::type;
+        template <typename T>
+        using narrow_one_t = typename std::decay<decltype(narrow(std::declval<T>()))>::type;
+        template <typename T>
+        using widen_half_t = typename std::decay<decltype(widen_lo(std::declval<T>()))>::type;
+        template <typename T>
+        using narrow_pair_t =
+            typename std::decay<decltype(narrow(std::declval<T>(), std::declval<T>()))>::type;
+    }
+
+    // each half of a vector of single scalars widens to a single scalar
+    template <typename T, typename std::enable_if<T::width == 1>::type* = nullptr>
+    SIMDEE_INL const impl::widen_one_t<T> widen_lo(const dual<T>& l) {
+        return widen(l.data().l);
+    }
+
+    template <typename T, typename std::enable_if<T::width == 1>::type* = nullptr>
+    SIMDEE_INL const impl::widen_one_t<T> widen_hi(const dual<T>& l) {
+        return widen(l.data().r);
+    }
+
+    template <typename T, typename std::enable_if<(T::width > 1)>::type* = nullptr>
+    SIMDEE_INL const dual<impl::widen_half_t<T>> widen_lo(const dual<T>& l) {
+        return impl::pair<impl::widen_half_t<T>>{widen_lo(l.data().l), widen_hi(l.data().l)};
+    }
+
+    template <typename T, typename std::enable_if<(T::width > 1)>::type* = nullptr>
+    SIMDEE_INL const dual<impl::widen_half_t<T>> widen_hi(const dual<T>& l) {
+        return impl::pair<impl::widen_half_t<T>>{widen_lo(l.data().r), widen_hi(l.data().r)};
+    }
+
+    template <typename T, typename std::enable_if<T::width == 1>::type* = nullptr>
+    SIMDEE_INL const dual<dual<impl::narrow_one_t<T>>> narrow(const dual<T>& lo,
+                                                              const dual<T>& hi) {
+        using N = impl::narrow_one_t<T>;
+        return impl::pair<dual<N>>{impl::pair<N>{narrow(lo.data().l), narrow(lo.data().r)},
+                                   impl::pair<N>{narrow(hi.data().l), narrow(hi.data().r)}};
+    }
+
+    template <typename T, typename std::enable_if<(T::width > 1)>::type* = nullptr>
+    SIMDEE_INL const dual<impl::narrow_pair_t<T>> narrow(const dual<T>& lo, const dual<T>& hi) {
+        using N = impl::narrow_pair_t<T>;
+        return impl::pair<N>{narrow(lo.data().l, lo.data().r), narrow(hi.data().l, hi.data().r)};
+    }
+#endif
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_SIMD_TYPES_DUAL_HPP
@@ -7,12 +7,24 @@
 #include "common.hpp"
 
 #include <cmath>
+#include <limits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     struct dumb;
     struct dumf;
     struct dumu;
     struct dums;
+    struct dumb64;
+    struct dumd;
+    struct dumu64;
+    struct dums64;
+    struct dumb8;
+    struct dumu8;
+    struct dums8;
+    struct dumb16;
+    struct dumu16;
+    struct dums16;
 
     template <>
     struct is_simd_vector<dumb> : std::integral_constant<bool, true> {};
@@ -22,6 +34,26 @@ namespace sd {
     struct is_simd_vector<dumu> : std::integral_constant<bool, true> {};
     template <>
     struct is_simd_vector<dums> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumb64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumd> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumu64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dums64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumb8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumu8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dums8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumb16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dumu16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<dums16> : std::integral_constant<bool, true> {};
 
     template <typename Simd_t, typename Vector_t>
     struct dum_traits {
@@ -45,6 +77,91 @@ namespace sd {
     template <>
     struct simd_vector_traits<dums> : dum_traits<dums, int32_t> {};
 
+    template <typename Simd_t, typename Vector_t>
+    struct dum64_traits {
+        using simd_t = Simd_t;
+        using vector_t = Vector_t;
+        using scalar_t = Vector_t;
+        using vec_b = dumb64;
+        using vec_f = dumd;
+        using vec_u = dumu64;
+        using vec_s = dums64;
+        using mask_t = impl::mask<1U>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<dumb64> : dum64_traits<dumb64, bool64_t> {};
+    template <>
+    struct simd_vector_traits<dumd> : dum64_traits<dumd, double> {};
+    template <>
+    struct simd_vector_traits<dumu64> : dum64_traits<dumu64, uint64_t> {};
+    template <>
+    struct simd_vector_traits<dums64> : dum64_traits<dums64, int64_t> {};
+
+    template <typename Simd_t, typename Vector_t>
+    struct dum8_traits {
+        using simd_t = Simd_t;
+        using vector_t = Vector_t;
+        using scalar_t = Vector_t;
+        using vec_b = dumb8;
+        using vec_f = void;
+        using vec_u = dumu8;
+        using vec_s = dums8;
+        using mask_t = impl::mask<1U>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<dumb8> : dum8_traits<dumb8, bool8_t> {};
+    template <>
+    struct simd_vector_traits<dumu8> : dum8_traits<dumu8, uint8_t> {};
+    template <>
+    struct simd_vector_traits<dums8> : dum8_traits<dums8, int8_t> {};
+
+    template <typename Simd_t, typename Vector_t>
+    struct dum16_traits {
+        using simd_t = Simd_t;
+        using vector_t = Vector_t;
+        using scalar_t = Vector_t;
+        using vec_b = dumb16;
+        using vec_f = void;
+        using vec_u = dumu16;
+        using vec_s = dums16;
+        using mask_t = impl::mask<1U>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<dumb16> : dum16_traits<dumb16, bool16_t> {};
+    template <>
+    struct simd_vector_traits<dumu16> : dum16_traits<dumu16, uint16_t> {};
+    template <>
+    struct simd_vector_traits<dums16> : dum16_traits<dums16, int16_t> {};
+
+    namespace impl {
+        template <typename T>
+        SIMDEE_INL T dum_saturate(int32_t r) {
+            return T(std::min<int32_t>(std::max<int32_t>(r, std::numeric_limits<T>::min()),
+                                       std::numeric_limits<T>::max()));
+        }
+
+        // shifts with the results of the vector instructions for counts of at least the width,
+        // where the built-in operators would be undefined; the count is unsigned, as in the
+        // vector instructions, so that negative counts are out of range as well
+        template <typename T>
+        SIMDEE_INL T dum_shl(T l, unsigned r) {
+            using U = typename std::make_unsigned<T>::type;
+            return (r < sizeof(T) * 8) ? T(U(l) << r) : T(0);
+        }
+        template <typename T>
+        SIMDEE_INL T dum_shr(T l, unsigned r) {
+            const unsigned bits = unsigned(sizeof(T) * 8);
+            if (std::is_signed<T>::value) { return T(l >> (r < bits ? r : bits - 1)); }
+            return (r < bits) ? T(l >> r) : T(0);
+        }
+    }
+
     template <typename Crtp>
     struct dum_base : simd_base<Crtp> {
     protected:
@@ -54,6 +171,8 @@ namespace sd {
         using vector_t = typename simd_base<Crtp>::vector_t;
         using scalar_t = typename simd_base<Crtp>::scalar_t;
         using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
         using simd_base<Crtp>::width;
         using simd_base<Crtp>::self;
 
@@ -65,17 +184,73 @@ namespace sd {
         SIMDEE_BASE_CTOR_TPL(dum_base, expr::init<T>, *this = r.template to<scalar_t>())
         SIMDEE_BASE_CTOR(dum_base, storage_t, aligned_load(r.data()))
 
+        template <typename T, typename Init>
+        SIMDEE_INL dum_base(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename T, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename T>
+        SIMDEE_INL dum_base(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename T>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
         SIMDEE_INL void aligned_load(const scalar_t* r) { mm = *r; }
         SIMDEE_INL void aligned_store(scalar_t* r) const { *r = mm; }
         SIMDEE_INL void unaligned_load(const scalar_t* r) { mm = *r; }
         SIMDEE_INL void unaligned_store(scalar_t* r) const { *r = mm; }
+        SIMDEE_INL void streaming_store(scalar_t* r) const { *r = mm; }
         SIMDEE_INL void interleaved_load(const scalar_t* r, int) { mm = *r; }
         SIMDEE_INL void interleaved_store(scalar_t* r, int) const { *r = mm; }
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            mm = (count != 0) ? *r : fill.data();
+        }
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count) const {
+            if (count != 0) { *r = mm; }
+        }
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx) {
+            mm = base[idx.data()];
+        }
+        SIMDEE_INL void scatter_store(scalar_t* base, const vec_s& idx) const {
+            base[idx.data()] = mm;
+        }
 
         template <typename Op_t>
         friend SIMDEE_INL const Crtp reduce(const Crtp& l, Op_t) {
             return l;
         }
+
+        template <typename Op_t>
+        friend SIMDEE_INL const Crtp reduce_rows(const Crtp* rows, Op_t) {
+            return rows[0];
+        }
+
+        template <std::size_t I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I>) {
+            return l;
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask>) {
+            return (Mask & 1) ? b : a;
+        }
+        friend SIMDEE_INL const Crtp interleave_lo(const Crtp& a, const Crtp&) { return a; }
+        friend SIMDEE_INL const Crtp interleave_hi(const Crtp&, const Crtp& b) { return b; }
+
+        friend SIMDEE_INL const Crtp compress(const Crtp& l, mask_t m) {
+            return m.value ? l : Crtp(zero());
+        }
+        friend SIMDEE_INL const Crtp expand(const Crtp& l, mask_t m) {
+            return m.value ? l : Crtp(zero());
+        }
     };
 
     struct dumb : dum_base<dumb> {
@@ -97,6 +272,7 @@ namespace sd {
 
         using dum_base::dum_base;
         SIMDEE_INL explicit dumf(const dums&);
+        SIMDEE_INL explicit dumf(const dumu&);
 
         SIMDEE_UNOP(dumf, scalar_t, first_scalar, l.mm)
         SIMDEE_BINOP(dumf, dumb, operator<, dumb::scalar_t(l.mm < r.mm))
@@ -118,6 +294,20 @@ namespace sd {
         SIMDEE_UNOP(dumf, dumf, rsqrt, 1 / std::sqrt(l.mm))
         SIMDEE_UNOP(dumf, dumf, rcp, 1 / l.mm)
         SIMDEE_UNOP(dumf, dumf, abs, std::abs(l.mm))
+        SIMDEE_UNOP(dumf, dumf, floor, std::floor(l.mm))
+        SIMDEE_UNOP(dumf, dumf, ceil, std::ceil(l.mm))
+        SIMDEE_UNOP(dumf, dumf, trunc, std::trunc(l.mm))
+        SIMDEE_UNOP(dumf, dumf, round, std::round(l.mm))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(dumf, dumf, fma, std::fma(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(dumf, dumf, fms, std::fma(l.mm, m.mm, -r.mm))
+        SIMDEE_TRIOP(dumf, dumf, fnma, std::fma(-l.mm, m.mm, r.mm))
+#else
+        SIMDEE_TRIOP(dumf, dumf, fma, l.mm * m.mm + r.mm)
+        SIMDEE_TRIOP(dumf, dumf, fms, l.mm * m.mm - r.mm)
+        SIMDEE_TRIOP(dumf, dumf, fnma, r.mm - l.mm * m.mm)
+#endif
     };
 
     struct dumu : dum_base<dumu> {
@@ -126,6 +316,7 @@ namespace sd {
         using dum_base::dum_base;
         SIMDEE_INL explicit dumu(const dumb&);
         SIMDEE_INL explicit dumu(const dums&);
+        SIMDEE_INL explicit dumu(const dumf&);
 
         SIMDEE_UNOP(dumu, scalar_t, first_scalar, l.mm)
 
@@ -144,6 +335,10 @@ namespace sd {
         SIMDEE_BINOP(dumu, dumu, operator+, l.mm + r.mm)
         SIMDEE_BINOP(dumu, dumu, operator-, l.mm - r.mm)
         SIMDEE_BINOP(dumu, dumu, operator*, l.mm * r.mm)
+        SIMDEE_SHIFTOP(dumu, operator<<, impl::dum_shl(l.mm, unsigned(r)))
+        SIMDEE_SHIFTOP(dumu, operator>>, impl::dum_shr(l.mm, unsigned(r)))
+        SIMDEE_BINOP(dumu, dumu, operator<<, impl::dum_shl(l.mm, r.mm))
+        SIMDEE_BINOP(dumu, dumu, operator>>, impl::dum_shr(l.mm, r.mm))
         SIMDEE_BINOP(dumu, dumu, min, std::min(l.mm, r.mm))
         SIMDEE_BINOP(dumu, dumu, max, std::max(l.mm, r.mm))
 #endif
@@ -176,6 +371,10 @@ namespace sd {
         SIMDEE_BINOP(dums, dums, operator+, l.mm + r.mm)
         SIMDEE_BINOP(dums, dums, operator-, l.mm - r.mm)
         SIMDEE_BINOP(dums, dums, operator*, l.mm * r.mm)
+        SIMDEE_SHIFTOP(dums, operator<<, impl::dum_shl(l.mm, unsigned(r)))
+        SIMDEE_SHIFTOP(dums, operator>>, impl::dum_shr(l.mm, unsigned(r)))
+        SIMDEE_BINOP(dums, dums, operator<<, impl::dum_shl(l.mm, unsigned(r.mm)))
+        SIMDEE_BINOP(dums, dums, operator>>, impl::dum_shr(l.mm, unsigned(r.mm)))
 
         SIMDEE_BINOP(dums, dums, min, std::min(l.mm, r.mm))
         SIMDEE_BINOP(dums, dums, max, std::max(l.mm, r.mm))
@@ -183,11 +382,344 @@ namespace sd {
 #endif
     };
 
+    struct dumb64 : dum_base<dumb64> {
+        SIMDEE_TRIVIAL_TYPE(dumb64)
+
+        using dum_base::dum_base;
+
+        SIMDEE_UNOP(dumb64, mask_t, mask, mask_t(l.mm))
+        SIMDEE_UNOP(dumb64, scalar_t, first_scalar, l.mm)
+        SIMDEE_BINOP(dumb64, dumb64, operator==, dumb64::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumb64, dumb64, operator!=, dumb64::scalar_t(l.mm != r.mm))
+        SIMDEE_BINOP(dumb64, dumb64, operator&&, first_scalar(l) && first_scalar(r))
+        SIMDEE_BINOP(dumb64, dumb64, operator||, first_scalar(l) || first_scalar(r))
+        SIMDEE_UNOP(dumb64, dumb64, operator!, !first_scalar(l))
+    };
+
+    struct dumd : dum_base<dumd> {
+        SIMDEE_TRIVIAL_TYPE(dumd)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dumd(const dums64&);
+
+        SIMDEE_UNOP(dumd, scalar_t, first_scalar, l.mm)
+        SIMDEE_BINOP(dumd, dumb64, operator<, dumb64::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dumd, dumb64, operator>, dumb64::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dumd, dumb64, operator<=, dumb64::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dumd, dumb64, operator>=, dumb64::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dumd, dumb64, operator==, dumb64::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumd, dumb64, operator!=, dumb64::scalar_t(l.mm != r.mm))
+
+        SIMDEE_UNOP(dumd, dumd, operator-, - l.mm)
+        SIMDEE_BINOP(dumd, dumd, operator+, l.mm + r.mm)
+        SIMDEE_BINOP(dumd, dumd, operator-, l.mm - r.mm)
+        SIMDEE_BINOP(dumd, dumd, operator*, l.mm * r.mm)
+        SIMDEE_BINOP(dumd, dumd, operator/, l.mm / r.mm)
+
+        SIMDEE_BINOP(dumd, dumd, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dumd, dumd, max, std::max(l.mm, r.mm))
+        SIMDEE_UNOP(dumd, dumd, sqrt, std::sqrt(l.mm))
+        SIMDEE_UNOP(dumd, dumd, rsqrt, 1 / std::sqrt(l.mm))
+        SIMDEE_UNOP(dumd, dumd, rcp, 1 / l.mm)
+        SIMDEE_UNOP(dumd, dumd, abs, std::abs(l.mm))
+        SIMDEE_UNOP(dumd, dumd, floor, std::floor(l.mm))
+        SIMDEE_UNOP(dumd, dumd, ceil, std::ceil(l.mm))
+        SIMDEE_UNOP(dumd, dumd, trunc, std::trunc(l.mm))
+        SIMDEE_UNOP(dumd, dumd, round, std::round(l.mm))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(dumd, dumd, fma, std::fma(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(dumd, dumd, fms, std::fma(l.mm, m.mm, -r.mm))
+        SIMDEE_TRIOP(dumd, dumd, fnma, std::fma(-l.mm, m.mm, r.mm))
+#else
+        SIMDEE_TRIOP(dumd, dumd, fma, l.mm * m.mm + r.mm)
+        SIMDEE_TRIOP(dumd, dumd, fms, l.mm * m.mm - r.mm)
+        SIMDEE_TRIOP(dumd, dumd, fnma, r.mm - l.mm * m.mm)
+#endif
+    };
+
+    struct dumu64 : dum_base<dumu64> {
+        SIMDEE_TRIVIAL_TYPE(dumu64)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dumu64(const dumb64&);
+        SIMDEE_INL explicit dumu64(const dums64&);
+
+        SIMDEE_UNOP(dumu64, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dumu64, dumb64, operator<, dumb64::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dumu64, dumb64, operator>, dumb64::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dumu64, dumb64, operator<=, dumb64::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dumu64, dumb64, operator>=, dumb64::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dumu64, dumb64, operator==, dumb64::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumu64, dumb64, operator!=, dumb64::scalar_t(l.mm != r.mm))
+        SIMDEE_BINOP(dumu64, dumu64, operator&, l.mm & r.mm)
+        SIMDEE_BINOP(dumu64, dumu64, operator|, l.mm | r.mm)
+        SIMDEE_BINOP(dumu64, dumu64, operator^, l.mm ^ r.mm)
+        SIMDEE_UNOP(dumu64, dumu64, operator~, ~l.mm)
+        SIMDEE_UNOP(dumu64, dumu64, operator-, 0 - l.mm)
+        SIMDEE_BINOP(dumu64, dumu64, operator+, l.mm + r.mm)
+        SIMDEE_BINOP(dumu64, dumu64, operator-, l.mm - r.mm)
+        SIMDEE_BINOP(dumu64, dumu64, operator*, l.mm * r.mm)
+        SIMDEE_BINOP(dumu64, dumu64, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dumu64, dumu64, max, std::max(l.mm, r.mm))
+#endif
+    };
+
+    struct dums64 : dum_base<dums64> {
+        SIMDEE_TRIVIAL_TYPE(dums64)
+
+        using dum_base::dum_base;
+
+        SIMDEE_INL explicit dums64(const dumd&);
+        SIMDEE_INL explicit dums64(const dumu64&);
+
+        SIMDEE_UNOP(dums64, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dums64, dumb64, operator<, dumb64::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dums64, dumb64, operator>, dumb64::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dums64, dumb64, operator<=, dumb64::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dums64, dumb64, operator>=, dumb64::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dums64, dumb64, operator==, dumb64::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dums64, dumb64, operator!=, dumb64::scalar_t(l.mm != r.mm))
+
+        SIMDEE_BINOP(dums64, dums64, operator&, l.mm & r.mm)
+        SIMDEE_BINOP(dums64, dums64, operator|, l.mm | r.mm)
+        SIMDEE_BINOP(dums64, dums64, operator^, l.mm ^ r.mm)
+        SIMDEE_UNOP(dums64, dums64, operator~, ~l.mm)
+
+        SIMDEE_UNOP(dums64, dums64, operator-, - l.mm)
+        SIMDEE_BINOP(dums64, dums64, operator+, l.mm + r.mm)
+        SIMDEE_BINOP(dums64, dums64, operator-, l.mm - r.mm)
+        SIMDEE_BINOP(dums64, dums64, operator*, l.mm * r.mm)
+
+        SIMDEE_BINOP(dums64, dums64, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dums64, dums64, max, std::max(l.mm, r.mm))
+        SIMDEE_UNOP(dums64, dums64, abs, std::abs(l.mm))
+#endif
+    };
+
+    struct dumb8 : dum_base<dumb8> {
+        SIMDEE_TRIVIAL_TYPE(dumb8)
+
+        using dum_base::dum_base;
+
+        SIMDEE_UNOP(dumb8, mask_t, mask, mask_t(l.mm))
+        SIMDEE_UNOP(dumb8, scalar_t, first_scalar, l.mm)
+        SIMDEE_BINOP(dumb8, dumb8, operator==, dumb8::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumb8, dumb8, operator!=, dumb8::scalar_t(l.mm != r.mm))
+        SIMDEE_BINOP(dumb8, dumb8, operator&&, first_scalar(l) && first_scalar(r))
+        SIMDEE_BINOP(dumb8, dumb8, operator||, first_scalar(l) || first_scalar(r))
+        SIMDEE_UNOP(dumb8, dumb8, operator!, !first_scalar(l))
+    };
+
+    struct dumu8 : dum_base<dumu8> {
+        SIMDEE_TRIVIAL_TYPE(dumu8)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dumu8(const dumb8&);
+        SIMDEE_INL explicit dumu8(const dums8&);
+
+        SIMDEE_UNOP(dumu8, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dumu8, dumb8, operator<, dumb8::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dumu8, dumb8, operator>, dumb8::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dumu8, dumb8, operator<=, dumb8::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dumu8, dumb8, operator>=, dumb8::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dumu8, dumb8, operator==, dumb8::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumu8, dumb8, operator!=, dumb8::scalar_t(l.mm != r.mm))
+
+        SIMDEE_BINOP(dumu8, dumu8, operator&, scalar_t(l.mm & r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, operator|, scalar_t(l.mm | r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, operator^, scalar_t(l.mm ^ r.mm))
+        SIMDEE_UNOP(dumu8, dumu8, operator~, scalar_t(~l.mm))
+
+        SIMDEE_UNOP(dumu8, dumu8, operator-, scalar_t(0 - l.mm))
+        SIMDEE_BINOP(dumu8, dumu8, operator+, scalar_t(l.mm + r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, operator-, scalar_t(l.mm - r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, operator*, scalar_t(uint32_t(l.mm) * r.mm))
+
+        SIMDEE_BINOP(dumu8, dumu8, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, max, std::max(l.mm, r.mm))
+
+        SIMDEE_BINOP(dumu8, dumu8, add_sat, impl::dum_saturate<scalar_t>(l.mm + r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, sub_sat, impl::dum_saturate<scalar_t>(l.mm - r.mm))
+        SIMDEE_BINOP(dumu8, dumu8, avg, scalar_t((l.mm + r.mm + 1) >> 1))
+#endif
+    };
+
+    struct dums8 : dum_base<dums8> {
+        SIMDEE_TRIVIAL_TYPE(dums8)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dums8(const dumu8&);
+
+        SIMDEE_UNOP(dums8, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dums8, dumb8, operator<, dumb8::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dums8, dumb8, operator>, dumb8::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dums8, dumb8, operator<=, dumb8::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dums8, dumb8, operator>=, dumb8::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dums8, dumb8, operator==, dumb8::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dums8, dumb8, operator!=, dumb8::scalar_t(l.mm != r.mm))
+
+        SIMDEE_BINOP(dums8, dums8, operator&, scalar_t(l.mm & r.mm))
+        SIMDEE_BINOP(dums8, dums8, operator|, scalar_t(l.mm | r.mm))
+        SIMDEE_BINOP(dums8, dums8, operator^, scalar_t(l.mm ^ r.mm))
+        SIMDEE_UNOP(dums8, dums8, operator~, scalar_t(~l.mm))
+
+        SIMDEE_UNOP(dums8, dums8, operator-, scalar_t(-l.mm))
+        SIMDEE_BINOP(dums8, dums8, operator+, scalar_t(l.mm + r.mm))
+        SIMDEE_BINOP(dums8, dums8, operator-, scalar_t(l.mm - r.mm))
+        SIMDEE_BINOP(dums8, dums8, operator*, scalar_t(l.mm * r.mm))
+
+        SIMDEE_BINOP(dums8, dums8, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dums8, dums8, max, std::max(l.mm, r.mm))
+        SIMDEE_UNOP(dums8, dums8, abs, scalar_t(std::abs(l.mm)))
+
+        SIMDEE_BINOP(dums8, dums8, add_sat, impl::dum_saturate<scalar_t>(l.mm + r.mm))
+        SIMDEE_BINOP(dums8, dums8, sub_sat, impl::dum_saturate<scalar_t>(l.mm - r.mm))
+        SIMDEE_BINOP(dums8, dums8, avg, scalar_t((l.mm + r.mm + 1) >> 1))
+#endif
+    };
+
+    struct dumb16 : dum_base<dumb16> {
+        SIMDEE_TRIVIAL_TYPE(dumb16)
+
+        using dum_base::dum_base;
+
+        SIMDEE_UNOP(dumb16, mask_t, mask, mask_t(l.mm))
+        SIMDEE_UNOP(dumb16, scalar_t, first_scalar, l.mm)
+        SIMDEE_BINOP(dumb16, dumb16, operator==, dumb16::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumb16, dumb16, operator!=, dumb16::scalar_t(l.mm != r.mm))
+        SIMDEE_BINOP(dumb16, dumb16, operator&&, first_scalar(l) && first_scalar(r))
+        SIMDEE_BINOP(dumb16, dumb16, operator||, first_scalar(l) || first_scalar(r))
+        SIMDEE_UNOP(dumb16, dumb16, operator!, !first_scalar(l))
+    };
+
+    struct dumu16 : dum_base<dumu16> {
+        SIMDEE_TRIVIAL_TYPE(dumu16)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dumu16(const dumb16&);
+        SIMDEE_INL explicit dumu16(const dums16&);
+
+        SIMDEE_UNOP(dumu16, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dumu16, dumb16, operator<, dumb16::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dumu16, dumb16, operator>, dumb16::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dumu16, dumb16, operator<=, dumb16::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dumu16, dumb16, operator>=, dumb16::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dumu16, dumb16, operator==, dumb16::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dumu16, dumb16, operator!=, dumb16::scalar_t(l.mm != r.mm))
+
+        SIMDEE_BINOP(dumu16, dumu16, operator&, scalar_t(l.mm & r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, operator|, scalar_t(l.mm | r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, operator^, scalar_t(l.mm ^ r.mm))
+        SIMDEE_UNOP(dumu16, dumu16, operator~, scalar_t(~l.mm))
+
+        SIMDEE_UNOP(dumu16, dumu16, operator-, scalar_t(0 - l.mm))
+        SIMDEE_BINOP(dumu16, dumu16, operator+, scalar_t(l.mm + r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, operator-, scalar_t(l.mm - r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, operator*, scalar_t(uint32_t(l.mm) * r.mm))
+
+        SIMDEE_BINOP(dumu16, dumu16, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, max, std::max(l.mm, r.mm))
+
+        SIMDEE_BINOP(dumu16, dumu16, add_sat, impl::dum_saturate<scalar_t>(l.mm + r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, sub_sat, impl::dum_saturate<scalar_t>(l.mm - r.mm))
+        SIMDEE_BINOP(dumu16, dumu16, avg, scalar_t((l.mm + r.mm + 1) >> 1))
+#endif
+    };
+
+    struct dums16 : dum_base<dums16> {
+        SIMDEE_TRIVIAL_TYPE(dums16)
+
+        using dum_base::dum_base;
+        SIMDEE_INL explicit dums16(const dumu16&);
+
+        SIMDEE_UNOP(dums16, scalar_t, first_scalar, l.mm)
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(dums16, dumb16, operator<, dumb16::scalar_t(l.mm < r.mm))
+        SIMDEE_BINOP(dums16, dumb16, operator>, dumb16::scalar_t(l.mm > r.mm))
+        SIMDEE_BINOP(dums16, dumb16, operator<=, dumb16::scalar_t(l.mm <= r.mm))
+        SIMDEE_BINOP(dums16, dumb16, operator>=, dumb16::scalar_t(l.mm >= r.mm))
+        SIMDEE_BINOP(dums16, dumb16, operator==, dumb16::scalar_t(l.mm == r.mm))
+        SIMDEE_BINOP(dums16, dumb16, operator!=, dumb16::scalar_t(l.mm != r.mm))
+
+        SIMDEE_BINOP(dums16, dums16, operator&, scalar_t(l.mm & r.mm))
+        SIMDEE_BINOP(dums16, dums16, operator|, scalar_t(l.mm | r.mm))
+        SIMDEE_BINOP(dums16, dums16, operator^, scalar_t(l.mm ^ r.mm))
+        SIMDEE_UNOP(dums16, dums16, operator~, scalar_t(~l.mm))
+
+        SIMDEE_UNOP(dums16, dums16, operator-, scalar_t(-l.mm))
+        SIMDEE_BINOP(dums16, dums16, operator+, scalar_t(l.mm + r.mm))
+        SIMDEE_BINOP(dums16, dums16, operator-, scalar_t(l.mm - r.mm))
+        SIMDEE_BINOP(dums16, dums16, operator*, scalar_t(l.mm * r.mm))
+
+        SIMDEE_BINOP(dums16, dums16, min, std::min(l.mm, r.mm))
+        SIMDEE_BINOP(dums16, dums16, max, std::max(l.mm, r.mm))
+        SIMDEE_UNOP(dums16, dums16, abs, scalar_t(std::abs(l.mm)))
+
+        SIMDEE_BINOP(dums16, dums16, add_sat, impl::dum_saturate<scalar_t>(l.mm + r.mm))
+        SIMDEE_BINOP(dums16, dums16, sub_sat, impl::dum_saturate<scalar_t>(l.mm - r.mm))
+        SIMDEE_BINOP(dums16, dums16, avg, scalar_t((l.mm + r.mm + 1) >> 1))
+#endif
+    };
+
     SIMDEE_INL dumf::dumf(const dums& r) { mm = static_cast<scalar_t>(r.data()); }
     SIMDEE_INL dums::dums(const dumf& r) { mm = static_cast<scalar_t>(r.data()); }
     SIMDEE_INL dumu::dumu(const dumb& r) { mm = static_cast<scalar_t>(r.data()); }
     SIMDEE_INL dumu::dumu(const dums& r) { mm = static_cast<scalar_t>(r.data()); }
     SIMDEE_INL dums::dums(const dumu& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumf::dumf(const dumu& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumu::dumu(const dumf& r) { mm = static_cast<scalar_t>(r.data()); }
+
+    // conversion to int, rounding to the nearest integer with ties to even
+    SIMDEE_INL const dums to_int_round(const dumf& l) {
+        return static_cast<dums::scalar_t>(std::nearbyint(l.data()));
+    }
+
+    SIMDEE_INL dumd::dumd(const dums64& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dums64::dums64(const dumd& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumu64::dumu64(const dumb64& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumu64::dumu64(const dums64& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dums64::dums64(const dumu64& r) { mm = static_cast<scalar_t>(r.data()); }
+
+    SIMDEE_INL dumu8::dumu8(const dumb8& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumu8::dumu8(const dums8& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dums8::dums8(const dumu8& r) { mm = static_cast<scalar_t>(r.data()); }
+
+    SIMDEE_INL dumu16::dumu16(const dumb16& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dumu16::dumu16(const dums16& r) { mm = static_cast<scalar_t>(r.data()); }
+    SIMDEE_INL dums16::dums16(const dumu16& r) { mm = static_cast<scalar_t>(r.data()); }
+
+#if SIMDEE_NEED_INT
+    // a single lane is widened or narrowed as a whole, dual<T> builds on these
+    SIMDEE_INL const dumu16 widen(const dumu8& l) { return uint16_t(first_scalar(l)); }
+    SIMDEE_INL const dums16 widen(const dums8& l) { return int16_t(first_scalar(l)); }
+    SIMDEE_INL const dumu widen(const dumu16& l) { return uint32_t(first_scalar(l)); }
+    SIMDEE_INL const dums widen(const dums16& l) { return int32_t(first_scalar(l)); }
+
+    SIMDEE_INL const dumu8 narrow(const dumu16& l) {
+        return uint8_t(std::min<uint16_t>(first_scalar(l), 0xff));
+    }
+    SIMDEE_INL const dums8 narrow(const dums16& l) {
+        return impl::dum_saturate<int8_t>(first_scalar(l));
+    }
+    SIMDEE_INL const dumu16 narrow(const dumu& l) {
+        return uint16_t(std::min<uint32_t>(first_scalar(l), 0xffff));
+    }
+    SIMDEE_INL const dums16 narrow(const dums& l) {
+        return impl::dum_saturate<int16_t>(first_scalar(l));
+    }
+#endif
 
     SIMDEE_INL const dumb cond(const dumb& pred, const dumb& if_true, const dumb& if_false) {
         return first_scalar(pred) ? if_true : if_false;
@@ -201,6 +733,43 @@ namespace sd {
     SIMDEE_INL const dums cond(const dumb& pred, const dums& if_true, const dums& if_false) {
         return first_scalar(pred) ? if_true : if_false;
     }
+    SIMDEE_INL const dumb64 cond(const dumb64& pred, const dumb64& if_true,
+                                 const dumb64& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumd cond(const dumb64& pred, const dumd& if_true, const dumd& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumu64 cond(const dumb64& pred, const dumu64& if_true,
+                                 const dumu64& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dums64 cond(const dumb64& pred, const dums64& if_true,
+                                 const dums64& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumb8 cond(const dumb8& pred, const dumb8& if_true, const dumb8& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumu8 cond(const dumb8& pred, const dumu8& if_true, const dumu8& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dums8 cond(const dumb8& pred, const dums8& if_true, const dums8& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumb16 cond(const dumb16& pred, const dumb16& if_true,
+                                 const dumb16& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dumu16 cond(const dumb16& pred, const dumu16& if_true,
+                                 const dumu16& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_INL const dums16 cond(const dumb16& pred, const dums16& if_true,
+                                 const dums16& if_false) {
+        return first_scalar(pred) ? if_true : if_false;
+    }
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif // SIMDEE_SIMD_TYPES_DUM_HPP
@@ -0,0 +1,505 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_SIMD_TYPES_GNU_HPP
+#define SIMDEE_SIMD_TYPES_GNU_HPP
+
+#include "common.hpp"
+
+#if !SIMDEE_GNU_VECTORS
+#error "GCC or Clang vector extensions are required to use the GNU SIMD type. Please check your compiler."
+#endif
+
+#include <cmath>
+#include <cstring>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+        // generic 16-byte vectors, the compiler lowers the operators to the instruction set in
+        // effect (SSE, NEON, AltiVec, ...) or to scalar code
+        typedef float gnu_f32x4 __attribute__((vector_size(16)));
+        typedef uint32_t gnu_u32x4 __attribute__((vector_size(16)));
+        typedef int32_t gnu_s32x4 __attribute__((vector_size(16)));
+
+        template <typename V, typename T>
+        SIMDEE_INL V gnu_splat(T r) {
+            using lane_t = typename std::decay<decltype(std::declval<V>()[0])>::type;
+            const lane_t x = lane_t(r);
+            return V{x, x, x, x};
+        }
+
+        // the lane representation of a scalar, bool32_t is stored as its bits
+        SIMDEE_INL float gnu_lane(float r) { return r; }
+        SIMDEE_INL uint32_t gnu_lane(uint32_t r) { return r; }
+        SIMDEE_INL int32_t gnu_lane(int32_t r) { return r; }
+        SIMDEE_INL int32_t gnu_lane(bool32_t r) { return int32_t(r); }
+
+        // bit i of the result is the top bit of lane i
+        SIMDEE_INL uint32_t gnu_mask(const gnu_s32x4& v) {
+            const gnu_s32x4 bits = (v < gnu_splat<gnu_s32x4>(0)) & gnu_s32x4{1, 2, 4, 8};
+            return uint32_t(bits[0] | bits[1] | bits[2] | bits[3]);
+        }
+
+        // reinterpretation of the bits, and conversion of each lane to the scalar of To
+        template <typename To, typename From>
+        SIMDEE_INL To gnu_bits(const From& v) {
+            return reinterpret_cast<To>(v);
+        }
+        template <typename To, typename From>
+        SIMDEE_INL To gnu_convert(const From& v) {
+#if defined(__clang__) || __GNUC__ >= 9
+            return __builtin_convertvector(v, To);
+#else
+            using lane_t = typename std::decay<decltype(std::declval<To>()[0])>::type;
+            return To{lane_t(v[0]), lane_t(v[1]), lane_t(v[2]), lane_t(v[3])};
+#endif
+        }
+
+        // lanes of a where m is set, lanes of b elsewhere; m has all bits set or clear in each lane
+        template <typename V>
+        SIMDEE_INL V gnu_select(const gnu_s32x4& m, const V& a, const V& b) {
+            const gnu_s32x4 ai = gnu_bits<gnu_s32x4>(a);
+            const gnu_s32x4 bi = gnu_bits<gnu_s32x4>(b);
+            return gnu_bits<V>((m & ai) | (~m & bi));
+        }
+
+        // lane j of the result is lane I_j of the concatenation of a and b
+        template <typename V, std::size_t... I>
+        SIMDEE_INL V gnu_shuffle(const V& a, const V& b, lanes<I...>) {
+#if defined(__clang__)
+            return __builtin_shufflevector(a, b, int(I)...);
+#else
+            return __builtin_shuffle(a, b, gnu_s32x4{int32_t(I)...});
+#endif
+        }
+
+        // shifts with the results of the vector instructions for counts of at least the width
+        template <typename V>
+        SIMDEE_INL V gnu_shl(const V& l, int r) {
+            // in unsigned lanes, so that shifting out the sign bit is well defined
+            if (unsigned(r) >= 32U) return gnu_splat<V>(0);
+            return gnu_bits<V>(gnu_bits<gnu_u32x4>(l) << r);
+        }
+        template <typename V>
+        SIMDEE_INL V gnu_shr(const V& l, int r) {
+            const bool is_signed = std::is_signed<decltype(l[0] + 0)>::value;
+            if (unsigned(r) < 32U) return l >> r;
+            return is_signed ? V(l >> 31) : gnu_splat<V>(0);
+        }
+        template <typename V>
+        SIMDEE_INL V gnu_shlv(const V& l, const V& r) {
+            const gnu_u32x4 n = gnu_bits<gnu_u32x4>(r);
+            const gnu_u32x4 res = gnu_bits<gnu_u32x4>(l) << (n & gnu_splat<gnu_u32x4>(31U));
+            return gnu_select(n < gnu_splat<gnu_u32x4>(32U), gnu_bits<V>(res), gnu_splat<V>(0));
+        }
+        template <typename V>
+        SIMDEE_INL V gnu_shrv(const V& l, const V& r) {
+            const bool is_signed = std::is_signed<decltype(l[0] + 0)>::value;
+            const gnu_u32x4 n = gnu_bits<gnu_u32x4>(r);
+            const gnu_s32x4 in_range = n < gnu_splat<gnu_u32x4>(32U);
+            const V res = l >> gnu_bits<V>(n & gnu_splat<gnu_u32x4>(31U));
+            const V out = is_signed ? V(l >> 31) : gnu_splat<V>(0);
+            return gnu_select(in_range, res, out);
+        }
+
+        // lanes of a vector without a vector instruction in the extensions
+        SIMDEE_INL gnu_f32x4 gnu_sqrt(const gnu_f32x4& v) {
+            return gnu_f32x4{std::sqrt(v[0]), std::sqrt(v[1]), std::sqrt(v[2]), std::sqrt(v[3])};
+        }
+        SIMDEE_INL gnu_f32x4 gnu_fma(const gnu_f32x4& a, const gnu_f32x4& b, const gnu_f32x4& c) {
+            return gnu_f32x4{std::fma(a[0], b[0], c[0]), std::fma(a[1], b[1], c[1]),
+                             std::fma(a[2], b[2], c[2]), std::fma(a[3], b[3], c[3])};
+        }
+
+        // lane indices and lanes to keep for compress and expand, one row per value of the mask
+        struct alignas(16) gnu_pack_row {
+            int32_t idx[4];
+            int32_t keep[4];
+        };
+        template <bool Expand, std::size_t... K>
+        constexpr gnu_pack_row make_gnu_pack_row(std::uint64_t m, lanes<K...>) {
+            return gnu_pack_row{
+                {int32_t(pack_zero(Expand, m, K) ? 0 : pack_source(Expand, m, K))...},
+                {int32_t(pack_zero(Expand, m, K) ? 0 : -1)...}};
+        }
+        template <bool Expand, typename M = typename make_lanes<16>::type>
+        struct gnu_pack;
+        template <bool Expand, std::size_t... M>
+        struct gnu_pack<Expand, lanes<M...>> {
+            template <typename V>
+            SIMDEE_INL static V apply(const V& l, std::uint64_t m) {
+                static constexpr gnu_pack_row rows[] = {
+                    make_gnu_pack_row<Expand>(M, typename make_lanes<4>::type{})...};
+                gnu_s32x4 idx, keep;
+                std::memcpy(&idx, rows[m].idx, sizeof(idx));
+                std::memcpy(&keep, rows[m].keep, sizeof(keep));
+#if defined(__clang__)
+                // __builtin_shufflevector only takes constant indices
+                const V res{l[idx[0]], l[idx[1]], l[idx[2]], l[idx[3]]};
+#else
+                const V res = __builtin_shuffle(l, idx);
+#endif
+                return gnu_bits<V>(gnu_bits<gnu_s32x4>(res) & keep);
+            }
+        };
+    } // namespace impl
+
+    struct gnub;
+    struct gnuf;
+    struct gnuu;
+    struct gnus;
+    using not_gnub = expr::deferred_lognot<gnub>;
+    using not_gnuu = expr::deferred_bitnot<gnuu>;
+    using not_gnus = expr::deferred_bitnot<gnus>;
+
+    template <>
+    struct is_simd_vector<gnub> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<gnuf> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<gnuu> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<gnus> : std::integral_constant<bool, true> {};
+
+    template <typename Simd_t, typename Vector_t, typename Scalar_t>
+    struct gnu_traits {
+        using simd_t = Simd_t;
+        using vector_t = Vector_t;
+        using scalar_t = Scalar_t;
+        using vec_b = gnub;
+        using vec_f = gnuf;
+        using vec_u = gnuu;
+        using vec_s = gnus;
+        using mask_t = impl::mask<0xfU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<gnub> : gnu_traits<gnub, impl::gnu_s32x4, bool32_t> {};
+    template <>
+    struct simd_vector_traits<gnuf> : gnu_traits<gnuf, impl::gnu_f32x4, float> {};
+    template <>
+    struct simd_vector_traits<gnuu> : gnu_traits<gnuu, impl::gnu_u32x4, uint32_t> {};
+    template <>
+    struct simd_vector_traits<gnus> : gnu_traits<gnus, impl::gnu_s32x4, int32_t> {};
+
+    template <typename Crtp>
+    struct gnu_base : simd_base<Crtp> {
+    protected:
+        using simd_base<Crtp>::mm;
+
+    public:
+        using vector_t = typename simd_base<Crtp>::vector_t;
+        using scalar_t = typename simd_base<Crtp>::scalar_t;
+        using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
+        using simd_base<Crtp>::width;
+        using simd_base<Crtp>::self;
+
+        SIMDEE_TRIVIAL_TYPE(gnu_base)
+        SIMDEE_BASE_CTOR(gnu_base, vector_t, mm = r)
+        SIMDEE_BASE_CTOR(gnu_base, scalar_t, mm = impl::gnu_splat<vector_t>(impl::gnu_lane(r)))
+        SIMDEE_BASE_CTOR_TPL(gnu_base, expr::aligned<T>, aligned_load(r.ptr))
+        SIMDEE_BASE_CTOR_TPL(gnu_base, expr::unaligned<T>, unaligned_load(r.ptr))
+        SIMDEE_BASE_CTOR_TPL(gnu_base, expr::interleaved<T>, interleaved_load(r.ptr, r.step))
+        SIMDEE_BASE_CTOR_TPL(gnu_base, expr::init<T>, *this = r.template to<scalar_t>())
+        SIMDEE_BASE_CTOR(gnu_base, storage_t, aligned_load(r.data()))
+
+        SIMDEE_INL gnu_base(scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3) {
+            mm = vector_t{impl::gnu_lane(v0), impl::gnu_lane(v1), impl::gnu_lane(v2),
+                          impl::gnu_lane(v3)};
+        }
+
+        template <typename T, typename Init>
+        SIMDEE_INL gnu_base(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename T, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename T>
+        SIMDEE_INL gnu_base(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename T>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
+        // memcpy of a whole vector compiles to a single load or store, and unlike a pointer cast
+        // it is valid for any alignment and scalar type
+        SIMDEE_INL void aligned_load(const scalar_t* r) { std::memcpy(&mm, r, sizeof(mm)); }
+        SIMDEE_INL void aligned_store(scalar_t* r) const { std::memcpy(r, &mm, sizeof(mm)); }
+        SIMDEE_INL void unaligned_load(const scalar_t* r) { std::memcpy(&mm, r, sizeof(mm)); }
+        SIMDEE_INL void unaligned_store(scalar_t* r) const { std::memcpy(r, &mm, sizeof(mm)); }
+        SIMDEE_INL void streaming_store(scalar_t* r) const { std::memcpy(r, &mm, sizeof(mm)); }
+
+        void interleaved_load(const scalar_t* r, int step) {
+            storage_t temp;
+            for (std::size_t i = 0; i < width; ++i, r += step) { temp[i] = *r; }
+            aligned_load(temp.data());
+        }
+
+        void interleaved_store(scalar_t* r, int step) const {
+            const storage_t temp(self());
+            for (std::size_t i = 0; i < width; ++i, r += step) { *r = temp[i]; }
+        }
+
+        // lanes from count onwards are taken from fill, or left untouched when storing
+        void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            storage_t temp(fill);
+            for (std::size_t i = 0; i < count && i < width; ++i) { temp[i] = r[i]; }
+            aligned_load(temp.data());
+        }
+
+        void partial_store(scalar_t* r, std::size_t count) const {
+            const storage_t temp(self());
+            for (std::size_t i = 0; i < count && i < width; ++i) { r[i] = temp[i]; }
+        }
+
+        void gather_load(const scalar_t* base, const vec_s& idx) {
+            const impl::gnu_s32x4 i = idx.data();
+            mm = vector_t{impl::gnu_lane(base[i[0]]), impl::gnu_lane(base[i[1]]),
+                          impl::gnu_lane(base[i[2]]), impl::gnu_lane(base[i[3]])};
+        }
+
+        void scatter_store(scalar_t* base, const vec_s& idx) const {
+            const storage_t temp(self());
+            const impl::gnu_s32x4 i = idx.data();
+            for (std::size_t j = 0; j < width; ++j) { base[i[j]] = temp[j]; }
+        }
+
+        template <typename Op_t>
+        friend const Crtp reduce(const Crtp& l, Op_t f) {
+            const Crtp tmp = f(l, shuffle(l, impl::lanes<2, 3, 0, 1>{}));
+            return f(tmp, shuffle(tmp, impl::lanes<1, 0, 3, 2>{}));
+        }
+
+        template <typename Op_t>
+        friend const Crtp reduce_rows(const Crtp* rows, Op_t f) {
+            return impl::reduce_rows_tree(rows, f);
+        }
+
+        template <std::size_t... I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I...> idx) {
+            return impl::gnu_shuffle(l.data(), l.data(), idx);
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask>) {
+            using idx = impl::lanes<(Mask & 1) ? 4 : 0, (Mask & 2) ? 5 : 1, (Mask & 4) ? 6 : 2,
+                                    (Mask & 8) ? 7 : 3>;
+            return impl::gnu_shuffle(a.data(), b.data(), idx{});
+        }
+
+        // the first and the second half of a0, b0, a1, b1, ...
+        friend SIMDEE_INL const Crtp interleave_lo(const Crtp& a, const Crtp& b) {
+            return impl::gnu_shuffle(a.data(), b.data(), impl::lanes<0, 4, 1, 5>{});
+        }
+        friend SIMDEE_INL const Crtp interleave_hi(const Crtp& a, const Crtp& b) {
+            return impl::gnu_shuffle(a.data(), b.data(), impl::lanes<2, 6, 3, 7>{});
+        }
+
+        // the lanes selected by m moved to the front, or the front lanes moved to the lanes
+        // selected by m, in order; the other lanes are zero
+        friend SIMDEE_INL const Crtp compress(const Crtp& l, mask_t m) {
+            return impl::gnu_pack<false>::apply(l.data(), m.value);
+        }
+        friend SIMDEE_INL const Crtp expand(const Crtp& l, mask_t m) {
+            return impl::gnu_pack<true>::apply(l.data(), m.value);
+        }
+    };
+
+    struct gnub : gnu_base<gnub> {
+        SIMDEE_TRIVIAL_TYPE(gnub)
+
+        using gnu_base::gnu_base;
+        SIMDEE_CTOR(gnub, not_gnub, mm = ~r.neg.mm)
+
+        SIMDEE_UNOP(gnub, mask_t, mask, mask_t(impl::gnu_mask(l.mm)))
+        SIMDEE_UNOP(gnub, scalar_t, first_scalar, scalar_t(l.mm[0]))
+
+        SIMDEE_BINOP(gnub, gnub, operator==, l.mm == r.mm)
+        SIMDEE_BINOP(gnub, gnub, operator!=, l.mm ^ r.mm)
+        SIMDEE_BINOP(gnub, gnub, operator&&, l.mm & r.mm)
+        SIMDEE_BINOP(gnub, gnub, operator||, l.mm | r.mm)
+        SIMDEE_UNOP(gnub, not_gnub, operator!, not_gnub(l))
+    };
+
+    struct gnuf : gnu_base<gnuf> {
+        SIMDEE_TRIVIAL_TYPE(gnuf)
+
+        using gnu_base::gnu_base;
+        SIMDEE_INL explicit gnuf(const gnus&);
+        SIMDEE_INL explicit gnuf(const gnuu&);
+
+        SIMDEE_UNOP(gnuf, scalar_t, first_scalar, l.mm[0])
+
+        SIMDEE_BINOP(gnuf, gnub, operator<, l.mm < r.mm)
+        SIMDEE_BINOP(gnuf, gnub, operator>, l.mm > r.mm)
+        SIMDEE_BINOP(gnuf, gnub, operator<=, l.mm <= r.mm)
+        SIMDEE_BINOP(gnuf, gnub, operator>=, l.mm >= r.mm)
+        SIMDEE_BINOP(gnuf, gnub, operator==, l.mm == r.mm)
+        SIMDEE_BINOP(gnuf, gnub, operator!=, l.mm != r.mm)
+
+        SIMDEE_UNOP(gnuf, gnuf, operator-, -l.mm)
+        SIMDEE_BINOP(gnuf, gnuf, operator+, l.mm + r.mm)
+        SIMDEE_BINOP(gnuf, gnuf, operator-, l.mm - r.mm)
+        SIMDEE_BINOP(gnuf, gnuf, operator*, l.mm * r.mm)
+        SIMDEE_BINOP(gnuf, gnuf, operator/, l.mm / r.mm)
+
+        SIMDEE_BINOP(gnuf, gnuf, min, impl::gnu_select(l.mm < r.mm, l.mm, r.mm))
+        SIMDEE_BINOP(gnuf, gnuf, max, impl::gnu_select(l.mm > r.mm, l.mm, r.mm))
+        SIMDEE_UNOP(gnuf, gnuf, sqrt, impl::gnu_sqrt(l.mm))
+        SIMDEE_UNOP(gnuf, gnuf, rsqrt, gnuf(1.f).mm / impl::gnu_sqrt(l.mm))
+        SIMDEE_UNOP(gnuf, gnuf, rcp, gnuf(1.f).mm / l.mm)
+        SIMDEE_UNOP(gnuf, gnuf, abs,
+                    impl::gnu_bits<vector_t>(impl::gnu_bits<impl::gnu_u32x4>(l.mm) &
+                                             impl::gnu_splat<impl::gnu_u32x4>(0x7fffffffU)))
+
+        // there are no rounding operators, the emulation is branch-free vector code
+        SIMDEE_UNOP(gnuf, gnuf, floor, impl::floor_emulated(l))
+        SIMDEE_UNOP(gnuf, gnuf, ceil, impl::ceil_emulated(l))
+        SIMDEE_UNOP(gnuf, gnuf, trunc, impl::trunc_emulated(l))
+        SIMDEE_UNOP(gnuf, gnuf, round, impl::round_away(l, trunc(l)))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(gnuf, gnuf, fma, impl::gnu_fma(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(gnuf, gnuf, fms, impl::gnu_fma(l.mm, m.mm, -r.mm))
+        SIMDEE_TRIOP(gnuf, gnuf, fnma, impl::gnu_fma(-l.mm, m.mm, r.mm))
+#else
+        SIMDEE_TRIOP(gnuf, gnuf, fma, l.mm * m.mm + r.mm)
+        SIMDEE_TRIOP(gnuf, gnuf, fms, l.mm * m.mm - r.mm)
+        SIMDEE_TRIOP(gnuf, gnuf, fnma, r.mm - l.mm * m.mm)
+#endif
+    };
+
+    struct gnuu : gnu_base<gnuu> {
+        SIMDEE_TRIVIAL_TYPE(gnuu)
+
+        using gnu_base::gnu_base;
+        SIMDEE_INL explicit gnuu(const gnub&);
+        SIMDEE_INL explicit gnuu(const gnus&);
+        SIMDEE_INL explicit gnuu(const gnuf&);
+        SIMDEE_CTOR(gnuu, not_gnuu, mm = ~r.neg.mm)
+
+        SIMDEE_UNOP(gnuu, scalar_t, first_scalar, l.mm[0])
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(gnuu, gnub, operator<, l.mm < r.mm)
+        SIMDEE_BINOP(gnuu, gnub, operator>, l.mm > r.mm)
+        SIMDEE_BINOP(gnuu, gnub, operator<=, l.mm <= r.mm)
+        SIMDEE_BINOP(gnuu, gnub, operator>=, l.mm >= r.mm)
+        SIMDEE_BINOP(gnuu, gnub, operator==, l.mm == r.mm)
+        SIMDEE_BINOP(gnuu, gnub, operator!=, l.mm != r.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator&, l.mm & r.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator|, l.mm | r.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator^, l.mm ^ r.mm)
+        SIMDEE_UNOP(gnuu, not_gnuu, operator~, not_gnuu(l))
+        SIMDEE_UNOP(gnuu, gnuu, operator-, -l.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator+, l.mm + r.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator-, l.mm - r.mm)
+        SIMDEE_BINOP(gnuu, gnuu, operator*, l.mm * r.mm)
+        SIMDEE_SHIFTOP(gnuu, operator<<, impl::gnu_shl(l.mm, r))
+        SIMDEE_SHIFTOP(gnuu, operator>>, impl::gnu_shr(l.mm, r))
+        SIMDEE_BINOP(gnuu, gnuu, operator<<, impl::gnu_shlv(l.mm, r.mm))
+        SIMDEE_BINOP(gnuu, gnuu, operator>>, impl::gnu_shrv(l.mm, r.mm))
+        SIMDEE_BINOP(gnuu, gnuu, min, impl::gnu_select(l.mm < r.mm, l.mm, r.mm))
+        SIMDEE_BINOP(gnuu, gnuu, max, impl::gnu_select(l.mm > r.mm, l.mm, r.mm))
+#endif
+    };
+
+    struct gnus : gnu_base<gnus> {
+        SIMDEE_TRIVIAL_TYPE(gnus)
+
+        using gnu_base::gnu_base;
+        SIMDEE_INL explicit gnus(const gnuf&);
+        SIMDEE_INL explicit gnus(const gnuu&);
+        SIMDEE_CTOR(gnus, not_gnus, mm = ~r.neg.mm)
+
+        SIMDEE_UNOP(gnus, scalar_t, first_scalar, l.mm[0])
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(gnus, gnub, operator<, l.mm < r.mm)
+        SIMDEE_BINOP(gnus, gnub, operator>, l.mm > r.mm)
+        SIMDEE_BINOP(gnus, gnub, operator<=, l.mm <= r.mm)
+        SIMDEE_BINOP(gnus, gnub, operator>=, l.mm >= r.mm)
+        SIMDEE_BINOP(gnus, gnub, operator==, l.mm == r.mm)
+        SIMDEE_BINOP(gnus, gnub, operator!=, l.mm != r.mm)
+
+        SIMDEE_BINOP(gnus, gnus, operator&, l.mm & r.mm)
+        SIMDEE_BINOP(gnus, gnus, operator|, l.mm | r.mm)
+        SIMDEE_BINOP(gnus, gnus, operator^, l.mm ^ r.mm)
+        SIMDEE_UNOP(gnus, not_gnus, operator~, not_gnus(l))
+
+        // the arithmetic wraps around, as with the vector instructions
+        SIMDEE_UNOP(gnus, gnus, operator-, gnus(-gnuu(l)))
+        SIMDEE_BINOP(gnus, gnus, operator+, gnus(gnuu(l) + gnuu(r)))
+        SIMDEE_BINOP(gnus, gnus, operator-, gnus(gnuu(l) - gnuu(r)))
+        SIMDEE_BINOP(gnus, gnus, operator*, gnus(gnuu(l) * gnuu(r)))
+        SIMDEE_SHIFTOP(gnus, operator<<, impl::gnu_shl(l.mm, r))
+        SIMDEE_SHIFTOP(gnus, operator>>, impl::gnu_shr(l.mm, r))
+        SIMDEE_BINOP(gnus, gnus, operator<<, impl::gnu_shlv(l.mm, r.mm))
+        SIMDEE_BINOP(gnus, gnus, operator>>, impl::gnu_shrv(l.mm, r.mm))
+
+        SIMDEE_BINOP(gnus, gnus, min, impl::gnu_select(l.mm < r.mm, l.mm, r.mm))
+        SIMDEE_BINOP(gnus, gnus, max, impl::gnu_select(l.mm > r.mm, l.mm, r.mm))
+        SIMDEE_UNOP(gnus, gnus, abs, impl::gnu_select(l.mm < gnus(0).mm, (-l).mm, l.mm))
+#endif
+    };
+
+    SIMDEE_INL gnuf::gnuf(const gnus& r) { mm = impl::gnu_convert<vector_t>(r.data()); }
+    SIMDEE_INL gnus::gnus(const gnuf& r) { mm = impl::gnu_convert<vector_t>(r.data()); }
+    SIMDEE_INL gnuu::gnuu(const gnub& r) { mm = impl::gnu_bits<vector_t>(r.data()); }
+    SIMDEE_INL gnuu::gnuu(const gnus& r) { mm = impl::gnu_bits<vector_t>(r.data()); }
+    SIMDEE_INL gnus::gnus(const gnuu& r) { mm = impl::gnu_bits<vector_t>(r.data()); }
+    SIMDEE_INL gnuf::gnuf(const gnuu& r) { mm = impl::gnu_convert<vector_t>(r.data()); }
+    SIMDEE_INL gnuu::gnuu(const gnuf& r) { mm = impl::gnu_convert<vector_t>(r.data()); }
+
+    // conversion to int, rounding to the nearest integer with ties to even
+    SIMDEE_INL const gnus to_int_round(const gnuf& l) { return gnus(impl::nearest_emulated(l)); }
+
+    SIMDEE_INL const gnub cond(const gnub& pred, const gnub& if_true, const gnub& if_false) {
+        return impl::gnu_select(pred.data(), if_true.data(), if_false.data());
+    }
+    SIMDEE_INL const gnuf cond(const gnub& pred, const gnuf& if_true, const gnuf& if_false) {
+        return impl::gnu_select(pred.data(), if_true.data(), if_false.data());
+    }
+    SIMDEE_INL const gnuu cond(const gnub& pred, const gnuu& if_true, const gnuu& if_false) {
+        return impl::gnu_select(pred.data(), if_true.data(), if_false.data());
+    }
+    SIMDEE_INL const gnus cond(const gnub& pred, const gnus& if_true, const gnus& if_false) {
+        return impl::gnu_select(pred.data(), if_true.data(), if_false.data());
+    }
+
+    namespace impl {
+
+        template <typename T>
+        struct gnu_special_ops {
+            SIMDEE_INL static T andnot(const T& l, const T& r) { return l.data() & ~r.data(); }
+            SIMDEE_INL static T ornot(const T& l, const T& r) { return l.data() | ~r.data(); }
+        };
+
+        template <typename T>
+        struct special_ops;
+
+        template <>
+        struct special_ops<gnub> : gnu_special_ops<gnub> {};
+
+        template <>
+        struct special_ops<gnuu> : gnu_special_ops<gnuu> {};
+
+        template <>
+        struct special_ops<gnus> : gnu_special_ops<gnus> {};
+
+    } // namespace impl
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif // SIMDEE_SIMD_TYPES_GNU_HPP
@@ -14,6 +14,7 @@
 #include <cmath>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace impl {
         SIMDEE_INL uint32x4_t neon_load(const bool32_t* ptr) {
@@ -28,6 +29,125 @@ namespace sd {
         SIMDEE_INL void neon_store(const float32x4_t& vec, float* ptr) { vst1q_f32(ptr, vec); }
         SIMDEE_INL void neon_store(const uint32x4_t& vec, uint32_t* ptr) { vst1q_u32(ptr, vec); }
         SIMDEE_INL void neon_store(const int32x4_t& vec, int32_t* ptr) { vst1q_s32(ptr, vec); }
+
+        SIMDEE_INL uint8x16_t neon_load(const bool8_t* ptr) {
+            return vld1q_u8(reinterpret_cast<const uint8_t*>(ptr));
+        }
+        SIMDEE_INL uint8x16_t neon_load(const uint8_t* ptr) { return vld1q_u8(ptr); }
+        SIMDEE_INL int8x16_t neon_load(const int8_t* ptr) { return vld1q_s8(ptr); }
+        SIMDEE_INL uint16x8_t neon_load(const bool16_t* ptr) {
+            return vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+        }
+        SIMDEE_INL uint16x8_t neon_load(const uint16_t* ptr) { return vld1q_u16(ptr); }
+        SIMDEE_INL int16x8_t neon_load(const int16_t* ptr) { return vld1q_s16(ptr); }
+        SIMDEE_INL void neon_store(const uint8x16_t& vec, bool8_t* ptr) {
+            vst1q_u8(reinterpret_cast<uint8_t*>(ptr), vec);
+        }
+        SIMDEE_INL void neon_store(const uint8x16_t& vec, uint8_t* ptr) { vst1q_u8(ptr, vec); }
+        SIMDEE_INL void neon_store(const int8x16_t& vec, int8_t* ptr) { vst1q_s8(ptr, vec); }
+        SIMDEE_INL void neon_store(const uint16x8_t& vec, bool16_t* ptr) {
+            vst1q_u16(reinterpret_cast<uint16_t*>(ptr), vec);
+        }
+        SIMDEE_INL void neon_store(const uint16x8_t& vec, uint16_t* ptr) { vst1q_u16(ptr, vec); }
+        SIMDEE_INL void neon_store(const int16x8_t& vec, int16_t* ptr) { vst1q_s16(ptr, vec); }
+
+        SIMDEE_INL uint8_t neon_lane(bool8_t v) { return uint8_t(v); }
+        SIMDEE_INL uint8_t neon_lane(uint8_t v) { return v; }
+        SIMDEE_INL int8_t neon_lane(int8_t v) { return v; }
+        SIMDEE_INL uint16_t neon_lane(bool16_t v) { return uint16_t(v); }
+        SIMDEE_INL uint16_t neon_lane(uint16_t v) { return v; }
+        SIMDEE_INL int16_t neon_lane(int16_t v) { return v; }
+
+#if SIMDEE_ARM64
+        SIMDEE_INL uint64x2_t neon_load(const bool64_t* ptr) {
+            return vld1q_u64(reinterpret_cast<const uint64_t*>(ptr));
+        }
+        SIMDEE_INL float64x2_t neon_load(const double* ptr) { return vld1q_f64(ptr); }
+        SIMDEE_INL uint64x2_t neon_load(const uint64_t* ptr) { return vld1q_u64(ptr); }
+        SIMDEE_INL int64x2_t neon_load(const int64_t* ptr) { return vld1q_s64(ptr); }
+        SIMDEE_INL void neon_store(const uint64x2_t& vec, bool64_t* ptr) {
+            vst1q_u64(reinterpret_cast<uint64_t*>(ptr), vec);
+        }
+        SIMDEE_INL void neon_store(const float64x2_t& vec, double* ptr) { vst1q_f64(ptr, vec); }
+        SIMDEE_INL void neon_store(const uint64x2_t& vec, uint64_t* ptr) { vst1q_u64(ptr, vec); }
+        SIMDEE_INL void neon_store(const int64x2_t& vec, int64_t* ptr) { vst1q_s64(ptr, vec); }
+
+        // lane value as accepted by the 64-bit intrinsics; keeps all bits of a bool64_t
+        SIMDEE_INL uint64_t neon_lane(bool64_t v) { return uint64_t(v); }
+        SIMDEE_INL double neon_lane(double v) { return v; }
+        SIMDEE_INL uint64_t neon_lane(uint64_t v) { return v; }
+        SIMDEE_INL int64_t neon_lane(int64_t v) { return v; }
+
+        // NEON has no 64-bit vmvnq, the 32-bit one does the same job
+        SIMDEE_INL uint64x2_t neon_not(uint64x2_t v) {
+            return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(v)));
+        }
+        SIMDEE_INL int64x2_t neon_not(int64x2_t v) {
+            return vreinterpretq_s64_u32(vmvnq_u32(vreinterpretq_u32_s64(v)));
+        }
+#endif
+
+        // constant byte vectors for lanes of Bytes bytes: the table index that moves lane I_j to
+        // lane j, and the mask that selects the lanes set in Mask
+        template <std::size_t Bytes, typename K = typename make_lanes<16>::type>
+        struct neon_bytes;
+        template <std::size_t Bytes, std::size_t... K>
+        struct neon_bytes<Bytes, lanes<K...>> {
+            template <std::size_t... I>
+            SIMDEE_INL static uint8x16_t index(lanes<I...>) {
+                const uint8_t bytes[] = {uint8_t(lane_at(K / Bytes, I...) * Bytes + K % Bytes)...};
+                return vld1q_u8(bytes);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static uint8x16_t mask(lane_mask<Mask>) {
+                const uint8_t bytes[] = {uint8_t(((Mask >> (K / Bytes)) & 1) ? 0xff : 0)...};
+                return vld1q_u8(bytes);
+            }
+        };
+
+        // any permutation is a single table lookup; ARMv7 looks up each half of the result
+        // separately in a two-register table
+        SIMDEE_INL uint8x16_t neon_table(uint8x16_t x, uint8x16_t idx) {
+#if SIMDEE_ARM64
+            return vqtbl1q_u8(x, idx);
+#else
+            uint8x8x2_t table;
+            table.val[0] = vget_low_u8(x);
+            table.val[1] = vget_high_u8(x);
+            return vcombine_u8(vtbl2_u8(table, vget_low_u8(idx)),
+                               vtbl2_u8(table, vget_high_u8(idx)));
+#endif
+        }
+
+        // compress and expand with a table lookup; 8-bit lanes would need 65536 rows and go
+        // through memory
+        template <std::size_t Bytes, bool Expand>
+        struct neon_pack {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+                using vector_t = typename Simd_t::vector_t;
+                const uint8x16_t i = vld1q_u8(pack_bytes<Bytes, Expand>::row(m));
+                const uint8x16_t x = dirty::cast<vector_t, uint8x16_t>(l.data());
+                return Simd_t(dirty::cast<uint8x16_t, vector_t>(neon_table(x, i)));
+            }
+        };
+        template <bool Expand>
+        struct neon_pack<1, Expand> {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+                return pack_fallback<Expand>(l, m);
+            }
+        };
+
+        // vshlq reads the signed low byte of each count, so the counts are clamped to 32 first,
+        // which shifts all bits out like the counts of 32 or more do on x86; negative counts are
+        // out of range as well
+        SIMDEE_INL int32x4_t neon_shift_count(int r) {
+            return vdupq_n_s32(unsigned(r) < 32U ? r : 32);
+        }
+        SIMDEE_INL int32x4_t neon_shift_count(uint32x4_t r) {
+            return vreinterpretq_s32_u32(vminq_u32(r, vdupq_n_u32(32)));
+        }
     } // namespace impl
 
     struct neonb;
@@ -37,6 +157,36 @@ namespace sd {
     using not_neonb = expr::deferred_lognot<neonb>;
     using not_neonu = expr::deferred_bitnot<neonu>;
     using not_neons = expr::deferred_bitnot<neons>;
+    struct neonb8;
+    struct neonu8;
+    struct neons8;
+    using not_neonb8 = expr::deferred_lognot<neonb8>;
+    using not_neonu8 = expr::deferred_bitnot<neonu8>;
+    using not_neons8 = expr::deferred_bitnot<neons8>;
+    struct neonb16;
+    struct neonu16;
+    struct neons16;
+    using not_neonb16 = expr::deferred_lognot<neonb16>;
+    using not_neonu16 = expr::deferred_bitnot<neonu16>;
+    using not_neons16 = expr::deferred_bitnot<neons16>;
+#if SIMDEE_ARM64
+    struct neonb64;
+    struct neond;
+    struct neonu64;
+    struct neons64;
+    using not_neonb64 = expr::deferred_lognot<neonb64>;
+    using not_neonu64 = expr::deferred_bitnot<neonu64>;
+    using not_neons64 = expr::deferred_bitnot<neons64>;
+
+    template <>
+    struct is_simd_vector<neonb64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neond> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neonu64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neons64> : std::integral_constant<bool, true> {};
+#endif
 
     template <>
     struct is_simd_vector<neonb> : std::integral_constant<bool, true> {};
@@ -46,6 +196,24 @@ namespace sd {
     struct is_simd_vector<neonu> : std::integral_constant<bool, true> {};
     template <>
     struct is_simd_vector<neons> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neonb8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neonu8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neons8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neonb16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neonu16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<neons16> : std::integral_constant<bool, true> {};
+
+    namespace impl {
+        // rcp and rsqrt already take one step from the 8-bit estimate, reaching 15 bits
+        template <>
+        struct refine_steps<neonf> : std::integral_constant<int, 1> {};
+    } // namespace impl
 
     template <typename Simd_t, typename Scalar_t>
     struct neon_traits {
@@ -79,6 +247,94 @@ namespace sd {
         using vector_t = int32x4_t;
     };
 
+    template <typename Simd_t, typename Scalar_t>
+    struct neon8_traits {
+        using simd_t = Simd_t;
+        using scalar_t = Scalar_t;
+        using vec_b = neonb8;
+        using vec_f = void;
+        using vec_u = neonu8;
+        using vec_s = neons8;
+        using mask_t = impl::mask<0xffffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(int32x4_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<neonb8> : neon8_traits<neonb8, bool8_t> {
+        using vector_t = uint8x16_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neonu8> : neon8_traits<neonu8, uint8_t> {
+        using vector_t = uint8x16_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neons8> : neon8_traits<neons8, int8_t> {
+        using vector_t = int8x16_t;
+    };
+
+    template <typename Simd_t, typename Scalar_t>
+    struct neon16_traits {
+        using simd_t = Simd_t;
+        using scalar_t = Scalar_t;
+        using vec_b = neonb16;
+        using vec_f = void;
+        using vec_u = neonu16;
+        using vec_s = neons16;
+        using mask_t = impl::mask<0xffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(int32x4_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<neonb16> : neon16_traits<neonb16, bool16_t> {
+        using vector_t = uint16x8_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neonu16> : neon16_traits<neonu16, uint16_t> {
+        using vector_t = uint16x8_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neons16> : neon16_traits<neons16, int16_t> {
+        using vector_t = int16x8_t;
+    };
+
+#if SIMDEE_ARM64
+    template <typename Simd_t, typename Scalar_t>
+    struct neon64_traits {
+        using simd_t = Simd_t;
+        using scalar_t = Scalar_t;
+        using vec_b = neonb64;
+        using vec_f = neond;
+        using vec_u = neonu64;
+        using vec_s = neons64;
+        using mask_t = impl::mask<0x3U>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(int64x2_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<neonb64> : neon64_traits<neonb64, bool64_t> {
+        using vector_t = uint64x2_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neond> : neon64_traits<neond, double> {
+        using vector_t = float64x2_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neonu64> : neon64_traits<neonu64, uint64_t> {
+        using vector_t = uint64x2_t;
+    };
+
+    template <>
+    struct simd_vector_traits<neons64> : neon64_traits<neons64, int64_t> {
+        using vector_t = int64x2_t;
+    };
+#endif
+
     template <typename Crtp>
     struct neon_base : simd_base<Crtp> {
     protected:
@@ -88,6 +344,8 @@ namespace sd {
         using vector_t = typename simd_base<Crtp>::vector_t;
         using scalar_t = typename simd_base<Crtp>::scalar_t;
         using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
         using simd_base<Crtp>::width;
         using simd_base<Crtp>::self;
 
@@ -98,10 +356,31 @@ namespace sd {
         SIMDEE_BASE_CTOR_TPL(neon_base, expr::interleaved<T>, interleaved_load(r.ptr, r.step))
         SIMDEE_BASE_CTOR(neon_base, storage_t, aligned_load(r.data()))
 
+        template <typename T, typename Init>
+        SIMDEE_INL neon_base(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename T, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename T>
+        SIMDEE_INL neon_base(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename T>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
         SIMDEE_INL void aligned_load(const scalar_t* r) { mm = impl::neon_load(r); }
         SIMDEE_INL void aligned_store(scalar_t* r) const { impl::neon_store(mm, r); }
         SIMDEE_INL void unaligned_load(const scalar_t* r) { mm = impl::neon_load(r); }
         SIMDEE_INL void unaligned_store(scalar_t* r) const { impl::neon_store(mm, r); }
+        SIMDEE_INL void streaming_store(scalar_t* r) const { impl::neon_store(mm, r); }
 
         void interleaved_load(const scalar_t* r, int step) {
             storage_t temp;
@@ -114,6 +393,61 @@ namespace sd {
             impl::neon_store(mm, temp.data());
             for (size_t i = 0; i < width; i++, r += step) { *r = temp[i]; }
         }
+
+        // lanes from count onwards are taken from fill, or left untouched when storing
+        void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            storage_t temp(fill);
+            for (size_t i = 0; i < count && i < width; i++) { temp[i] = r[i]; }
+            mm = impl::neon_load(temp.data());
+        }
+
+        void partial_store(scalar_t* r, std::size_t count) const {
+            storage_t temp;
+            impl::neon_store(mm, temp.data());
+            for (size_t i = 0; i < count && i < width; i++) { r[i] = temp[i]; }
+        }
+
+        void gather_load(const scalar_t* base, const vec_s& idx) {
+            storage_t temp;
+            const typename vec_s::storage_t offsets(idx);
+            for (size_t i = 0; i < width; i++) { temp[i] = base[offsets[i]]; }
+            mm = impl::neon_load(temp.data());
+        }
+
+        void scatter_store(scalar_t* base, const vec_s& idx) const {
+            storage_t temp;
+            const typename vec_s::storage_t offsets(idx);
+            impl::neon_store(mm, temp.data());
+            for (size_t i = 0; i < width; i++) { base[offsets[i]] = temp[i]; }
+        }
+
+        template <typename Op_t>
+        friend const Crtp reduce_rows(const Crtp* rows, Op_t f) {
+            return impl::reduce_rows_tree(rows, f);
+        }
+
+        template <std::size_t... I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I...> idx) {
+            const uint8x16_t i = impl::neon_bytes<sizeof(scalar_t)>::index(idx);
+            const uint8x16_t x = dirty::cast<vector_t, uint8x16_t>(l.data());
+            return dirty::cast<uint8x16_t, vector_t>(impl::neon_table(x, i));
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask> m) {
+            const uint8x16_t x = dirty::cast<vector_t, uint8x16_t>(a.data());
+            const uint8x16_t y = dirty::cast<vector_t, uint8x16_t>(b.data());
+            const uint8x16_t mask = impl::neon_bytes<sizeof(scalar_t)>::mask(m);
+            return dirty::cast<uint8x16_t, vector_t>(vbslq_u8(mask, y, x));
+        }
+
+        // the lanes selected by m moved to the front, or the front lanes moved to the lanes
+        // selected by m, in order; the other lanes are zero
+        friend SIMDEE_INL const Crtp compress(const Crtp& l, mask_t m) {
+            return impl::neon_pack<sizeof(scalar_t), false>::apply(l, m.value);
+        }
+        friend SIMDEE_INL const Crtp expand(const Crtp& l, mask_t m) {
+            return impl::neon_pack<sizeof(scalar_t), true>::apply(l, m.value);
+        }
     };
 
 // clang-format off
@@ -124,10 +458,13 @@ SIMDEE_TRIVIAL_TYPE( CLASS )
 SIMDEE_CTOR( CLASS , scalar_t, mm = vmovq_n_ ## SUFFIX ( SCALAR_TYPE (r)))                               \
 SIMDEE_CTOR_TPL( CLASS, expr::init<T>, mm = vmovq_n_ ## SUFFIX (r.template to< SCALAR_TYPE >()))         \
 SIMDEE_UNOP( CLASS, scalar_t, first_scalar, vgetq_lane_ ## SUFFIX (l.mm, 0))                             \
+SIMDEE_BINOP( CLASS, CLASS, interleave_lo, vzipq_ ## SUFFIX (l.mm, r.mm).val[0])                         \
+SIMDEE_BINOP( CLASS, CLASS, interleave_hi, vzipq_ ## SUFFIX (l.mm, r.mm).val[1])                         \
                                                                                                          \
 SIMDEE_INL CLASS (scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3) {                                  \
     vector_t v = { v0, v1, v2, v3 };                                                                     \
     mm = v;                                                                                              \
+    SIMDEE_ISA_NAMESPACE_END
 }                                                                                                        \
                                                                                                          \
 template <typename Op_t>                                                                                 \
@@ -139,6 +476,63 @@ friend const CLASS reduce(const CLASS & l, Op_t f) {
 SIMDEE_NEON_OPTIMIZED_REDUCE(CLASS, SUFFIX)                                                              \
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_NEON_NARROW_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                          \
+using neon_base::neon_base;                                                                              \
+SIMDEE_TRIVIAL_TYPE( CLASS )                                                                             \
+SIMDEE_BINOP( CLASS, CLASS, interleave_lo, vzipq_ ## SUFFIX (l.mm, r.mm).val[0])                         \
+SIMDEE_BINOP( CLASS, CLASS, interleave_hi, vzipq_ ## SUFFIX (l.mm, r.mm).val[1])                         \
+SIMDEE_CTOR( CLASS , scalar_t, mm = vmovq_n_ ## SUFFIX (impl::neon_lane(r)))                             \
+SIMDEE_CTOR_TPL( CLASS, expr::init<T>, mm = vmovq_n_ ## SUFFIX (r.template to< SCALAR_TYPE >()))         \
+SIMDEE_UNOP( CLASS, scalar_t, first_scalar,                                                              \
+             (dirty::cast<SCALAR_TYPE, scalar_t>(vgetq_lane_ ## SUFFIX (l.mm, 0))))                      \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_NEON8_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                                \
+SIMDEE_NEON_NARROW_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                                  \
+                                                                                                         \
+SIMDEE_INL CLASS (scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3, scalar_t v4, scalar_t v5,          \
+                  scalar_t v6, scalar_t v7, scalar_t v8, scalar_t v9, scalar_t v10, scalar_t v11,        \
+                  scalar_t v12, scalar_t v13, scalar_t v14, scalar_t v15) {                              \
+    vector_t v = {impl::neon_lane(v0), impl::neon_lane(v1), impl::neon_lane(v2),                         \
+                  impl::neon_lane(v3), impl::neon_lane(v4), impl::neon_lane(v5),                         \
+                  impl::neon_lane(v6), impl::neon_lane(v7), impl::neon_lane(v8),                         \
+                  impl::neon_lane(v9), impl::neon_lane(v10), impl::neon_lane(v11),                       \
+                  impl::neon_lane(v12), impl::neon_lane(v13), impl::neon_lane(v14),                      \
+                  impl::neon_lane(v15)};                                                                 \
+    mm = v;                                                                                              \
+}                                                                                                        \
+                                                                                                         \
+template <typename Op_t>                                                                                 \
+friend const CLASS reduce(const CLASS & l, Op_t f) {                                                     \
+    CLASS tmp = f(l, vextq_ ## SUFFIX (l.mm, l.mm, 8));                                                  \
+    tmp = f(tmp, vextq_ ## SUFFIX (tmp.mm, tmp.mm, 4));                                                  \
+    tmp = f(tmp, vextq_ ## SUFFIX (tmp.mm, tmp.mm, 2));                                                  \
+    return f(tmp, vextq_ ## SUFFIX (tmp.mm, tmp.mm, 1));                                                 \
+}                                                                                                        \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_NEON16_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                               \
+SIMDEE_NEON_NARROW_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                                  \
+                                                                                                         \
+SIMDEE_INL CLASS (scalar_t v0, scalar_t v1, scalar_t v2, scalar_t v3, scalar_t v4, scalar_t v5,          \
+                  scalar_t v6, scalar_t v7) {                                                            \
+    vector_t v = {impl::neon_lane(v0), impl::neon_lane(v1), impl::neon_lane(v2),                         \
+                  impl::neon_lane(v3), impl::neon_lane(v4), impl::neon_lane(v5),                         \
+                  impl::neon_lane(v6), impl::neon_lane(v7)};                                             \
+    mm = v;                                                                                              \
+}                                                                                                        \
+                                                                                                         \
+template <typename Op_t>                                                                                 \
+friend const CLASS reduce(const CLASS & l, Op_t f) {                                                     \
+    CLASS tmp = f(l, vextq_ ## SUFFIX (l.mm, l.mm, 4));                                                  \
+    tmp = f(tmp, vextq_ ## SUFFIX (tmp.mm, tmp.mm, 2));                                                  \
+    return f(tmp, vextq_ ## SUFFIX (tmp.mm, tmp.mm, 1));                                                 \
+}                                                                                                        \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if SIMDEE_ARM64
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 #define SIMDEE_NEON_OPTIMIZED_REDUCE( CLASS, SUFFIX )                                                    \
@@ -157,6 +551,28 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
     return vpmaxq_ ## SUFFIX (tmp.mm, tmp.mm);                                                           \
 }                                                                                                        \
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_NEON64_COMMON( CLASS, SUFFIX, SCALAR_TYPE )                                               \
+using neon_base::neon_base;                                                                              \
+SIMDEE_TRIVIAL_TYPE( CLASS )                                                                             \
+SIMDEE_BINOP( CLASS, CLASS, interleave_lo, vzip1q_ ## SUFFIX (l.mm, r.mm))                               \
+SIMDEE_BINOP( CLASS, CLASS, interleave_hi, vzip2q_ ## SUFFIX (l.mm, r.mm))                               \
+SIMDEE_CTOR( CLASS , scalar_t, mm = vmovq_n_ ## SUFFIX (impl::neon_lane(r)))                            \
+SIMDEE_CTOR_TPL( CLASS, expr::init<T>, mm = vmovq_n_ ## SUFFIX (r.template to< SCALAR_TYPE >()))         \
+SIMDEE_UNOP( CLASS, scalar_t, first_scalar,                                                              \
+             (dirty::cast<SCALAR_TYPE, scalar_t>(vgetq_lane_ ## SUFFIX (l.mm, 0))))                      \
+                                                                                                         \
+SIMDEE_INL CLASS (scalar_t v0, scalar_t v1) {                                                            \
+    vector_t v = { impl::neon_lane(v0), impl::neon_lane(v1) };                                           \
+    mm = v;                                                                                              \
+}                                                                                                        \
+                                                                                                         \
+template <typename Op_t>                                                                                 \
+friend const CLASS reduce(const CLASS & l, Op_t f) {                                                     \
+    return f(l, vextq_ ## SUFFIX (l.mm, l.mm, 1));                                                       \
+}                                                                                                        \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
 #else
 #define SIMDEE_NEON_OPTIMIZED_REDUCE( CLASS, SUFFIX )
 #endif // clang-format on
@@ -193,6 +609,7 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
     struct neonf final : neon_base<neonf> {
         SIMDEE_NEON_COMMON(neonf, f32, float)
         SIMDEE_INL explicit neonf(const neons&);
+        SIMDEE_INL explicit neonf(const neonu&);
 
         SIMDEE_BINOP(neonf, neonb, operator<, vcltq_f32(l.mm, r.mm))
         SIMDEE_BINOP(neonf, neonb, operator>, vcgtq_f32(l.mm, r.mm))
@@ -250,12 +667,35 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
         }
 
         SIMDEE_UNOP(neonf, neonf, abs, vabsq_f32(l.mm))
+
+#if SIMDEE_ARM64
+        SIMDEE_UNOP(neonf, neonf, floor, vrndmq_f32(l.mm))
+        SIMDEE_UNOP(neonf, neonf, ceil, vrndpq_f32(l.mm))
+        SIMDEE_UNOP(neonf, neonf, trunc, vrndq_f32(l.mm))
+        SIMDEE_UNOP(neonf, neonf, round, vrndaq_f32(l.mm))
+#else
+        SIMDEE_UNOP(neonf, neonf, floor, impl::floor_emulated(l))
+        SIMDEE_UNOP(neonf, neonf, ceil, impl::ceil_emulated(l))
+        SIMDEE_UNOP(neonf, neonf, trunc, impl::trunc_emulated(l))
+        SIMDEE_UNOP(neonf, neonf, round, impl::round_away(l, trunc(l)))
+#endif
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(neonf, neonf, fma, vfmaq_f32(r.mm, l.mm, m.mm))
+        SIMDEE_TRIOP(neonf, neonf, fms, vnegq_f32(vfmsq_f32(r.mm, l.mm, m.mm)))
+        SIMDEE_TRIOP(neonf, neonf, fnma, vfmsq_f32(r.mm, l.mm, m.mm))
+#else
+        SIMDEE_TRIOP(neonf, neonf, fma, vmlaq_f32(r.mm, l.mm, m.mm))
+        SIMDEE_TRIOP(neonf, neonf, fms, vnegq_f32(vmlsq_f32(r.mm, l.mm, m.mm)))
+        SIMDEE_TRIOP(neonf, neonf, fnma, vmlsq_f32(r.mm, l.mm, m.mm))
+#endif
     };
 
     struct neonu final : neon_base<neonu> {
         SIMDEE_NEON_COMMON(neonu, u32, uint32_t)
         SIMDEE_INL explicit neonu(const neonb&);
         SIMDEE_INL explicit neonu(const neons&);
+        SIMDEE_INL explicit neonu(const neonf&);
         SIMDEE_CTOR(neonu, not_neonu, mm = vmvnq_u32(r.neg.mm))
 
 #if SIMDEE_NEED_INT
@@ -274,6 +714,11 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
         SIMDEE_BINOP(neonu, neonu, operator+, vaddq_u32(l.mm, r.mm))
         SIMDEE_BINOP(neonu, neonu, operator-, vsubq_u32(l.mm, r.mm))
         SIMDEE_BINOP(neonu, neonu, operator*, vmulq_u32(l.mm, r.mm))
+        SIMDEE_SHIFTOP(neonu, operator<<, vshlq_u32(l.mm, impl::neon_shift_count(r)))
+        SIMDEE_SHIFTOP(neonu, operator>>, vshlq_u32(l.mm, vnegq_s32(impl::neon_shift_count(r))))
+        SIMDEE_BINOP(neonu, neonu, operator<<, vshlq_u32(l.mm, impl::neon_shift_count(r.mm)))
+        SIMDEE_BINOP(neonu, neonu, operator>>,
+                     vshlq_u32(l.mm, vnegq_s32(impl::neon_shift_count(r.mm))))
         SIMDEE_BINOP(neonu, neonu, min, vminq_u32(l.mm, r.mm))
         SIMDEE_BINOP(neonu, neonu, max, vmaxq_u32(l.mm, r.mm))
 #endif
@@ -300,17 +745,306 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
         SIMDEE_BINOP(neons, neons, operator+, vaddq_s32(l.mm, r.mm))
         SIMDEE_BINOP(neons, neons, operator-, vsubq_s32(l.mm, r.mm))
         SIMDEE_BINOP(neons, neons, operator*, vmulq_s32(l.mm, r.mm))
+        SIMDEE_SHIFTOP(neons, operator<<, vshlq_s32(l.mm, impl::neon_shift_count(r)))
+        SIMDEE_SHIFTOP(neons, operator>>, vshlq_s32(l.mm, vnegq_s32(impl::neon_shift_count(r))))
+        SIMDEE_BINOP(neons, neons, operator<<,
+                     vshlq_s32(l.mm, impl::neon_shift_count(vreinterpretq_u32_s32(r.mm))))
+        SIMDEE_BINOP(neons, neons, operator>>,
+                     vshlq_s32(l.mm,
+                               vnegq_s32(impl::neon_shift_count(vreinterpretq_u32_s32(r.mm)))))
         SIMDEE_BINOP(neons, neons, min, vminq_s32(l.mm, r.mm))
         SIMDEE_BINOP(neons, neons, max, vmaxq_s32(l.mm, r.mm))
         SIMDEE_UNOP(neons, neons, abs, vabsq_s32(l.mm))
 #endif
     };
 
+    struct neonb8 final : neon_base<neonb8> {
+        SIMDEE_NEON8_COMMON(neonb8, u8, uint8_t)
+        SIMDEE_CTOR(neonb8, not_neonb8, mm = vmvnq_u8(r.neg.mm))
+
+        SIMDEE_BINOP(neonb8, neonb8, operator==, vceqq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonb8, neonb8, operator!=, vmvnq_u8(vceqq_u8(l.mm, r.mm)))
+        SIMDEE_BINOP(neonb8, neonb8, operator&&, vandq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonb8, neonb8, operator||, vorrq_u8(l.mm, r.mm))
+        SIMDEE_UNOP(neonb8, not_neonb8, operator!, not_neonb8(l))
+
+        friend const mask_t mask(const neonb8& l) {
+            const uint8x16_t bits = {0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80,
+                                     0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
+            uint8x16_t temp = vandq_u8(bits, l.mm);
+            uint8x8_t temp2 = vpadd_u8(vget_low_u8(temp), vget_high_u8(temp));
+            temp2 = vpadd_u8(temp2, temp2);
+            temp2 = vpadd_u8(temp2, temp2);
+            return mask_t(uint32_t(vget_lane_u8(temp2, 0)) |
+                          (uint32_t(vget_lane_u8(temp2, 1)) << 8));
+        }
+    };
+
+    struct neonu8 final : neon_base<neonu8> {
+        SIMDEE_NEON8_COMMON(neonu8, u8, uint8_t)
+        SIMDEE_INL explicit neonu8(const neonb8&);
+        SIMDEE_INL explicit neonu8(const neons8&);
+        SIMDEE_CTOR(neonu8, not_neonu8, mm = vmvnq_u8(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neonu8, neonb8, operator<, vcltq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonb8, operator>, vcgtq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonb8, operator<=, vcleq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonb8, operator>=, vcgeq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonb8, operator==, vceqq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonb8, operator!=, vmvnq_u8(vceqq_u8(l.mm, r.mm)))
+        SIMDEE_BINOP(neonu8, neonu8, operator&, vandq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, operator|, vorrq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, operator^, veorq_u8(l.mm, r.mm))
+        SIMDEE_UNOP(neonu8, not_neonu8, operator~, not_neonu8(l))
+        SIMDEE_UNOP(neonu8, neonu8, operator-,
+                    vreinterpretq_u8_s8(vnegq_s8(vreinterpretq_s8_u8(l.mm))))
+        SIMDEE_BINOP(neonu8, neonu8, operator+, vaddq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, operator-, vsubq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, operator*, vmulq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, min, vminq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, max, vmaxq_u8(l.mm, r.mm))
+
+        SIMDEE_BINOP(neonu8, neonu8, add_sat, vqaddq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, sub_sat, vqsubq_u8(l.mm, r.mm))
+        SIMDEE_BINOP(neonu8, neonu8, avg, vrhaddq_u8(l.mm, r.mm))
+#endif
+    };
+
+    struct neons8 final : neon_base<neons8> {
+        SIMDEE_NEON8_COMMON(neons8, s8, int8_t)
+        SIMDEE_INL explicit neons8(const neonu8&);
+        SIMDEE_CTOR(neons8, not_neons8, mm = vmvnq_s8(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neons8, neonb8, operator<, vcltq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neonb8, operator>, vcgtq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neonb8, operator<=, vcleq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neonb8, operator>=, vcgeq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neonb8, operator==, vceqq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neonb8, operator!=, vmvnq_u8(vceqq_s8(l.mm, r.mm)))
+        SIMDEE_BINOP(neons8, neons8, operator&, vandq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, operator|, vorrq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, operator^, veorq_s8(l.mm, r.mm))
+        SIMDEE_UNOP(neons8, not_neons8, operator~, not_neons8(l))
+        SIMDEE_UNOP(neons8, neons8, operator-, vnegq_s8(l.mm))
+        SIMDEE_BINOP(neons8, neons8, operator+, vaddq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, operator-, vsubq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, operator*, vmulq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, min, vminq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, max, vmaxq_s8(l.mm, r.mm))
+        SIMDEE_UNOP(neons8, neons8, abs, vabsq_s8(l.mm))
+
+        SIMDEE_BINOP(neons8, neons8, add_sat, vqaddq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, sub_sat, vqsubq_s8(l.mm, r.mm))
+        SIMDEE_BINOP(neons8, neons8, avg, vrhaddq_s8(l.mm, r.mm))
+#endif
+    };
+
+    struct neonb16 final : neon_base<neonb16> {
+        SIMDEE_NEON16_COMMON(neonb16, u16, uint16_t)
+        SIMDEE_CTOR(neonb16, not_neonb16, mm = vmvnq_u16(r.neg.mm))
+
+        SIMDEE_BINOP(neonb16, neonb16, operator==, vceqq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonb16, neonb16, operator!=, vmvnq_u16(vceqq_u16(l.mm, r.mm)))
+        SIMDEE_BINOP(neonb16, neonb16, operator&&, vandq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonb16, neonb16, operator||, vorrq_u16(l.mm, r.mm))
+        SIMDEE_UNOP(neonb16, not_neonb16, operator!, not_neonb16(l))
+
+        friend const mask_t mask(const neonb16& l) {
+            const uint16x8_t bits = {0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
+            uint16x8_t temp = vandq_u16(bits, l.mm);
+            uint16x4_t temp2 = vpadd_u16(vget_low_u16(temp), vget_high_u16(temp));
+            temp2 = vpadd_u16(temp2, temp2);
+            temp2 = vpadd_u16(temp2, temp2);
+            return mask_t(uint32_t(vget_lane_u16(temp2, 0)));
+        }
+    };
+
+    struct neonu16 final : neon_base<neonu16> {
+        SIMDEE_NEON16_COMMON(neonu16, u16, uint16_t)
+        SIMDEE_INL explicit neonu16(const neonb16&);
+        SIMDEE_INL explicit neonu16(const neons16&);
+        SIMDEE_CTOR(neonu16, not_neonu16, mm = vmvnq_u16(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neonu16, neonb16, operator<, vcltq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonb16, operator>, vcgtq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonb16, operator<=, vcleq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonb16, operator>=, vcgeq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonb16, operator==, vceqq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonb16, operator!=, vmvnq_u16(vceqq_u16(l.mm, r.mm)))
+        SIMDEE_BINOP(neonu16, neonu16, operator&, vandq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, operator|, vorrq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, operator^, veorq_u16(l.mm, r.mm))
+        SIMDEE_UNOP(neonu16, not_neonu16, operator~, not_neonu16(l))
+        SIMDEE_UNOP(neonu16, neonu16, operator-,
+                    vreinterpretq_u16_s16(vnegq_s16(vreinterpretq_s16_u16(l.mm))))
+        SIMDEE_BINOP(neonu16, neonu16, operator+, vaddq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, operator-, vsubq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, operator*, vmulq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, min, vminq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, max, vmaxq_u16(l.mm, r.mm))
+
+        SIMDEE_BINOP(neonu16, neonu16, add_sat, vqaddq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, sub_sat, vqsubq_u16(l.mm, r.mm))
+        SIMDEE_BINOP(neonu16, neonu16, avg, vrhaddq_u16(l.mm, r.mm))
+#endif
+    };
+
+    struct neons16 final : neon_base<neons16> {
+        SIMDEE_NEON16_COMMON(neons16, s16, int16_t)
+        SIMDEE_INL explicit neons16(const neonu16&);
+        SIMDEE_CTOR(neons16, not_neons16, mm = vmvnq_s16(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neons16, neonb16, operator<, vcltq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neonb16, operator>, vcgtq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neonb16, operator<=, vcleq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neonb16, operator>=, vcgeq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neonb16, operator==, vceqq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neonb16, operator!=, vmvnq_u16(vceqq_s16(l.mm, r.mm)))
+        SIMDEE_BINOP(neons16, neons16, operator&, vandq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, operator|, vorrq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, operator^, veorq_s16(l.mm, r.mm))
+        SIMDEE_UNOP(neons16, not_neons16, operator~, not_neons16(l))
+        SIMDEE_UNOP(neons16, neons16, operator-, vnegq_s16(l.mm))
+        SIMDEE_BINOP(neons16, neons16, operator+, vaddq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, operator-, vsubq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, operator*, vmulq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, min, vminq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, max, vmaxq_s16(l.mm, r.mm))
+        SIMDEE_UNOP(neons16, neons16, abs, vabsq_s16(l.mm))
+
+        SIMDEE_BINOP(neons16, neons16, add_sat, vqaddq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, sub_sat, vqsubq_s16(l.mm, r.mm))
+        SIMDEE_BINOP(neons16, neons16, avg, vrhaddq_s16(l.mm, r.mm))
+#endif
+    };
+
+#if SIMDEE_ARM64
+    struct neonb64 final : neon_base<neonb64> {
+        SIMDEE_NEON64_COMMON(neonb64, u64, uint64_t)
+        SIMDEE_CTOR(neonb64, not_neonb64, mm = impl::neon_not(r.neg.mm))
+
+        SIMDEE_BINOP(neonb64, neonb64, operator==, vceqq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonb64, neonb64, operator!=, impl::neon_not(vceqq_u64(l.mm, r.mm)))
+        SIMDEE_BINOP(neonb64, neonb64, operator&&, vandq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonb64, neonb64, operator||, vorrq_u64(l.mm, r.mm))
+        SIMDEE_UNOP(neonb64, not_neonb64, operator!, not_neonb64(l))
+
+        friend const mask_t mask(const neonb64& l) {
+            uint64x2_t temp = {0x1, 0x2};
+            temp = vandq_u64(temp, l.mm);
+            temp = vpaddq_u64(temp, temp);
+            return mask_t(uint32_t(vgetq_lane_u64(temp, 0)));
+        }
+    };
+
+    struct neond final : neon_base<neond> {
+        SIMDEE_NEON64_COMMON(neond, f64, double)
+        SIMDEE_INL explicit neond(const neons64&);
+
+        SIMDEE_BINOP(neond, neonb64, operator<, vcltq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neonb64, operator>, vcgtq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neonb64, operator<=, vcleq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neonb64, operator>=, vcgeq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neonb64, operator==, vceqq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neonb64, operator!=, impl::neon_not(vceqq_f64(l.mm, r.mm)))
+
+        SIMDEE_UNOP(neond, neond, operator-, vnegq_f64(l.mm))
+        SIMDEE_BINOP(neond, neond, operator+, vaddq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neond, operator-, vsubq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neond, operator*, vmulq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neond, operator/, vdivq_f64(l.mm, r.mm))
+
+        SIMDEE_BINOP(neond, neond, min, vminq_f64(l.mm, r.mm))
+        SIMDEE_BINOP(neond, neond, max, vmaxq_f64(l.mm, r.mm))
+        SIMDEE_UNOP(neond, neond, sqrt, vsqrtq_f64(l.mm))
+        SIMDEE_UNOP(neond, neond, rsqrt, vdivq_f64(vmovq_n_f64(1.), vsqrtq_f64(l.mm)))
+        SIMDEE_UNOP(neond, neond, rcp, vdivq_f64(vmovq_n_f64(1.), l.mm))
+        SIMDEE_UNOP(neond, neond, abs, vabsq_f64(l.mm))
+        SIMDEE_UNOP(neond, neond, floor, vrndmq_f64(l.mm))
+        SIMDEE_UNOP(neond, neond, ceil, vrndpq_f64(l.mm))
+        SIMDEE_UNOP(neond, neond, trunc, vrndq_f64(l.mm))
+        SIMDEE_UNOP(neond, neond, round, vrndaq_f64(l.mm))
+        SIMDEE_TRIOP(neond, neond, fma, vfmaq_f64(r.mm, l.mm, m.mm))
+        SIMDEE_TRIOP(neond, neond, fms, vnegq_f64(vfmsq_f64(r.mm, l.mm, m.mm)))
+        SIMDEE_TRIOP(neond, neond, fnma, vfmsq_f64(r.mm, l.mm, m.mm))
+    };
+
+    struct neonu64 final : neon_base<neonu64> {
+        SIMDEE_NEON64_COMMON(neonu64, u64, uint64_t)
+        SIMDEE_INL explicit neonu64(const neonb64&);
+        SIMDEE_INL explicit neonu64(const neons64&);
+        SIMDEE_CTOR(neonu64, not_neonu64, mm = impl::neon_not(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neonu64, neonb64, operator<, vcltq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonb64, operator>, vcgtq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonb64, operator<=, vcleq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonb64, operator>=, vcgeq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonb64, operator==, vceqq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonb64, operator!=, impl::neon_not(vceqq_u64(l.mm, r.mm)))
+        SIMDEE_BINOP(neonu64, neonu64, operator&, vandq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonu64, operator|, vorrq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonu64, operator^, veorq_u64(l.mm, r.mm))
+        SIMDEE_UNOP(neonu64, not_neonu64, operator~, not_neonu64(l))
+        SIMDEE_UNOP(neonu64, neonu64, operator-,
+                    vreinterpretq_u64_s64(vnegq_s64(vreinterpretq_s64_u64(l.mm))))
+        SIMDEE_BINOP(neonu64, neonu64, operator+, vaddq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonu64, operator-, vsubq_u64(l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonu64, min, vbslq_u64(vcltq_u64(l.mm, r.mm), l.mm, r.mm))
+        SIMDEE_BINOP(neonu64, neonu64, max, vbslq_u64(vcgtq_u64(l.mm, r.mm), l.mm, r.mm))
+
+        // there is no 64-bit vector multiply in NEON
+        SIMDEE_INL friend const neonu64 operator*(const neonu64& l, const neonu64& r) {
+            return neonu64(vgetq_lane_u64(l.mm, 0) * vgetq_lane_u64(r.mm, 0),
+                           vgetq_lane_u64(l.mm, 1) * vgetq_lane_u64(r.mm, 1));
+        }
+#endif
+    };
+
+    struct neons64 final : neon_base<neons64> {
+        SIMDEE_NEON64_COMMON(neons64, s64, int64_t)
+        SIMDEE_INL explicit neons64(const neond&);
+        SIMDEE_INL explicit neons64(const neonu64&);
+        SIMDEE_CTOR(neons64, not_neons64, mm = impl::neon_not(r.neg.mm))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(neons64, neonb64, operator<, vcltq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neonb64, operator>, vcgtq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neonb64, operator<=, vcleq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neonb64, operator>=, vcgeq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neonb64, operator==, vceqq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neonb64, operator!=, impl::neon_not(vceqq_s64(l.mm, r.mm)))
+        SIMDEE_BINOP(neons64, neons64, operator&, vandq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neons64, operator|, vorrq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neons64, operator^, veorq_s64(l.mm, r.mm))
+        SIMDEE_UNOP(neons64, not_neons64, operator~, not_neons64(l))
+        SIMDEE_UNOP(neons64, neons64, operator-, vnegq_s64(l.mm))
+        SIMDEE_BINOP(neons64, neons64, operator+, vaddq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neons64, operator-, vsubq_s64(l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neons64, min, vbslq_s64(vcltq_s64(l.mm, r.mm), l.mm, r.mm))
+        SIMDEE_BINOP(neons64, neons64, max, vbslq_s64(vcgtq_s64(l.mm, r.mm), l.mm, r.mm))
+        SIMDEE_UNOP(neons64, neons64, abs, vabsq_s64(l.mm))
+
+        // there is no 64-bit vector multiply in NEON
+        SIMDEE_INL friend const neons64 operator*(const neons64& l, const neons64& r) {
+            return neons64(vgetq_lane_s64(l.mm, 0) * vgetq_lane_s64(r.mm, 0),
+                           vgetq_lane_s64(l.mm, 1) * vgetq_lane_s64(r.mm, 1));
+        }
+#endif
+    };
+#endif
+
     SIMDEE_INL neonf::neonf(const neons& r) { mm = vcvtq_f32_s32(r.data()); }
     SIMDEE_INL neons::neons(const neonf& r) { mm = vcvtq_s32_f32(r.data()); }
     SIMDEE_INL neonu::neonu(const neonb& r) { mm = r.data(); }
     SIMDEE_INL neonu::neonu(const neons& r) { mm = vreinterpretq_u32_s32(r.data()); }
     SIMDEE_INL neons::neons(const neonu& r) { mm = vreinterpretq_s32_u32(r.data()); }
+    SIMDEE_INL neonf::neonf(const neonu& r) { mm = vcvtq_f32_u32(r.data()); }
+    SIMDEE_INL neonu::neonu(const neonf& r) { mm = vcvtq_u32_f32(r.data()); }
 
     SIMDEE_INL const neonb cond(const neonb& pred, const neonb& if_true, const neonb& if_false) {
         return vbslq_u32(pred.data(), if_true.data(), if_false.data());
@@ -328,6 +1062,105 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
         return vbslq_s32(pred.data(), if_true.data(), if_false.data());
     }
 
+    // conversion to int, rounding to the nearest integer with ties to even
+    SIMDEE_INL const neons to_int_round(const neonf& l) {
+#if SIMDEE_ARM64
+        return vcvtnq_s32_f32(l.data());
+#else
+        return neons(impl::nearest_emulated(l));
+#endif
+    }
+
+    SIMDEE_INL neonu8::neonu8(const neonb8& r) { mm = r.data(); }
+    SIMDEE_INL neonu8::neonu8(const neons8& r) { mm = vreinterpretq_u8_s8(r.data()); }
+    SIMDEE_INL neons8::neons8(const neonu8& r) { mm = vreinterpretq_s8_u8(r.data()); }
+
+    SIMDEE_INL neonu16::neonu16(const neonb16& r) { mm = r.data(); }
+    SIMDEE_INL neonu16::neonu16(const neons16& r) { mm = vreinterpretq_u16_s16(r.data()); }
+    SIMDEE_INL neons16::neons16(const neonu16& r) { mm = vreinterpretq_s16_u16(r.data()); }
+
+#if SIMDEE_NEED_INT
+    SIMDEE_INL const neonu16 widen_lo(const neonu8& l) { return vmovl_u8(vget_low_u8(l.data())); }
+    SIMDEE_INL const neonu16 widen_hi(const neonu8& l) { return vmovl_u8(vget_high_u8(l.data())); }
+    SIMDEE_INL const neons16 widen_lo(const neons8& l) { return vmovl_s8(vget_low_s8(l.data())); }
+    SIMDEE_INL const neons16 widen_hi(const neons8& l) { return vmovl_s8(vget_high_s8(l.data())); }
+    SIMDEE_INL const neonu widen_lo(const neonu16& l) { return vmovl_u16(vget_low_u16(l.data())); }
+    SIMDEE_INL const neonu widen_hi(const neonu16& l) { return vmovl_u16(vget_high_u16(l.data())); }
+    SIMDEE_INL const neons widen_lo(const neons16& l) { return vmovl_s16(vget_low_s16(l.data())); }
+    SIMDEE_INL const neons widen_hi(const neons16& l) { return vmovl_s16(vget_high_s16(l.data())); }
+
+    SIMDEE_INL const neonu8 narrow(const neonu16& lo, const neonu16& hi) {
+        return vcombine_u8(vqmovn_u16(lo.data()), vqmovn_u16(hi.data()));
+    }
+    SIMDEE_INL const neons8 narrow(const neons16& lo, const neons16& hi) {
+        return vcombine_s8(vqmovn_s16(lo.data()), vqmovn_s16(hi.data()));
+    }
+    SIMDEE_INL const neonu16 narrow(const neonu& lo, const neonu& hi) {
+        return vcombine_u16(vqmovn_u32(lo.data()), vqmovn_u32(hi.data()));
+    }
+    SIMDEE_INL const neons16 narrow(const neons& lo, const neons& hi) {
+        return vcombine_s16(vqmovn_s32(lo.data()), vqmovn_s32(hi.data()));
+    }
+#endif
+
+    SIMDEE_INL const neonb8 cond(const neonb8& pred, const neonb8& if_true,
+                                 const neonb8& if_false) {
+        return vbslq_u8(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neonu8 cond(const neonb8& pred, const neonu8& if_true,
+                                 const neonu8& if_false) {
+        return vbslq_u8(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neons8 cond(const neonb8& pred, const neons8& if_true,
+                                 const neons8& if_false) {
+        return vbslq_s8(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neonb16 cond(const neonb16& pred, const neonb16& if_true,
+                                  const neonb16& if_false) {
+        return vbslq_u16(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neonu16 cond(const neonb16& pred, const neonu16& if_true,
+                                  const neonu16& if_false) {
+        return vbslq_u16(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neons16 cond(const neonb16& pred, const neons16& if_true,
+                                  const neons16& if_false) {
+        return vbslq_s16(pred.data(), if_true.data(), if_false.data());
+    }
+
+#if SIMDEE_ARM64
+    SIMDEE_INL neond::neond(const neons64& r) { mm = vcvtq_f64_s64(r.data()); }
+    SIMDEE_INL neons64::neons64(const neond& r) { mm = vcvtq_s64_f64(r.data()); }
+    SIMDEE_INL neonu64::neonu64(const neonb64& r) { mm = r.data(); }
+    SIMDEE_INL neonu64::neonu64(const neons64& r) { mm = vreinterpretq_u64_s64(r.data()); }
+    SIMDEE_INL neons64::neons64(const neonu64& r) { mm = vreinterpretq_s64_u64(r.data()); }
+
+    SIMDEE_INL const neonb64 cond(const neonb64& pred, const neonb64& if_true,
+                                  const neonb64& if_false) {
+        return vbslq_u64(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neond cond(const neonb64& pred, const neond& if_true,
+                                const neond& if_false) {
+        return vbslq_f64(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neonu64 cond(const neonb64& pred, const neonu64& if_true,
+                                  const neonu64& if_false) {
+        return vbslq_u64(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const neons64 cond(const neonb64& pred, const neons64& if_true,
+                                  const neons64& if_false) {
+        return vbslq_s64(pred.data(), if_true.data(), if_false.data());
+    }
+#endif
+
     namespace impl {
 
         template <typename T>
@@ -359,6 +1192,142 @@ SIMDEE_INL friend const CLASS reduce(const CLASS & l, op_max) {
             }
         };
 
+        template <typename T>
+        struct neonbu8_special_ops {
+            SIMDEE_INL static T andnot(const T& l, const T& r) {
+                return vbicq_u8(l.data(), r.data());
+            }
+            SIMDEE_INL static T ornot(const T& l, const T& r) {
+                return vornq_u8(l.data(), r.data());
+            }
+        };
+
+        template <>
+        struct special_ops<neonb8> : neonbu8_special_ops<neonb8> {};
+
+        template <>
+        struct special_ops<neonu8> : neonbu8_special_ops<neonu8> {};
+
+        template <>
+        struct special_ops<neons8> {
+            SIMDEE_INL static neons8 andnot(const neons8& l, const neons8& r) {
+                return vbicq_s8(l.data(), r.data());
+            }
+            SIMDEE_INL static neons8 ornot(const neons8& l, const neons8& r) {
+                return vornq_s8(l.data(), r.data());
+            }
+        };
+
+        template <typename T>
+        struct neonbu16_special_ops {
+            SIMDEE_INL static T andnot(const T& l, const T& r) {
+                return vbicq_u16(l.data(), r.data());
+            }
+            SIMDEE_INL static T ornot(const T& l, const T& r) {
+                return vornq_u16(l.data(), r.data());
+            }
+        };
+
+        template <>
+        struct special_ops<neonb16> : neonbu16_special_ops<neonb16> {};
+
+        template <>
+        struct special_ops<neonu16> : neonbu16_special_ops<neonu16> {};
+
+        template <>
+        struct special_ops<neons16> {
+            SIMDEE_INL static neons16 andnot(const neons16& l, const neons16& r) {
+                return vbicq_s16(l.data(), r.data());
+            }
+            SIMDEE_INL static neons16 ornot(const neons16& l, const neons16& r) {
+                return vornq_s16(l.data(), r.data());
+            }
+        };
+
+#if SIMDEE_ARM64
+        template <typename T>
+        struct neonbu64_special_ops {
+            SIMDEE_INL static T andnot(const T& l, const T& r) {
+                return vbicq_u64(l.data(), r.data());
+            }
+            SIMDEE_INL static T ornot(const T& l, const T& r) {
+                return vornq_u64(l.data(), r.data());
+            }
+        };
+
+        template <>
+        struct special_ops<neonb64> : neonbu64_special_ops<neonb64> {};
+
+        template <>
+        struct special_ops<neonu64> : neonbu64_special_ops<neonu64> {};
+
+        template <>
+        struct special_ops<neons64> {
+            SIMDEE_INL static neons64 andnot(const neons64& l, const neons64& r) {
+                return vbicq_s64(l.data(), r.data());
+            }
+            SIMDEE_INL static neons64 ornot(const neons64& l, const neons64& r) {
+                return vornq_s64(l.data(), r.data());
+            }
+        };
+#endif
+
+        // vldNq and vstNq transpose two to four channels as part of the load or store
+        template <std::size_t N, typename Simd_t, typename Load, typename Store>
+        struct neon_channels {
+            using scalar_t = typename Simd_t::scalar_t;
+
+            SIMDEE_INL static void load(const scalar_t* ptr, Simd_t* out) {
+                const auto v = Load()(ptr);
+                auto copy = [&](std::size_t c) { out[c] = v.val[c]; };
+                static_for<N>::apply(copy);
+            }
+            SIMDEE_INL static void store(scalar_t* ptr, const Simd_t* in) {
+                decltype(Load()(ptr)) v;
+                auto copy = [&](std::size_t c) { v.val[c] = in[c].data(); };
+                static_for<N>::apply(copy);
+                Store()(ptr, v);
+            }
+        };
+
+#define SIMDEE_NEON_CHANNELS(N, SIMD, SUFFIX)                                                      \
+    struct neon_load##N##_##SUFFIX {                                                               \
+        template <typename T>                                                                      \
+        SIMDEE_INL auto operator()(const T* ptr) const -> decltype(vld##N##q_##SUFFIX(ptr)) {      \
+            return vld##N##q_##SUFFIX(ptr);                                                        \
+        }                                                                                          \
+    };                                                                                             \
+    struct neon_store##N##_##SUFFIX {                                                              \
+        template <typename T, typename V>                                                          \
+        SIMDEE_INL void operator()(T* ptr, const V& v) const {                                     \
+            vst##N##q_##SUFFIX(ptr, v);                                                            \
+        }                                                                                          \
+    };                                                                                             \
+    template <>                                                                                    \
+    struct channels<N, SIMD>                                                                       \
+        : neon_channels<N, SIMD, neon_load##N##_##SUFFIX, neon_store##N##_##SUFFIX> {}
+
+#define SIMDEE_NEON_CHANNELS_234(SIMD, SUFFIX)                                                     \
+    SIMDEE_NEON_CHANNELS(2, SIMD, SUFFIX);                                                         \
+    SIMDEE_NEON_CHANNELS(3, SIMD, SUFFIX);                                                         \
+    SIMDEE_NEON_CHANNELS(4, SIMD, SUFFIX)
+
+        SIMDEE_NEON_CHANNELS_234(neonf, f32);
+        SIMDEE_NEON_CHANNELS_234(neonu, u32);
+        SIMDEE_NEON_CHANNELS_234(neons, s32);
+        SIMDEE_NEON_CHANNELS_234(neonu8, u8);
+        SIMDEE_NEON_CHANNELS_234(neons8, s8);
+        SIMDEE_NEON_CHANNELS_234(neonu16, u16);
+        SIMDEE_NEON_CHANNELS_234(neons16, s16);
+#if SIMDEE_ARM64
+        SIMDEE_NEON_CHANNELS_234(neond, f64);
+        SIMDEE_NEON_CHANNELS_234(neonu64, u64);
+        SIMDEE_NEON_CHANNELS_234(neons64, s64);
+#endif
+
+#undef SIMDEE_NEON_CHANNELS_234
+#undef SIMDEE_NEON_CHANNELS
+
     } // namespace impl
 
 } // namespace sd
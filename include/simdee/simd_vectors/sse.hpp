@@ -20,7 +20,16 @@
 #include <smmintrin.h>
 #endif
 
+#if SIMDEE_SSE42
+#include <nmmintrin.h>
+#endif
+
+#if SIMDEE_AVX
+#include <immintrin.h>
+#endif
+
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     namespace impl {
 #if SIMDEE_SSE41
         SIMDEE_INL __m128 sse_cond(__m128 pred, __m128 if_true, __m128 if_false) {
@@ -39,15 +48,447 @@ namespace sd {
             return _mm_or_si128(prod_a, prod_b);
         }
 #endif
+
+#if SIMDEE_SSE41
+        SIMDEE_INL __m128i sse_cmpeq_epi64(__m128i l, __m128i r) { return _mm_cmpeq_epi64(l, r); }
+#else
+        SIMDEE_INL __m128i sse_cmpeq_epi64(__m128i l, __m128i r) {
+            __m128i eq32 = _mm_cmpeq_epi32(l, r);
+            return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+#endif
+
+#if SIMDEE_SSE42
+        SIMDEE_INL __m128i sse_cmpgt_epi64(__m128i l, __m128i r) { return _mm_cmpgt_epi64(l, r); }
+#else
+        SIMDEE_INL __m128i sse_cmpgt_epi64(__m128i l, __m128i r) {
+            // when the high halves are equal, the sign of (r - l) decides
+            __m128i res = _mm_and_si128(_mm_cmpeq_epi32(l, r), _mm_sub_epi64(r, l));
+            res = _mm_or_si128(res, _mm_cmpgt_epi32(l, r));
+            return _mm_shuffle_epi32(res, _MM_SHUFFLE(3, 3, 1, 1));
+        }
+#endif
+
+        SIMDEE_INL __m128i sse_cmpgt_epu64(__m128i l, __m128i r) {
+            __m128i low = _mm_set1_epi64x(int64_t(0x8000000000000000ULL));
+            return sse_cmpgt_epi64(_mm_xor_si128(l, low), _mm_xor_si128(r, low));
+        }
+
+        SIMDEE_INL __m128i sse_imul64(__m128i l, __m128i r) {
+            __m128i lolo = _mm_mul_epu32(l, r);
+            __m128i cross = _mm_add_epi64(_mm_mul_epu32(l, _mm_srli_epi64(r, 32)),
+                                          _mm_mul_epu32(_mm_srli_epi64(l, 32), r));
+            return _mm_add_epi64(lolo, _mm_slli_epi64(cross, 32));
+        }
+
+        // shift each 32-bit lane of x by the count in the same lane of n
+#if SIMDEE_AVX2
+        SIMDEE_INL __m128i sse_sllv(__m128i x, __m128i n) { return _mm_sllv_epi32(x, n); }
+        SIMDEE_INL __m128i sse_srlv(__m128i x, __m128i n) { return _mm_srlv_epi32(x, n); }
+        SIMDEE_INL __m128i sse_srav(__m128i x, __m128i n) { return _mm_srav_epi32(x, n); }
+#else
+        // four shifts by a scalar count, one for each lane, then pick the lanes back together
+        template <typename Shift>
+        SIMDEE_INL __m128i sse_shift_lanes(__m128i x, __m128i n, Shift shift) {
+            const __m128i lo = _mm_setr_epi32(-1, 0, 0, 0);
+            const __m128 s0 = _mm_castsi128_ps(shift(x, _mm_and_si128(n, lo)));
+            const __m128 s1 = _mm_castsi128_ps(shift(x, _mm_srli_epi64(n, 32)));
+            const __m128 s2 = _mm_castsi128_ps(shift(x, _mm_and_si128(_mm_srli_si128(n, 8), lo)));
+            const __m128 s3 = _mm_castsi128_ps(shift(x, _mm_srli_si128(n, 12)));
+            const __m128 s01 = _mm_movelh_ps(s0, s1);
+            const __m128 s23 = _mm_movehl_ps(s3, s2);
+            return _mm_castps_si128(_mm_shuffle_ps(s01, s23, _MM_SHUFFLE(3, 0, 3, 0)));
+        }
+        SIMDEE_INL __m128i sse_sllv(__m128i x, __m128i n) {
+            return sse_shift_lanes(x, n, [](__m128i v, __m128i c) { return _mm_sll_epi32(v, c); });
+        }
+        SIMDEE_INL __m128i sse_srlv(__m128i x, __m128i n) {
+            return sse_shift_lanes(x, n, [](__m128i v, __m128i c) { return _mm_srl_epi32(v, c); });
+        }
+        SIMDEE_INL __m128i sse_srav(__m128i x, __m128i n) {
+            return sse_shift_lanes(x, n, [](__m128i v, __m128i c) { return _mm_sra_epi32(v, c); });
+        }
+#endif
+
+        // unsigned integers to floats: both 16-bit halves convert exactly, and the sum is rounded
+        // only once
+        SIMDEE_INL __m128 sse_cvtepu32_ps(__m128i x) {
+            const __m128 hi = _mm_cvtepi32_ps(_mm_srli_epi32(x, 16));
+            const __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(0xffff)));
+            return _mm_add_ps(_mm_mul_ps(hi, _mm_set1_ps(65536.f)), lo);
+        }
+
+        // floats in [0, 2^32) to unsigned integers, truncating; values of at least 2^31 are
+        // moved to the signed range first and get their top bit back afterwards
+        SIMDEE_INL __m128i sse_cvttps_epu32(__m128 x) {
+            const __m128 two31 = _mm_set1_ps(2147483648.f);
+            const __m128 big = _mm_cmpge_ps(x, two31);
+            const __m128i r = _mm_cvttps_epi32(_mm_sub_ps(x, _mm_and_ps(big, two31)));
+            return _mm_xor_si128(r, _mm_slli_epi32(_mm_castps_si128(big), 31));
+        }
+
+        SIMDEE_INL __m128 sse_set1(float r) { return _mm_set_ps1(r); }
+        SIMDEE_INL __m128 sse_set1(double r) { return _mm_castpd_ps(_mm_set1_pd(r)); }
+        SIMDEE_INL __m128 sse_set1(bool8_t r) {
+            return _mm_castsi128_ps(_mm_set1_epi8(char(uint8_t(r))));
+        }
+        SIMDEE_INL __m128 sse_set1(uint8_t r) { return _mm_castsi128_ps(_mm_set1_epi8(char(r))); }
+        SIMDEE_INL __m128 sse_set1(int8_t r) { return _mm_castsi128_ps(_mm_set1_epi8(char(r))); }
+        SIMDEE_INL __m128 sse_set1(bool16_t r) {
+            return _mm_castsi128_ps(_mm_set1_epi16(int16_t(r)));
+        }
+        SIMDEE_INL __m128 sse_set1(uint16_t r) {
+            return _mm_castsi128_ps(_mm_set1_epi16(int16_t(r)));
+        }
+        SIMDEE_INL __m128 sse_set1(int16_t r) { return _mm_castsi128_ps(_mm_set1_epi16(r)); }
+        template <typename T>
+        SIMDEE_INL __m128 sse_set1(T r) {
+            return sse_set1(dirty::as_f(r));
+        }
+
+        // blend that works with masks of any lane width
+#if SIMDEE_SSE41
+        SIMDEE_INL __m128 sse_cond_bytes(__m128 pred, __m128 if_true, __m128 if_false) {
+            return _mm_castsi128_ps(_mm_blendv_epi8(
+                _mm_castps_si128(if_false), _mm_castps_si128(if_true), _mm_castps_si128(pred)));
+        }
+#else
+        SIMDEE_INL __m128 sse_cond_bytes(__m128 pred, __m128 if_true, __m128 if_false) {
+            return sse_cond(pred, if_true, if_false);
+        }
+#endif
+
+        SIMDEE_INL __m128i sse_mullo_epi8(__m128i l, __m128i r) {
+            // multiply even and odd bytes separately, in 16-bit lanes
+            __m128i even = _mm_mullo_epi16(l, r);
+            __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(l, 8), _mm_srli_epi16(r, 8));
+            return _mm_or_si128(_mm_slli_epi16(odd, 8),
+                                _mm_and_si128(even, _mm_set1_epi16(0xff)));
+        }
+
+        SIMDEE_INL __m128i sse_cmpgt_epu8(__m128i l, __m128i r) {
+            __m128i low = _mm_set1_epi8(char(0x80));
+            return _mm_cmpgt_epi8(_mm_xor_si128(l, low), _mm_xor_si128(r, low));
+        }
+
+        SIMDEE_INL __m128i sse_cmpgt_epu16(__m128i l, __m128i r) {
+            __m128i low = _mm_set1_epi16(int16_t(0x8000));
+            return _mm_cmpgt_epi16(_mm_xor_si128(l, low), _mm_xor_si128(r, low));
+        }
+
+#if SIMDEE_SSE41
+        SIMDEE_INL __m128i sse_min_epi8(__m128i l, __m128i r) { return _mm_min_epi8(l, r); }
+        SIMDEE_INL __m128i sse_max_epi8(__m128i l, __m128i r) { return _mm_max_epi8(l, r); }
+        SIMDEE_INL __m128i sse_min_epu16(__m128i l, __m128i r) { return _mm_min_epu16(l, r); }
+        SIMDEE_INL __m128i sse_max_epu16(__m128i l, __m128i r) { return _mm_max_epu16(l, r); }
+#else
+        SIMDEE_INL __m128i sse_min_epi8(__m128i l, __m128i r) {
+            __m128i gt = _mm_cmpgt_epi8(l, r);
+            return _mm_or_si128(_mm_and_si128(gt, r), _mm_andnot_si128(gt, l));
+        }
+        SIMDEE_INL __m128i sse_max_epi8(__m128i l, __m128i r) {
+            __m128i gt = _mm_cmpgt_epi8(l, r);
+            return _mm_or_si128(_mm_and_si128(gt, l), _mm_andnot_si128(gt, r));
+        }
+        SIMDEE_INL __m128i sse_min_epu16(__m128i l, __m128i r) {
+            return _mm_sub_epi16(l, _mm_subs_epu16(l, r));
+        }
+        SIMDEE_INL __m128i sse_max_epu16(__m128i l, __m128i r) {
+            return _mm_add_epi16(r, _mm_subs_epu16(l, r));
+        }
+#endif
+
+#if SIMDEE_SSSE3
+        SIMDEE_INL __m128i sse_abs_epi8(__m128i l) { return _mm_abs_epi8(l); }
+        SIMDEE_INL __m128i sse_abs_epi16(__m128i l) { return _mm_abs_epi16(l); }
+#else
+        SIMDEE_INL __m128i sse_abs_epi8(__m128i l) {
+            return _mm_min_epu8(l, _mm_sub_epi8(_mm_setzero_si128(), l));
+        }
+        SIMDEE_INL __m128i sse_abs_epi16(__m128i l) {
+            return _mm_max_epi16(l, _mm_sub_epi16(_mm_setzero_si128(), l));
+        }
+#endif
+
+        // rounding average of signed lanes, shifted into the unsigned range and back
+        SIMDEE_INL __m128i sse_avg_epi8(__m128i l, __m128i r) {
+            __m128i low = _mm_set1_epi8(char(0x80));
+            return _mm_xor_si128(
+                _mm_avg_epu8(_mm_xor_si128(l, low), _mm_xor_si128(r, low)), low);
+        }
+        SIMDEE_INL __m128i sse_avg_epi16(__m128i l, __m128i r) {
+            __m128i low = _mm_set1_epi16(int16_t(0x8000));
+            return _mm_xor_si128(
+                _mm_avg_epu16(_mm_xor_si128(l, low), _mm_xor_si128(r, low)), low);
+        }
+
+        // swaps neighbouring groups of Bytes bytes
+        template <std::size_t Bytes>
+        struct sse_swap;
+        template <>
+        struct sse_swap<1> {
+            SIMDEE_INL static __m128 apply(__m128 l) {
+                __m128i i = _mm_castps_si128(l);
+                return _mm_castsi128_ps(_mm_or_si128(_mm_slli_epi16(i, 8), _mm_srli_epi16(i, 8)));
+            }
+        };
+        template <>
+        struct sse_swap<2> {
+            SIMDEE_INL static __m128 apply(__m128 l) {
+                __m128i i = _mm_castps_si128(l);
+                i = _mm_shufflelo_epi16(i, _MM_SHUFFLE(2, 3, 0, 1));
+                return _mm_castsi128_ps(_mm_shufflehi_epi16(i, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        };
+        template <>
+        struct sse_swap<4> {
+            SIMDEE_INL static __m128 apply(__m128 l) {
+                return _mm_castsi128_ps(
+                    _mm_shuffle_epi32(_mm_castps_si128(l), _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        };
+        template <>
+        struct sse_swap<8> {
+            SIMDEE_INL static __m128 apply(__m128 l) {
+                return _mm_castsi128_ps(
+                    _mm_shuffle_epi32(_mm_castps_si128(l), _MM_SHUFFLE(1, 0, 3, 2)));
+            }
+        };
+
+        template <std::size_t Bytes>
+        struct sse_reduce {
+            template <typename Simd_t, typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, Op_t f) {
+                Simd_t tmp = f(l, Simd_t(sse_swap<Bytes>::apply(l.data())));
+                return sse_reduce<Bytes * 2>::apply(tmp, f);
+            }
+        };
+        template <>
+        struct sse_reduce<16> {
+            template <typename Simd_t, typename Op_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, Op_t) {
+                return l;
+            }
+        };
+        // constant byte vectors for lanes of Bytes bytes: the shuffle index that moves lane I_j
+        // to lane j, and the mask that selects the lanes set in Mask
+        template <std::size_t Bytes, typename K = typename make_lanes<16>::type>
+        struct sse_bytes;
+        template <std::size_t Bytes, std::size_t... K>
+        struct sse_bytes<Bytes, lanes<K...>> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m128i index(lanes<I...>) {
+                return _mm_setr_epi8(char(lane_at(K / Bytes, I...) * Bytes + K % Bytes)...);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m128 mask(lane_mask<Mask>) {
+                return _mm_castsi128_ps(
+                    _mm_setr_epi8(char(((Mask >> (K / Bytes)) & 1) ? -1 : 0)...));
+            }
+        };
+
+        // permutation of lanes of any width through pshufb, or through memory without SSSE3
+        template <std::size_t Bytes, std::size_t... I>
+        SIMDEE_INL __m128 sse_shuffle_bytes(__m128 l, lanes<I...> idx) {
+#if SIMDEE_SSSE3
+            const __m128i i = sse_bytes<Bytes>::index(idx);
+            return _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(l), i));
+#else
+            alignas(16) uint8_t src[16], dst[16];
+            _mm_store_ps(reinterpret_cast<float*>(src), l);
+            const std::size_t at[] = {I...};
+            for (std::size_t k = 0; k < 16; ++k) {
+                dst[k] = src[at[k / Bytes] * Bytes + k % Bytes];
+            }
+            (void)idx;
+            return _mm_load_ps(reinterpret_cast<const float*>(dst));
+#endif
+        }
+
+        // lane permutations, blends and interleaves with the best instruction for the lane width
+        template <std::size_t Bytes>
+        struct sse_lanes;
+        template <>
+        struct sse_lanes<1> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m128 shuffle(__m128 l, lanes<I...> idx) {
+                return sse_shuffle_bytes<1>(l, idx);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m128 blend(__m128 a, __m128 b, lane_mask<Mask> m) {
+                return sse_cond_bytes(sse_bytes<1>::mask(m), b, a);
+            }
+            SIMDEE_INL static __m128 unpacklo(__m128 a, __m128 b) {
+                return _mm_castsi128_ps(
+                    _mm_unpacklo_epi8(_mm_castps_si128(a), _mm_castps_si128(b)));
+            }
+            SIMDEE_INL static __m128 unpackhi(__m128 a, __m128 b) {
+                return _mm_castsi128_ps(
+                    _mm_unpackhi_epi8(_mm_castps_si128(a), _mm_castps_si128(b)));
+            }
+        };
+        template <>
+        struct sse_lanes<2> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m128 shuffle(__m128 l, lanes<I...> idx) {
+                return sse_shuffle_bytes<2>(l, idx);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m128 blend(__m128 a, __m128 b, lane_mask<Mask> m) {
+#if SIMDEE_SSE41
+                (void)m;
+                return _mm_castsi128_ps(
+                    _mm_blend_epi16(_mm_castps_si128(a), _mm_castps_si128(b), int(Mask)));
+#else
+                return sse_cond(sse_bytes<2>::mask(m), b, a);
+#endif
+            }
+            SIMDEE_INL static __m128 unpacklo(__m128 a, __m128 b) {
+                return _mm_castsi128_ps(
+                    _mm_unpacklo_epi16(_mm_castps_si128(a), _mm_castps_si128(b)));
+            }
+            SIMDEE_INL static __m128 unpackhi(__m128 a, __m128 b) {
+                return _mm_castsi128_ps(
+                    _mm_unpackhi_epi16(_mm_castps_si128(a), _mm_castps_si128(b)));
+            }
+        };
+        template <>
+        struct sse_lanes<4> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m128 shuffle(__m128 l, lanes<I...>) {
+                constexpr int imm = int(lane_at(0, I...) | lane_at(1, I...) << 2 |
+                                        lane_at(2, I...) << 4 | lane_at(3, I...) << 6);
+                return _mm_shuffle_ps(l, l, imm);
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m128 blend(__m128 a, __m128 b, lane_mask<Mask> m) {
+#if SIMDEE_SSE41
+                (void)m;
+                return _mm_blend_ps(a, b, int(Mask));
+#else
+                return sse_cond(sse_bytes<4>::mask(m), b, a);
+#endif
+            }
+            SIMDEE_INL static __m128 unpacklo(__m128 a, __m128 b) { return _mm_unpacklo_ps(a, b); }
+            SIMDEE_INL static __m128 unpackhi(__m128 a, __m128 b) { return _mm_unpackhi_ps(a, b); }
+        };
+        template <>
+        struct sse_lanes<8> {
+            template <std::size_t... I>
+            SIMDEE_INL static __m128 shuffle(__m128 l, lanes<I...>) {
+                constexpr int imm = int(lane_at(0, I...) | lane_at(1, I...) << 1);
+                const __m128d d = _mm_castps_pd(l);
+                return _mm_castpd_ps(_mm_shuffle_pd(d, d, imm));
+            }
+            template <std::uint64_t Mask>
+            SIMDEE_INL static __m128 blend(__m128 a, __m128 b, lane_mask<Mask> m) {
+#if SIMDEE_SSE41
+                (void)m;
+                return _mm_castpd_ps(_mm_blend_pd(_mm_castps_pd(a), _mm_castps_pd(b), int(Mask)));
+#else
+                return sse_cond(sse_bytes<8>::mask(m), b, a);
+#endif
+            }
+            SIMDEE_INL static __m128 unpacklo(__m128 a, __m128 b) {
+                return _mm_castpd_ps(_mm_unpacklo_pd(_mm_castps_pd(a), _mm_castps_pd(b)));
+            }
+            SIMDEE_INL static __m128 unpackhi(__m128 a, __m128 b) {
+                return _mm_castpd_ps(_mm_unpackhi_pd(_mm_castps_pd(a), _mm_castps_pd(b)));
+            }
+        };
+
+#if SIMDEE_AVX
+        SIMDEE_INL __m128i sse_tail_mask(std::size_t bytes) {
+            return _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(tail_mask<>::bytes + (32 - bytes)));
+        }
+#endif
+
+        template <std::size_t Size>
+        struct sse_gather : std::false_type {};
+#if SIMDEE_AVX2
+        // masked gathers with a zeroed source, see avx_gather
+        template <>
+        struct sse_gather<4> : std::true_type {
+            SIMDEE_INL static __m128 gather(const void* base, __m128i idx) {
+                const __m128 all = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                return _mm_mask_i32gather_ps(_mm_setzero_ps(), static_cast<const float*>(base),
+                                             idx, all, 4);
+            }
+            SIMDEE_INL static __m128 load(const void* base, __m128 idx) {
+                return gather(base, _mm_castps_si128(idx));
+            }
+            SIMDEE_INL static __m128 interleaved_load(const void* base, int step) {
+                const __m128i iota = _mm_setr_epi32(0, 1, 2, 3);
+                return gather(base, _mm_mullo_epi32(_mm_set1_epi32(step), iota));
+            }
+        };
+        template <>
+        struct sse_gather<8> : std::true_type {
+            SIMDEE_INL static __m128d all() { return _mm_castsi128_pd(_mm_set1_epi32(-1)); }
+            SIMDEE_INL static __m128 load(const void* base, __m128 idx) {
+                return _mm_castpd_ps(_mm_mask_i64gather_pd(_mm_setzero_pd(),
+                                                           static_cast<const double*>(base),
+                                                           _mm_castps_si128(idx), all(), 8));
+            }
+            SIMDEE_INL static __m128 interleaved_load(const void* base, int step) {
+                const __m128i idx = _mm_setr_epi32(0, step, 0, 0);
+                return _mm_castpd_ps(_mm_mask_i32gather_pd(
+                    _mm_setzero_pd(), static_cast<const double*>(base), idx, all(), 8));
+            }
+        };
+#endif
+
+        // compress and expand with a pshufb table; 8-bit lanes would need 65536 rows and go
+        // through memory, as does everything without SSSE3
+        template <std::size_t Bytes, bool Expand>
+        struct sse_pack {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+#if SIMDEE_SSSE3
+                const __m128i i = _mm_load_si128(
+                    reinterpret_cast<const __m128i*>(pack_bytes<Bytes, Expand>::row(m)));
+                return Simd_t(_mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(l.data()), i)));
+#else
+                return pack_fallback<Expand>(l, m);
+#endif
+            }
+        };
+        template <bool Expand>
+        struct sse_pack<1, Expand> {
+            template <typename Simd_t>
+            SIMDEE_INL static const Simd_t apply(const Simd_t& l, std::uint64_t m) {
+                return pack_fallback<Expand>(l, m);
+            }
+        };
     } // namespace impl
 
     struct sseb;
     struct ssef;
     struct sseu;
     struct sses;
+    struct sseb64;
+    struct ssed;
+    struct sseu64;
+    struct sses64;
     using not_sseb = expr::deferred_lognot<sseb>;
     using not_sseu = expr::deferred_bitnot<sseu>;
     using not_sses = expr::deferred_bitnot<sses>;
+    using not_sseb64 = expr::deferred_lognot<sseb64>;
+    using not_sseu64 = expr::deferred_bitnot<sseu64>;
+    using not_sses64 = expr::deferred_bitnot<sses64>;
+    struct sseb8;
+    struct sseu8;
+    struct sses8;
+    struct sseb16;
+    struct sseu16;
+    struct sses16;
+    using not_sseb8 = expr::deferred_lognot<sseb8>;
+    using not_sseu8 = expr::deferred_bitnot<sseu8>;
+    using not_sses8 = expr::deferred_bitnot<sses8>;
+    using not_sseb16 = expr::deferred_lognot<sseb16>;
+    using not_sseu16 = expr::deferred_bitnot<sseu16>;
+    using not_sses16 = expr::deferred_bitnot<sses16>;
 
     template <>
     struct is_simd_vector<sseb> : std::integral_constant<bool, true> {};
@@ -57,6 +498,32 @@ namespace sd {
     struct is_simd_vector<sseu> : std::integral_constant<bool, true> {};
     template <>
     struct is_simd_vector<sses> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseb64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<ssed> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseu64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sses64> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseb8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseu8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sses8> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseb16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sseu16> : std::integral_constant<bool, true> {};
+    template <>
+    struct is_simd_vector<sses16> : std::integral_constant<bool, true> {};
+
+    namespace impl {
+        // _mm_rcp_ps and _mm_rsqrt_ps are accurate to 12 bits
+        template <>
+        struct refine_steps<ssef> : std::integral_constant<int, 1> {};
+    } // namespace impl
 
     template <typename Simd_t, typename Scalar_t>
     struct sse_traits {
@@ -80,23 +547,88 @@ namespace sd {
     template <>
     struct simd_vector_traits<sses> : sse_traits<sses, int32_t> {};
 
+    template <typename Simd_t, typename Scalar_t>
+    struct sse64_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m128;
+        using scalar_t = Scalar_t;
+        using vec_b = sseb64;
+        using vec_f = ssed;
+        using vec_u = sseu64;
+        using vec_s = sses64;
+        using mask_t = impl::mask<0x3U>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<sseb64> : sse64_traits<sseb64, bool64_t> {};
+    template <>
+    struct simd_vector_traits<ssed> : sse64_traits<ssed, double> {};
+    template <>
+    struct simd_vector_traits<sseu64> : sse64_traits<sseu64, uint64_t> {};
+    template <>
+    struct simd_vector_traits<sses64> : sse64_traits<sses64, int64_t> {};
+
+    template <typename Simd_t, typename Scalar_t>
+    struct sse8_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m128;
+        using scalar_t = Scalar_t;
+        using vec_b = sseb8;
+        using vec_f = void;
+        using vec_u = sseu8;
+        using vec_s = sses8;
+        using mask_t = impl::mask<0xffffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<sseb8> : sse8_traits<sseb8, bool8_t> {};
+    template <>
+    struct simd_vector_traits<sseu8> : sse8_traits<sseu8, uint8_t> {};
+    template <>
+    struct simd_vector_traits<sses8> : sse8_traits<sses8, int8_t> {};
+
+    template <typename Simd_t, typename Scalar_t>
+    struct sse16_traits {
+        using simd_t = Simd_t;
+        using vector_t = __m128;
+        using scalar_t = Scalar_t;
+        using vec_b = sseb16;
+        using vec_f = void;
+        using vec_u = sseu16;
+        using vec_s = sses16;
+        using mask_t = impl::mask<0xffU>;
+        using storage_t = impl::storage<simd_t, scalar_t, alignof(vector_t)>;
+    };
+
+    template <>
+    struct simd_vector_traits<sseb16> : sse16_traits<sseb16, bool16_t> {};
+    template <>
+    struct simd_vector_traits<sseu16> : sse16_traits<sseu16, uint16_t> {};
+    template <>
+    struct simd_vector_traits<sses16> : sse16_traits<sses16, int16_t> {};
+
     template <typename Crtp>
     struct sse_base : simd_base<Crtp> {
     protected:
         using simd_base<Crtp>::mm;
         SIMDEE_INL __m128i mmi() const { return _mm_castps_si128(mm); }
+        SIMDEE_INL __m128d mmd() const { return _mm_castps_pd(mm); }
 
     public:
         using vector_t = typename simd_base<Crtp>::vector_t;
         using scalar_t = typename simd_base<Crtp>::scalar_t;
         using storage_t = typename simd_base<Crtp>::storage_t;
+        using vec_s = typename simd_base<Crtp>::vec_s;
+        using mask_t = typename simd_base<Crtp>::mask_t;
         using simd_base<Crtp>::width;
         using simd_base<Crtp>::self;
 
         SIMDEE_TRIVIAL_TYPE(sse_base)
 
         SIMDEE_BASE_CTOR(sse_base, vector_t, mm = r)
-        SIMDEE_BASE_CTOR(sse_base, scalar_t, mm = _mm_set_ps1(reinterpret_cast<const float&>(r)))
+        SIMDEE_BASE_CTOR(sse_base, scalar_t, mm = impl::sse_set1(r))
         SIMDEE_BASE_CTOR_FLAG(sse_base, expr::zero, mm = _mm_setzero_ps())
         SIMDEE_BASE_CTOR_TPL(sse_base, expr::aligned<T>, aligned_load(r.ptr))
         SIMDEE_BASE_CTOR_TPL(sse_base, expr::unaligned<T>, unaligned_load(r.ptr))
@@ -104,6 +636,26 @@ namespace sd {
         SIMDEE_BASE_CTOR_TPL(sse_base, expr::init<T>, *this = r.template to<scalar_t>())
         SIMDEE_BASE_CTOR(sse_base, storage_t, aligned_load(r.data()))
 
+        template <typename T, typename Init>
+        SIMDEE_INL sse_base(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+        }
+        template <typename T, typename Init>
+        SIMDEE_INL Crtp& operator=(const expr::partial<T, Init>& r) {
+            partial_load(r.ptr, r.count, Crtp(r.fill));
+            return self();
+        }
+
+        template <typename T>
+        SIMDEE_INL sse_base(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+        }
+        template <typename T>
+        SIMDEE_INL Crtp& operator=(const expr::indexed<T, vec_s>& r) {
+            gather_load(r.ptr, r.idx);
+            return self();
+        }
+
         SIMDEE_INL sse_base(const expr::all_bits& r) { operator=(r); }
         SIMDEE_INL sse_base& operator=(const expr::all_bits&) {
             mm = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_castps_si128(mm), _mm_castps_si128(mm)));
@@ -122,11 +674,12 @@ namespace sd {
         SIMDEE_INL void unaligned_store(scalar_t* r) const {
             _mm_storeu_ps(reinterpret_cast<float*>(r), mm);
         }
+        SIMDEE_INL void streaming_store(scalar_t* r) const {
+            _mm_stream_ps(reinterpret_cast<float*>(r), mm);
+        }
 
-        void interleaved_load(const scalar_t* r, int step) {
-            alignas(Crtp) scalar_t temp[width];
-            for (std::size_t i = 0; i < width; ++i, r += step) { temp[i] = *r; }
-            aligned_load(temp);
+        SIMDEE_INL void interleaved_load(const scalar_t* r, int step) {
+            interleaved_load(r, step, has_gather{});
         }
 
         void interleaved_store(scalar_t* r, int step) const {
@@ -135,12 +688,107 @@ namespace sd {
             for (std::size_t i = 0; i < width; ++i, r += step) { *r = temp[i]; }
         }
 
+        // lanes from count onwards are taken from fill, or left untouched when storing
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill) {
+            partial_load(r, count < width ? count : std::size_t(width), fill, has_maskload{});
+        }
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count) const {
+            partial_store(r, count < width ? count : std::size_t(width), has_maskload{});
+        }
+
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx) {
+            gather_load(base, idx, has_gather{});
+        }
+
+        void scatter_store(scalar_t* base, const vec_s& idx) const {
+            alignas(Crtp) scalar_t temp[width];
+            const typename vec_s::storage_t offsets(idx);
+            aligned_store(temp);
+            for (std::size_t i = 0; i < width; ++i) { base[offsets[i]] = temp[i]; }
+        }
+
         template <typename Op_t>
         friend const Crtp reduce(const Crtp& l, Op_t f) {
-            Crtp tmp = f(l, _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(l.mm),
-                                                               _MM_SHUFFLE(2, 3, 0, 1))));
-            return f(tmp, _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(tmp.mm),
-                                                             _MM_SHUFFLE(1, 0, 3, 2))));
+            return impl::sse_reduce<sizeof(scalar_t)>::apply(l.self(), f);
+        }
+
+        template <typename Op_t>
+        friend const Crtp reduce_rows(const Crtp* rows, Op_t f) {
+            return impl::reduce_rows_tree(rows, f);
+        }
+
+        template <std::size_t... I>
+        friend SIMDEE_INL const Crtp shuffle(const Crtp& l, impl::lanes<I...> idx) {
+            return impl::sse_lanes<sizeof(scalar_t)>::shuffle(l.data(), idx);
+        }
+        template <std::uint64_t Mask>
+        friend SIMDEE_INL const Crtp blend(const Crtp& a, const Crtp& b, impl::lane_mask<Mask> m) {
+            return impl::sse_lanes<sizeof(scalar_t)>::blend(a.data(), b.data(), m);
+        }
+
+        // the first and the second half of a0, b0, a1, b1, ...
+        friend SIMDEE_INL const Crtp interleave_lo(const Crtp& a, const Crtp& b) {
+            return impl::sse_lanes<sizeof(scalar_t)>::unpacklo(a.data(), b.data());
+        }
+        friend SIMDEE_INL const Crtp interleave_hi(const Crtp& a, const Crtp& b) {
+            return impl::sse_lanes<sizeof(scalar_t)>::unpackhi(a.data(), b.data());
+        }
+
+        // the lanes selected by m moved to the front, or the front lanes moved to the lanes
+        // selected by m, in order; the other lanes are zero
+        friend SIMDEE_INL const Crtp compress(const Crtp& l, mask_t m) {
+            return impl::sse_pack<sizeof(scalar_t), false>::apply(l, m.value);
+        }
+        friend SIMDEE_INL const Crtp expand(const Crtp& l, mask_t m) {
+            return impl::sse_pack<sizeof(scalar_t), true>::apply(l, m.value);
+        }
+
+    private:
+        using has_gather = typename impl::sse_gather<sizeof(scalar_t)>::type;
+        using has_maskload = std::integral_constant<bool, SIMDEE_AVX && (sizeof(scalar_t) >= 4)>;
+
+#if SIMDEE_AVX
+        SIMDEE_INL void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill,
+                                     std::true_type) {
+            const __m128i mask = impl::sse_tail_mask(count * sizeof(scalar_t));
+            const __m128 loaded = _mm_maskload_ps(reinterpret_cast<const float*>(r), mask);
+            mm = _mm_blendv_ps(fill.data(), loaded, _mm_castsi128_ps(mask));
+        }
+        SIMDEE_INL void partial_store(scalar_t* r, std::size_t count, std::true_type) const {
+            const __m128i mask = impl::sse_tail_mask(count * sizeof(scalar_t));
+            _mm_maskstore_ps(reinterpret_cast<float*>(r), mask, mm);
+        }
+#endif
+        // without masked moves, the tail goes through a buffer so that nothing past ptr + count is
+        // ever touched
+        void partial_load(const scalar_t* r, std::size_t count, const Crtp& fill,
+                          std::false_type) {
+            storage_t temp(fill);
+            for (std::size_t i = 0; i < count; ++i) { temp[i] = r[i]; }
+            aligned_load(temp.data());
+        }
+        void partial_store(scalar_t* r, std::size_t count, std::false_type) const {
+            const storage_t temp(self());
+            for (std::size_t i = 0; i < count; ++i) { r[i] = temp[i]; }
+        }
+
+        SIMDEE_INL void interleaved_load(const scalar_t* r, int step, std::true_type) {
+            mm = impl::sse_gather<sizeof(scalar_t)>::interleaved_load(r, step);
+        }
+        void interleaved_load(const scalar_t* r, int step, std::false_type) {
+            alignas(Crtp) scalar_t temp[width];
+            for (std::size_t i = 0; i < width; ++i, r += step) { temp[i] = *r; }
+            aligned_load(temp);
+        }
+
+        SIMDEE_INL void gather_load(const scalar_t* base, const vec_s& idx, std::true_type) {
+            mm = impl::sse_gather<sizeof(scalar_t)>::load(base, idx.data());
+        }
+        void gather_load(const scalar_t* base, const vec_s& idx, std::false_type) {
+            alignas(Crtp) scalar_t temp[width];
+            const typename vec_s::storage_t offsets(idx);
+            for (std::size_t i = 0; i < width; ++i) { temp[i] = base[offsets[i]]; }
+            aligned_load(temp);
         }
     };
 
@@ -173,6 +821,7 @@ namespace sd {
 
         using sse_base::sse_base;
         SIMDEE_INL explicit ssef(const sses&);
+        SIMDEE_INL explicit ssef(const sseu&);
         SIMDEE_INL ssef(float v0, float v1, float v2, float v3) {
             mm = _mm_setr_ps(v0, v1, v2, v3);
         }
@@ -198,6 +847,28 @@ namespace sd {
         SIMDEE_UNOP(ssef, ssef, rsqrt, _mm_rsqrt_ps(l.mm))
         SIMDEE_UNOP(ssef, ssef, rcp, _mm_rcp_ps(l.mm))
         SIMDEE_UNOP(ssef, ssef, abs, _mm_and_ps(l.mm, ssef(abs_mask()).mm))
+
+#if SIMDEE_SSE41
+        SIMDEE_UNOP(ssef, ssef, floor,
+                    _mm_round_ps(l.mm, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(ssef, ssef, ceil, _mm_round_ps(l.mm, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(ssef, ssef, trunc, _mm_round_ps(l.mm, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+#else
+        SIMDEE_UNOP(ssef, ssef, floor, impl::floor_emulated(l))
+        SIMDEE_UNOP(ssef, ssef, ceil, impl::ceil_emulated(l))
+        SIMDEE_UNOP(ssef, ssef, trunc, impl::trunc_emulated(l))
+#endif
+        SIMDEE_UNOP(ssef, ssef, round, impl::round_away(l, trunc(l)))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(ssef, ssef, fma, _mm_fmadd_ps(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(ssef, ssef, fms, _mm_fmsub_ps(l.mm, m.mm, r.mm))
+        SIMDEE_TRIOP(ssef, ssef, fnma, _mm_fnmadd_ps(l.mm, m.mm, r.mm))
+#else
+        SIMDEE_TRIOP(ssef, ssef, fma, _mm_add_ps(_mm_mul_ps(l.mm, m.mm), r.mm))
+        SIMDEE_TRIOP(ssef, ssef, fms, _mm_sub_ps(_mm_mul_ps(l.mm, m.mm), r.mm))
+        SIMDEE_TRIOP(ssef, ssef, fnma, _mm_sub_ps(r.mm, _mm_mul_ps(l.mm, m.mm)))
+#endif
     };
 
     struct sseu : sse_base<sseu> {
@@ -206,6 +877,7 @@ namespace sd {
         using sse_base::sse_base;
         SIMDEE_INL explicit sseu(const sseb&);
         SIMDEE_INL explicit sseu(const sses&);
+        SIMDEE_INL explicit sseu(const ssef&);
         SIMDEE_INL sseu(uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3) {
             mm = _mm_castsi128_ps(
                 _mm_setr_epi32(int32_t(v0), int32_t(v1), int32_t(v2), int32_t(v3)));
@@ -252,6 +924,10 @@ namespace sd {
         SIMDEE_BINOP(sseu, sseu, operator+, _mm_add_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(sseu, sseu, operator-, _mm_sub_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(sseu, sseu, operator*, impl::sse_imul(l.mmi(), r.mmi()))
+        SIMDEE_SHIFTOP(sseu, operator<<, _mm_slli_epi32(l.mmi(), r))
+        SIMDEE_SHIFTOP(sseu, operator>>, _mm_srli_epi32(l.mmi(), r))
+        SIMDEE_BINOP(sseu, sseu, operator<<, impl::sse_sllv(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu, sseu, operator>>, impl::sse_srlv(l.mmi(), r.mmi()))
 #endif
     };
 
@@ -286,6 +962,10 @@ namespace sd {
         SIMDEE_BINOP(sses, sses, operator+, _mm_add_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(sses, sses, operator-, _mm_sub_epi32(l.mmi(), r.mmi()))
         SIMDEE_BINOP(sses, sses, operator*, impl::sse_imul(l.mmi(), r.mmi()))
+        SIMDEE_SHIFTOP(sses, operator<<, _mm_slli_epi32(l.mmi(), r))
+        SIMDEE_SHIFTOP(sses, operator>>, _mm_srai_epi32(l.mmi(), r))
+        SIMDEE_BINOP(sses, sses, operator<<, impl::sse_sllv(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses, sses, operator>>, impl::sse_srav(l.mmi(), r.mmi()))
 
 #if SIMDEE_SSE41
         SIMDEE_BINOP(sses, sses, min, _mm_min_epi32(l.mmi(), r.mmi()))
@@ -305,6 +985,405 @@ namespace sd {
         SIMDEE_UNOP(sses, sses, abs, max(l, -l))
 #endif
 
+#endif
+    };
+
+    struct sseb64 : sse_base<sseb64> {
+        SIMDEE_TRIVIAL_TYPE(sseb64)
+
+        using sse_base::sse_base;
+        SIMDEE_INL sseb64(bool64_t v0, bool64_t v1) {
+            mm = _mm_castsi128_ps(_mm_set_epi64x(int64_t(v1), int64_t(v0)));
+        }
+        SIMDEE_CTOR(sseb64, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseb64, not_sseb64,
+                    mm = _mm_xor_ps(r.neg.mm,
+                                    _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_castps_si128(r.neg.mm),
+                                                                     _mm_castps_si128(r.neg.mm)))))
+
+        SIMDEE_UNOP(sseb64, mask_t, mask, mask_t(cast_u(_mm_movemask_pd(l.mmd()))))
+        SIMDEE_UNOP(sseb64, scalar_t, first_scalar, dirty::as_b(_mm_cvtsd_f64(l.mmd())))
+
+        SIMDEE_BINOP(sseb64, sseb64, operator==, _mm_cmpeq_epi32(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseb64, sseb64, operator!=, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb64, sseb64, operator&&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb64, sseb64, operator||, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseb64, not_sseb64, operator!, not_sseb64(l))
+    };
+
+    struct ssed : sse_base<ssed> {
+        SIMDEE_TRIVIAL_TYPE(ssed)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit ssed(const sses64&);
+        SIMDEE_INL ssed(double v0, double v1) { mm = _mm_castpd_ps(_mm_setr_pd(v0, v1)); }
+        SIMDEE_CTOR(ssed, __m128d, mm = _mm_castpd_ps(r))
+
+        SIMDEE_UNOP(ssed, scalar_t, first_scalar, _mm_cvtsd_f64(l.mmd()))
+
+        SIMDEE_BINOP(ssed, sseb64, operator<, _mm_castpd_ps(_mm_cmplt_pd(l.mmd(), r.mmd())))
+        SIMDEE_BINOP(ssed, sseb64, operator>, _mm_castpd_ps(_mm_cmpgt_pd(l.mmd(), r.mmd())))
+        SIMDEE_BINOP(ssed, sseb64, operator<=, _mm_castpd_ps(_mm_cmple_pd(l.mmd(), r.mmd())))
+        SIMDEE_BINOP(ssed, sseb64, operator>=, _mm_castpd_ps(_mm_cmpge_pd(l.mmd(), r.mmd())))
+        SIMDEE_BINOP(ssed, sseb64, operator==, _mm_castpd_ps(_mm_cmpeq_pd(l.mmd(), r.mmd())))
+        SIMDEE_BINOP(ssed, sseb64, operator!=, _mm_castpd_ps(_mm_cmpneq_pd(l.mmd(), r.mmd())))
+
+        SIMDEE_UNOP(ssed, ssed, operator-, _mm_xor_ps(l.mm, ssed(sign_bit()).mm))
+        SIMDEE_BINOP(ssed, ssed, operator+, _mm_add_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(ssed, ssed, operator-, _mm_sub_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(ssed, ssed, operator*, _mm_mul_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(ssed, ssed, operator/, _mm_div_pd(l.mmd(), r.mmd()))
+
+        SIMDEE_BINOP(ssed, ssed, min, _mm_min_pd(l.mmd(), r.mmd()))
+        SIMDEE_BINOP(ssed, ssed, max, _mm_max_pd(l.mmd(), r.mmd()))
+        SIMDEE_UNOP(ssed, ssed, sqrt, _mm_sqrt_pd(l.mmd()))
+        SIMDEE_UNOP(ssed, ssed, rsqrt, _mm_div_pd(_mm_set1_pd(1.), _mm_sqrt_pd(l.mmd())))
+        SIMDEE_UNOP(ssed, ssed, rcp, _mm_div_pd(_mm_set1_pd(1.), l.mmd()))
+        SIMDEE_UNOP(ssed, ssed, abs, _mm_and_ps(l.mm, ssed(abs_mask()).mm))
+
+#if SIMDEE_SSE41
+        SIMDEE_UNOP(ssed, ssed, floor,
+                    _mm_round_pd(l.mmd(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(ssed, ssed, ceil,
+                    _mm_round_pd(l.mmd(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+        SIMDEE_UNOP(ssed, ssed, trunc,
+                    _mm_round_pd(l.mmd(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+#else
+        SIMDEE_UNOP(ssed, ssed, floor, impl::floor_emulated(l))
+        SIMDEE_UNOP(ssed, ssed, ceil, impl::ceil_emulated(l))
+        SIMDEE_UNOP(ssed, ssed, trunc, impl::trunc_emulated(l))
+#endif
+        SIMDEE_UNOP(ssed, ssed, round, impl::round_away(l, trunc(l)))
+
+#if SIMDEE_FMA
+        SIMDEE_TRIOP(ssed, ssed, fma, _mm_fmadd_pd(l.mmd(), m.mmd(), r.mmd()))
+        SIMDEE_TRIOP(ssed, ssed, fms, _mm_fmsub_pd(l.mmd(), m.mmd(), r.mmd()))
+        SIMDEE_TRIOP(ssed, ssed, fnma, _mm_fnmadd_pd(l.mmd(), m.mmd(), r.mmd()))
+#else
+        SIMDEE_TRIOP(ssed, ssed, fma, _mm_add_pd(_mm_mul_pd(l.mmd(), m.mmd()), r.mmd()))
+        SIMDEE_TRIOP(ssed, ssed, fms, _mm_sub_pd(_mm_mul_pd(l.mmd(), m.mmd()), r.mmd()))
+        SIMDEE_TRIOP(ssed, ssed, fnma, _mm_sub_pd(r.mmd(), _mm_mul_pd(l.mmd(), m.mmd())))
+#endif
+    };
+
+    struct sseu64 : sse_base<sseu64> {
+        SIMDEE_TRIVIAL_TYPE(sseu64)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sseu64(const sseb64&);
+        SIMDEE_INL explicit sseu64(const sses64&);
+        SIMDEE_INL sseu64(uint64_t v0, uint64_t v1) {
+            mm = _mm_castsi128_ps(_mm_set_epi64x(int64_t(v1), int64_t(v0)));
+        }
+        SIMDEE_CTOR(sseu64, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseu64, not_sseu64, mm = _mm_xor_ps(r.neg.mm, sseu64(all_bits()).mm))
+
+        SIMDEE_UNOP(sseu64, scalar_t, first_scalar, dirty::as_u(_mm_cvtsd_f64(l.mmd())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sseu64, sseb64, operator<, impl::sse_cmpgt_epu64(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(sseu64, sseb64, operator>, impl::sse_cmpgt_epu64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu64, not_sseb64, operator<=,
+                     not_sseb64(impl::sse_cmpgt_epu64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sseu64, not_sseb64, operator>=,
+                     not_sseb64(impl::sse_cmpgt_epu64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(sseu64, sseb64, operator==, impl::sse_cmpeq_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu64, not_sseb64, operator!=,
+                     not_sseb64(impl::sse_cmpeq_epi64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sseu64, sseu64, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu64, sseu64, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu64, sseu64, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseu64, not_sseu64, operator~, not_sseu64(l))
+        SIMDEE_UNOP(sseu64, sseu64, operator-, _mm_sub_epi64(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sseu64, sseu64, operator+, _mm_add_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu64, sseu64, operator-, _mm_sub_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu64, sseu64, operator*, impl::sse_imul64(l.mmi(), r.mmi()))
+        SIMDEE_INL friend const sseu64 min(const sseu64& l, const sseu64& r) {
+            return impl::sse_cond(_mm_castsi128_ps(impl::sse_cmpgt_epu64(r.mmi(), l.mmi())), l.mm,
+                                  r.mm);
+        }
+        SIMDEE_INL friend const sseu64 max(const sseu64& l, const sseu64& r) {
+            return impl::sse_cond(_mm_castsi128_ps(impl::sse_cmpgt_epu64(l.mmi(), r.mmi())), l.mm,
+                                  r.mm);
+        }
+#endif
+    };
+
+    struct sses64 : sse_base<sses64> {
+        SIMDEE_TRIVIAL_TYPE(sses64)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sses64(const ssed&);
+        SIMDEE_INL explicit sses64(const sseu64&);
+        SIMDEE_INL sses64(int64_t v0, int64_t v1) { mm = _mm_castsi128_ps(_mm_set_epi64x(v1, v0)); }
+        SIMDEE_CTOR(sses64, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sses64, not_sses64, mm = _mm_xor_ps(r.neg.mm, sses64(all_bits()).mm))
+
+        SIMDEE_UNOP(sses64, scalar_t, first_scalar, dirty::as_s(_mm_cvtsd_f64(l.mmd())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sses64, sseb64, operator<, impl::sse_cmpgt_epi64(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(sses64, sseb64, operator>, impl::sse_cmpgt_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses64, not_sseb64, operator<=,
+                     not_sseb64(impl::sse_cmpgt_epi64(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sses64, not_sseb64, operator>=,
+                     not_sseb64(impl::sse_cmpgt_epi64(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(sses64, sseb64, operator==, impl::sse_cmpeq_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses64, not_sseb64, operator!=,
+                     not_sseb64(impl::sse_cmpeq_epi64(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(sses64, sses64, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses64, sses64, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses64, sses64, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sses64, not_sses64, operator~, not_sses64(l))
+
+        SIMDEE_UNOP(sses64, sses64, operator-, _mm_sub_epi64(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sses64, sses64, operator+, _mm_add_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses64, sses64, operator-, _mm_sub_epi64(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses64, sses64, operator*, impl::sse_imul64(l.mmi(), r.mmi()))
+
+        SIMDEE_INL friend const sses64 min(const sses64& l, const sses64& r) {
+            return impl::sse_cond(_mm_castsi128_ps(impl::sse_cmpgt_epi64(r.mmi(), l.mmi())), l.mm,
+                                  r.mm);
+        }
+        SIMDEE_INL friend const sses64 max(const sses64& l, const sses64& r) {
+            return impl::sse_cond(_mm_castsi128_ps(impl::sse_cmpgt_epi64(l.mmi(), r.mmi())), l.mm,
+                                  r.mm);
+        }
+        SIMDEE_INL friend const sses64 abs(const sses64& l) {
+            __m128i neg = impl::sse_cmpgt_epi64(_mm_setzero_si128(), l.mmi());
+            return _mm_sub_epi64(_mm_xor_si128(l.mmi(), neg), neg);
+        }
+#endif
+    };
+
+    struct sseb8 : sse_base<sseb8> {
+        SIMDEE_TRIVIAL_TYPE(sseb8)
+
+        using sse_base::sse_base;
+        SIMDEE_INL sseb8(bool8_t v0, bool8_t v1, bool8_t v2, bool8_t v3, bool8_t v4, bool8_t v5,
+                         bool8_t v6, bool8_t v7, bool8_t v8, bool8_t v9, bool8_t v10, bool8_t v11,
+                         bool8_t v12, bool8_t v13, bool8_t v14, bool8_t v15) {
+            mm = _mm_castsi128_ps(_mm_setr_epi8(char(uint8_t(v0)), char(uint8_t(v1)),
+                                                char(uint8_t(v2)), char(uint8_t(v3)),
+                                                char(uint8_t(v4)), char(uint8_t(v5)),
+                                                char(uint8_t(v6)), char(uint8_t(v7)),
+                                                char(uint8_t(v8)), char(uint8_t(v9)),
+                                                char(uint8_t(v10)), char(uint8_t(v11)),
+                                                char(uint8_t(v12)), char(uint8_t(v13)),
+                                                char(uint8_t(v14)), char(uint8_t(v15))));
+        }
+        SIMDEE_CTOR(sseb8, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseb8, not_sseb8, mm = _mm_xor_ps(r.neg.mm, sseb8(all_bits()).mm))
+
+        SIMDEE_UNOP(sseb8, mask_t, mask, mask_t(cast_u(_mm_movemask_epi8(l.mmi()))))
+        SIMDEE_UNOP(sseb8, scalar_t, first_scalar,
+                    scalar_t(uint8_t(_mm_cvtsi128_si32(l.mmi()))))
+
+        SIMDEE_BINOP(sseb8, sseb8, operator==, _mm_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseb8, sseb8, operator!=, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb8, sseb8, operator&&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb8, sseb8, operator||, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseb8, not_sseb8, operator!, not_sseb8(l))
+    };
+
+    struct sseu8 : sse_base<sseu8> {
+        SIMDEE_TRIVIAL_TYPE(sseu8)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sseu8(const sseb8&);
+        SIMDEE_INL explicit sseu8(const sses8&);
+        SIMDEE_INL sseu8(uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5,
+                         uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11,
+                         uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) {
+            mm = _mm_castsi128_ps(_mm_setr_epi8(char(v0), char(v1), char(v2), char(v3), char(v4),
+                                                char(v5), char(v6), char(v7), char(v8), char(v9),
+                                                char(v10), char(v11), char(v12), char(v13),
+                                                char(v14), char(v15)));
+        }
+        SIMDEE_CTOR(sseu8, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseu8, not_sseu8, mm = _mm_xor_ps(r.neg.mm, sseu8(all_bits()).mm))
+
+        SIMDEE_UNOP(sseu8, scalar_t, first_scalar, scalar_t(_mm_cvtsi128_si32(l.mmi())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sseu8, not_sseb8, operator<, max(l, r) != l)
+        SIMDEE_BINOP(sseu8, not_sseb8, operator>, max(l, r) != r)
+        SIMDEE_BINOP(sseu8, sseb8, operator<=, max(l, r) == r)
+        SIMDEE_BINOP(sseu8, sseb8, operator>=, max(l, r) == l)
+        SIMDEE_BINOP(sseu8, sseu8, min, _mm_min_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, max, _mm_max_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseb8, operator==, _mm_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, not_sseb8, operator!=, not_sseb8(_mm_cmpeq_epi8(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sseu8, sseu8, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu8, sseu8, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu8, sseu8, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseu8, not_sseu8, operator~, not_sseu8(l))
+        SIMDEE_UNOP(sseu8, sseu8, operator-, _mm_sub_epi8(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, operator+, _mm_add_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, operator-, _mm_sub_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, operator*, impl::sse_mullo_epi8(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(sseu8, sseu8, add_sat, _mm_adds_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, sub_sat, _mm_subs_epu8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu8, sseu8, avg, _mm_avg_epu8(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct sses8 : sse_base<sses8> {
+        SIMDEE_TRIVIAL_TYPE(sses8)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sses8(const sseu8&);
+        SIMDEE_INL sses8(int8_t v0, int8_t v1, int8_t v2, int8_t v3, int8_t v4, int8_t v5,
+                         int8_t v6, int8_t v7, int8_t v8, int8_t v9, int8_t v10, int8_t v11,
+                         int8_t v12, int8_t v13, int8_t v14, int8_t v15) {
+            mm = _mm_castsi128_ps(_mm_setr_epi8(char(v0), char(v1), char(v2), char(v3), char(v4),
+                                                char(v5), char(v6), char(v7), char(v8), char(v9),
+                                                char(v10), char(v11), char(v12), char(v13),
+                                                char(v14), char(v15)));
+        }
+        SIMDEE_CTOR(sses8, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sses8, not_sses8, mm = _mm_xor_ps(r.neg.mm, sses8(all_bits()).mm))
+
+        SIMDEE_UNOP(sses8, scalar_t, first_scalar, scalar_t(_mm_cvtsi128_si32(l.mmi())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sses8, sseb8, operator<, _mm_cmplt_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sseb8, operator>, _mm_cmpgt_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, not_sseb8, operator<=, not_sseb8(_mm_cmpgt_epi8(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sses8, not_sseb8, operator>=, not_sseb8(_mm_cmplt_epi8(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sses8, sseb8, operator==, _mm_cmpeq_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, not_sseb8, operator!=, not_sseb8(_mm_cmpeq_epi8(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(sses8, sses8, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses8, sses8, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses8, sses8, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sses8, not_sses8, operator~, not_sses8(l))
+
+        SIMDEE_UNOP(sses8, sses8, operator-, _mm_sub_epi8(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sses8, sses8, operator+, _mm_add_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sses8, operator-, _mm_sub_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sses8, operator*, impl::sse_mullo_epi8(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(sses8, sses8, min, impl::sse_min_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sses8, max, impl::sse_max_epi8(l.mmi(), r.mmi()))
+        SIMDEE_UNOP(sses8, sses8, abs, impl::sse_abs_epi8(l.mmi()))
+
+        SIMDEE_BINOP(sses8, sses8, add_sat, _mm_adds_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sses8, sub_sat, _mm_subs_epi8(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses8, sses8, avg, impl::sse_avg_epi8(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct sseb16 : sse_base<sseb16> {
+        SIMDEE_TRIVIAL_TYPE(sseb16)
+
+        using sse_base::sse_base;
+        SIMDEE_INL sseb16(bool16_t v0, bool16_t v1, bool16_t v2, bool16_t v3, bool16_t v4,
+                          bool16_t v5, bool16_t v6, bool16_t v7) {
+            mm = _mm_castsi128_ps(_mm_setr_epi16(int16_t(v0), int16_t(v1), int16_t(v2), int16_t(v3),
+                                                 int16_t(v4), int16_t(v5), int16_t(v6),
+                                                 int16_t(v7)));
+        }
+        SIMDEE_CTOR(sseb16, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseb16, not_sseb16, mm = _mm_xor_ps(r.neg.mm, sseb16(all_bits()).mm))
+
+        SIMDEE_UNOP(sseb16, mask_t, mask,
+                    mask_t(cast_u(
+                        _mm_movemask_epi8(_mm_packs_epi16(l.mmi(), _mm_setzero_si128())))))
+        SIMDEE_UNOP(sseb16, scalar_t, first_scalar,
+                    scalar_t(uint16_t(_mm_cvtsi128_si32(l.mmi()))))
+
+        SIMDEE_BINOP(sseb16, sseb16, operator==, _mm_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseb16, sseb16, operator!=, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb16, sseb16, operator&&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseb16, sseb16, operator||, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseb16, not_sseb16, operator!, not_sseb16(l))
+    };
+
+    struct sseu16 : sse_base<sseu16> {
+        SIMDEE_TRIVIAL_TYPE(sseu16)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sseu16(const sseb16&);
+        SIMDEE_INL explicit sseu16(const sses16&);
+        SIMDEE_INL sseu16(uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4,
+                          uint16_t v5, uint16_t v6, uint16_t v7) {
+            mm = _mm_castsi128_ps(_mm_setr_epi16(int16_t(v0), int16_t(v1), int16_t(v2), int16_t(v3),
+                                                 int16_t(v4), int16_t(v5), int16_t(v6),
+                                                 int16_t(v7)));
+        }
+        SIMDEE_CTOR(sseu16, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sseu16, not_sseu16, mm = _mm_xor_ps(r.neg.mm, sseu16(all_bits()).mm))
+
+        SIMDEE_UNOP(sseu16, scalar_t, first_scalar, scalar_t(_mm_cvtsi128_si32(l.mmi())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sseu16, sseb16, operator<, impl::sse_cmpgt_epu16(r.mmi(), l.mmi()))
+        SIMDEE_BINOP(sseu16, sseb16, operator>, impl::sse_cmpgt_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, not_sseb16, operator<=,
+                     not_sseb16(impl::sse_cmpgt_epu16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sseu16, not_sseb16, operator>=,
+                     not_sseb16(impl::sse_cmpgt_epu16(r.mmi(), l.mmi())))
+        SIMDEE_BINOP(sseu16, sseu16, min, impl::sse_min_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, max, impl::sse_max_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseb16, operator==, _mm_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, not_sseb16, operator!=, not_sseb16(_mm_cmpeq_epi16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sseu16, sseu16, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu16, sseu16, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sseu16, sseu16, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sseu16, not_sseu16, operator~, not_sseu16(l))
+        SIMDEE_UNOP(sseu16, sseu16, operator-, _mm_sub_epi16(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, operator+, _mm_add_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, operator-, _mm_sub_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, operator*, _mm_mullo_epi16(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(sseu16, sseu16, add_sat, _mm_adds_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, sub_sat, _mm_subs_epu16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sseu16, sseu16, avg, _mm_avg_epu16(l.mmi(), r.mmi()))
+#endif
+    };
+
+    struct sses16 : sse_base<sses16> {
+        SIMDEE_TRIVIAL_TYPE(sses16)
+
+        using sse_base::sse_base;
+        SIMDEE_INL explicit sses16(const sseu16&);
+        SIMDEE_INL sses16(int16_t v0, int16_t v1, int16_t v2, int16_t v3, int16_t v4, int16_t v5,
+                          int16_t v6, int16_t v7) {
+            mm = _mm_castsi128_ps(_mm_setr_epi16(v0, v1, v2, v3, v4, v5, v6, v7));
+        }
+        SIMDEE_CTOR(sses16, __m128i, mm = _mm_castsi128_ps(r))
+        SIMDEE_CTOR(sses16, not_sses16, mm = _mm_xor_ps(r.neg.mm, sses16(all_bits()).mm))
+
+        SIMDEE_UNOP(sses16, scalar_t, first_scalar, scalar_t(_mm_cvtsi128_si32(l.mmi())))
+
+#if SIMDEE_NEED_INT
+        SIMDEE_BINOP(sses16, sseb16, operator<, _mm_cmplt_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sseb16, operator>, _mm_cmpgt_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, not_sseb16, operator<=, not_sseb16(_mm_cmpgt_epi16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sses16, not_sseb16, operator>=, not_sseb16(_mm_cmplt_epi16(l.mmi(), r.mmi())))
+        SIMDEE_BINOP(sses16, sseb16, operator==, _mm_cmpeq_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, not_sseb16, operator!=, not_sseb16(_mm_cmpeq_epi16(l.mmi(), r.mmi())))
+
+        SIMDEE_BINOP(sses16, sses16, operator&, _mm_and_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses16, sses16, operator|, _mm_or_ps(l.mm, r.mm))
+        SIMDEE_BINOP(sses16, sses16, operator^, _mm_xor_ps(l.mm, r.mm))
+        SIMDEE_UNOP(sses16, not_sses16, operator~, not_sses16(l))
+
+        SIMDEE_UNOP(sses16, sses16, operator-, _mm_sub_epi16(_mm_setzero_si128(), l.mmi()))
+        SIMDEE_BINOP(sses16, sses16, operator+, _mm_add_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sses16, operator-, _mm_sub_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sses16, operator*, _mm_mullo_epi16(l.mmi(), r.mmi()))
+
+        SIMDEE_BINOP(sses16, sses16, min, _mm_min_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sses16, max, _mm_max_epi16(l.mmi(), r.mmi()))
+        SIMDEE_UNOP(sses16, sses16, abs, impl::sse_abs_epi16(l.mmi()))
+
+        SIMDEE_BINOP(sses16, sses16, add_sat, _mm_adds_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sses16, sub_sat, _mm_subs_epi16(l.mmi(), r.mmi()))
+        SIMDEE_BINOP(sses16, sses16, avg, impl::sse_avg_epi16(l.mmi(), r.mmi()))
 #endif
     };
 
@@ -313,6 +1392,86 @@ namespace sd {
     SIMDEE_INL sseu::sseu(const sseb& r) { mm = r.data(); }
     SIMDEE_INL sseu::sseu(const sses& r) { mm = r.data(); }
     SIMDEE_INL sses::sses(const sseu& r) { mm = r.data(); }
+    SIMDEE_INL ssef::ssef(const sseu& r) { mm = impl::sse_cvtepu32_ps(_mm_castps_si128(r.data())); }
+    SIMDEE_INL sseu::sseu(const ssef& r) {
+        mm = _mm_castsi128_ps(impl::sse_cvttps_epu32(r.data()));
+    }
+
+    // conversion to int, rounding to the nearest integer with ties to even
+    SIMDEE_INL const sses to_int_round(const ssef& l) { return _mm_cvtps_epi32(l.data()); }
+
+    SIMDEE_INL ssed::ssed(const sses64& r) {
+        sses64::storage_t s(r);
+        mm = _mm_castpd_ps(_mm_setr_pd(double(s[0]), double(s[1])));
+    }
+    SIMDEE_INL sses64::sses64(const ssed& r) {
+        ssed::storage_t s(r);
+        mm = _mm_castsi128_ps(_mm_set_epi64x(int64_t(s[1]), int64_t(s[0])));
+    }
+    SIMDEE_INL sseu64::sseu64(const sseb64& r) { mm = r.data(); }
+    SIMDEE_INL sseu64::sseu64(const sses64& r) { mm = r.data(); }
+    SIMDEE_INL sses64::sses64(const sseu64& r) { mm = r.data(); }
+
+    SIMDEE_INL sseu8::sseu8(const sseb8& r) { mm = r.data(); }
+    SIMDEE_INL sseu8::sseu8(const sses8& r) { mm = r.data(); }
+    SIMDEE_INL sses8::sses8(const sseu8& r) { mm = r.data(); }
+
+    SIMDEE_INL sseu16::sseu16(const sseb16& r) { mm = r.data(); }
+    SIMDEE_INL sseu16::sseu16(const sses16& r) { mm = r.data(); }
+    SIMDEE_INL sses16::sses16(const sseu16& r) { mm = r.data(); }
+
+#if SIMDEE_NEED_INT
+    SIMDEE_INL const sseu16 widen_lo(const sseu8& l) {
+        return _mm_unpacklo_epi8(_mm_castps_si128(l.data()), _mm_setzero_si128());
+    }
+    SIMDEE_INL const sseu16 widen_hi(const sseu8& l) {
+        return _mm_unpackhi_epi8(_mm_castps_si128(l.data()), _mm_setzero_si128());
+    }
+    SIMDEE_INL const sses16 widen_lo(const sses8& l) {
+        __m128i i = _mm_castps_si128(l.data());
+        return _mm_srai_epi16(_mm_unpacklo_epi8(i, i), 8);
+    }
+    SIMDEE_INL const sses16 widen_hi(const sses8& l) {
+        __m128i i = _mm_castps_si128(l.data());
+        return _mm_srai_epi16(_mm_unpackhi_epi8(i, i), 8);
+    }
+    SIMDEE_INL const sseu widen_lo(const sseu16& l) {
+        return _mm_unpacklo_epi16(_mm_castps_si128(l.data()), _mm_setzero_si128());
+    }
+    SIMDEE_INL const sseu widen_hi(const sseu16& l) {
+        return _mm_unpackhi_epi16(_mm_castps_si128(l.data()), _mm_setzero_si128());
+    }
+    SIMDEE_INL const sses widen_lo(const sses16& l) {
+        __m128i i = _mm_castps_si128(l.data());
+        return _mm_srai_epi32(_mm_unpacklo_epi16(i, i), 16);
+    }
+    SIMDEE_INL const sses widen_hi(const sses16& l) {
+        __m128i i = _mm_castps_si128(l.data());
+        return _mm_srai_epi32(_mm_unpackhi_epi16(i, i), 16);
+    }
+
+    SIMDEE_INL const sseu8 narrow(const sseu16& lo, const sseu16& hi) {
+        __m128i top = _mm_set1_epi16(0xff);
+        return _mm_packus_epi16(impl::sse_min_epu16(_mm_castps_si128(lo.data()), top),
+                                impl::sse_min_epu16(_mm_castps_si128(hi.data()), top));
+    }
+    SIMDEE_INL const sses8 narrow(const sses16& lo, const sses16& hi) {
+        return _mm_packs_epi16(_mm_castps_si128(lo.data()), _mm_castps_si128(hi.data()));
+    }
+    SIMDEE_INL const sseu16 narrow(const sseu& lo, const sseu& hi) {
+        // saturate to 0xffff, then sign-extend the low halves so that packs_epi32 keeps them
+        auto saturate = [](__m128i v) {
+            __m128i fits = _mm_cmpeq_epi32(_mm_srli_epi32(v, 16), _mm_setzero_si128());
+            v = _mm_or_si128(v, _mm_xor_si128(fits, _mm_cmpeq_epi32(fits, fits)));
+            return _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+        };
+        return _mm_packs_epi32(saturate(_mm_castps_si128(lo.data())),
+                               saturate(_mm_castps_si128(hi.data())));
+    }
+    SIMDEE_INL const sses16 narrow(const sses& lo, const sses& hi) {
+        return _mm_packs_epi32(_mm_castps_si128(lo.data()), _mm_castps_si128(hi.data()));
+    }
+#endif
 
     SIMDEE_INL const sseb cond(const sseb& pred, const sseb& if_true, const sseb& if_false) {
         return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
@@ -330,6 +1489,52 @@ namespace sd {
         return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
     }
 
+    SIMDEE_INL const sseb64 cond(const sseb64& pred, const sseb64& if_true,
+                                 const sseb64& if_false) {
+        return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const ssed cond(const sseb64& pred, const ssed& if_true, const ssed& if_false) {
+        return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sseu64 cond(const sseb64& pred, const sseu64& if_true,
+                                 const sseu64& if_false) {
+        return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sses64 cond(const sseb64& pred, const sses64& if_true,
+                                 const sses64& if_false) {
+        return impl::sse_cond(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sseb8 cond(const sseb8& pred, const sseb8& if_true, const sseb8& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sseu8 cond(const sseb8& pred, const sseu8& if_true, const sseu8& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sses8 cond(const sseb8& pred, const sses8& if_true, const sses8& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sseb16 cond(const sseb16& pred, const sseb16& if_true,
+                                 const sseb16& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sseu16 cond(const sseb16& pred, const sseu16& if_true,
+                                 const sseu16& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
+    SIMDEE_INL const sses16 cond(const sseb16& pred, const sses16& if_true,
+                                 const sses16& if_false) {
+        return impl::sse_cond_bytes(pred.data(), if_true.data(), if_false.data());
+    }
+
     namespace impl {
 
         template <typename T, typename NotT>
@@ -352,8 +1557,87 @@ namespace sd {
         template <>
         struct special_ops<sses> : sse_special_ops<sses, not_sses> {};
 
+        template <>
+        struct special_ops<sseb64> : sse_special_ops<sseb64, not_sseb64> {};
+
+        template <>
+        struct special_ops<sseu64> : sse_special_ops<sseu64, not_sseu64> {};
+
+        template <>
+        struct special_ops<sses64> : sse_special_ops<sses64, not_sses64> {};
+
+        template <>
+        struct special_ops<sseb8> : sse_special_ops<sseb8, not_sseb8> {};
+
+        template <>
+        struct special_ops<sseu8> : sse_special_ops<sseu8, not_sseu8> {};
+
+        template <>
+        struct special_ops<sses8> : sse_special_ops<sses8, not_sses8> {};
+
+        template <>
+        struct special_ops<sseb16> : sse_special_ops<sseb16, not_sseb16> {};
+
+        template <>
+        struct special_ops<sseu16> : sse_special_ops<sseu16, not_sseu16> {};
+
+        template <>
+        struct special_ops<sses16> : sse_special_ops<sses16, not_sses16> {};
+
+        struct sse_network_ops {
+            using type = __m128;
+
+            SIMDEE_INL static __m128 unpacklo(__m128 a, __m128 b) { return _mm_unpacklo_ps(a, b); }
+            SIMDEE_INL static __m128 unpackhi(__m128 a, __m128 b) { return _mm_unpackhi_ps(a, b); }
+            template <int Imm>
+            SIMDEE_INL static __m128 shuffle(__m128 a, __m128 b) {
+                return _mm_shuffle_ps(a, b, Imm);
+            }
+        };
+
+        // two to four channels of 32-bit scalars go through shuffle_network<>
+        template <std::size_t N, typename Simd_t>
+        struct sse_channels {
+            using scalar_t = typename Simd_t::scalar_t;
+
+            SIMDEE_INL static void load(const scalar_t* ptr, Simd_t* out) {
+                const float* p = reinterpret_cast<const float*>(ptr);
+                __m128 in[N], res[N];
+                auto load_one = [&](std::size_t s) { in[s] = _mm_loadu_ps(p + 4 * s); };
+                static_for<N>::apply(load_one);
+                shuffle_network<N, sse_network_ops>::load(in, res);
+                auto copy = [&](std::size_t c) { out[c] = res[c]; };
+                static_for<N>::apply(copy);
+            }
+            SIMDEE_INL static void store(scalar_t* ptr, const Simd_t* in) {
+                float* p = reinterpret_cast<float*>(ptr);
+                __m128 mm[N], res[N];
+                auto copy = [&](std::size_t c) { mm[c] = in[c].data(); };
+                static_for<N>::apply(copy);
+                shuffle_network<N, sse_network_ops>::store(mm, res);
+                auto store_one = [&](std::size_t s) { _mm_storeu_ps(p + 4 * s, res[s]); };
+                static_for<N>::apply(store_one);
+            }
+        };
+
+        template <std::size_t N>
+        struct channels<N, ssef>
+            : std::conditional<(N >= 2 && N <= 4), sse_channels<N, ssef>,
+                               blend_channels<N, ssef>>::type {};
+
+        template <std::size_t N>
+        struct channels<N, sseu>
+            : std::conditional<(N >= 2 && N <= 4), sse_channels<N, sseu>,
+                               blend_channels<N, sseu>>::type {};
+
+        template <std::size_t N>
+        struct channels<N, sses>
+            : std::conditional<(N >= 2 && N <= 4), sse_channels<N, sses>,
+                               blend_channels<N, sses>>::type {};
+
     } // namespace impl
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_SIMD_TYPES_SSE_HPP
@@ -5,7 +5,11 @@
 #define SIMDEE_SIMDEE_HPP
 
 #include "common/init.hpp"
+#include "vec2.hpp"
 #include "vec4.hpp"
 #include "vec8.hpp"
+#include "vec16.hpp"
+#include "vec32.hpp"
+#include "vec.hpp"
 
 #endif // SIMDEE_SIMDEE_HPP
@@ -13,6 +13,7 @@
 #include <type_traits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace detail {
 
@@ -94,6 +95,7 @@ namespace sd {
         }
     };
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_UTIL_MALLOC_HPP
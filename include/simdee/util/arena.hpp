@@ -0,0 +1,337 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_UTIL_ARENA_HPP
+#define SIMDEE_UTIL_ARENA_HPP
+
+#include "allocator.hpp"
+#include "inline.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define SIMDEE_PAGES_WIN32 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define SIMDEE_PAGES_MMAP 1
+#endif
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    // backing of the memory obtained by sd::arena and sd::pool from the system
+    enum class huge_pages {
+        none,   // normal pages
+        advise, // transparent huge pages for the chunks of 2 MiB or more, madvise(MADV_HUGEPAGE)
+        mapped, // MAP_HUGETLB, which needs pages reserved by the system, falls back to advise
+    };
+
+    namespace detail {
+        constexpr std::size_t page_bytes = 4096;
+        constexpr std::size_t huge_page_bytes = std::size_t(2) << 20;
+
+        inline std::uintptr_t align_up(std::uintptr_t x, std::size_t align) {
+            return (x + (align - 1)) & ~(align - 1);
+        }
+
+        // memory mapped from the system; the mapping is larger than requested when the
+        // alignment is larger than a page, and data points to the aligned part of it
+        struct pages {
+            void* base = nullptr;
+            std::size_t mapped = 0;
+            char* data = nullptr;
+            std::size_t bytes = 0;
+
+            pages() = default;
+            pages(const pages&) = delete;
+            pages& operator=(const pages&) = delete;
+            pages(pages&& r) noexcept { *this = static_cast<pages&&>(r); }
+            pages& operator=(pages&& r) noexcept {
+                std::swap(base, r.base);
+                std::swap(mapped, r.mapped);
+                std::swap(data, r.data);
+                std::swap(bytes, r.bytes);
+                return *this;
+            }
+            ~pages() { release(); }
+
+            // maps at least count bytes aligned to align, which is a power of 2; throws
+            // std::bad_alloc on failure
+            void map(std::size_t count, std::size_t align, huge_pages mode) {
+                release();
+                if (align < page_bytes) align = page_bytes;
+                bool advise = mode != huge_pages::none && count >= huge_page_bytes;
+                if (advise && align < huge_page_bytes) align = huge_page_bytes;
+                const std::size_t size = align_up(count, page_bytes);
+#if defined(SIMDEE_PAGES_MMAP) && defined(MAP_HUGETLB)
+                if (mode == huge_pages::mapped && align <= huge_page_bytes) {
+                    const std::size_t huge = align_up(count, huge_page_bytes);
+                    void* p = mmap(nullptr, huge, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    if (p != MAP_FAILED) {
+                        set(p, huge, p, huge);
+                        return;
+                    }
+                }
+#endif
+                const std::size_t total = size + (align > page_bytes ? align : 0);
+                void* p = map_system(total);
+                if (p == nullptr) throw std::bad_alloc{};
+                char* aligned = reinterpret_cast<char*>(align_up(std::uintptr_t(p), align));
+                set(p, total, aligned, size);
+#if defined(SIMDEE_PAGES_MMAP) && defined(MADV_HUGEPAGE)
+                if (advise) madvise(aligned, size, MADV_HUGEPAGE);
+#else
+                (void)advise;
+#endif
+            }
+
+            void release() noexcept {
+                if (base == nullptr) return;
+#if defined(SIMDEE_PAGES_WIN32)
+                VirtualFree(base, 0, MEM_RELEASE);
+#elif defined(SIMDEE_PAGES_MMAP)
+                munmap(base, mapped);
+#else
+                std::free(base);
+#endif
+                set(nullptr, 0, nullptr, 0);
+            }
+
+        private:
+            void set(void* b, std::size_t m, void* d, std::size_t n) {
+                base = b;
+                mapped = m;
+                data = static_cast<char*>(d);
+                bytes = n;
+            }
+
+            static void* map_system(std::size_t total) {
+#if defined(SIMDEE_PAGES_WIN32)
+                return VirtualAlloc(nullptr, total, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#elif defined(SIMDEE_PAGES_MMAP)
+                void* p = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON,
+                               -1, 0);
+                return p == MAP_FAILED ? nullptr : p;
+#else
+                return std::malloc(total + page_bytes);
+#endif
+            }
+        };
+    } // namespace detail
+
+    // a bump allocator: each allocation takes the next bytes of the current chunk, nothing is
+    // freed individually, and reset() makes all chunks available again at once, e.g. for the
+    // scratch buffers of a frame:
+    //     sd::arena scratch(16 << 20);
+    //     for (;;) {
+    //         scratch.reset();
+    //         float* tmp = static_cast<float*>(scratch.allocate(n * sizeof(float), 64));
+    //         ...
+    //     }
+    // the chunks are mapped from the system, at least chunk_bytes each, and are only returned
+    // when the arena is destroyed
+    class arena {
+    public:
+        explicit arena(std::size_t chunk_bytes = std::size_t(1) << 20,
+                       huge_pages mode = huge_pages::none)
+            : m_chunk_bytes(chunk_bytes), m_mode(mode) {}
+
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        // count bytes aligned to align, which is any power of 2, including 4096 and more
+        void* allocate(std::size_t count, std::size_t align = alignof(std::max_align_t)) {
+            if (!detail::is_pow2(align)) throw std::bad_alloc{};
+            for (;;) {
+                if (m_current < m_chunks.size()) {
+                    const detail::pages& c = m_chunks[m_current];
+                    const std::uintptr_t p = detail::align_up(std::uintptr_t(m_top), align);
+                    const std::uintptr_t end = std::uintptr_t(c.data + c.bytes);
+                    if (p <= end && count <= end - p) {
+                        m_top = reinterpret_cast<char*>(p + count);
+                        return reinterpret_cast<void*>(p);
+                    }
+                    if (m_current + 1 < m_chunks.size()) {
+                        m_top = m_chunks[++m_current].data;
+                        continue;
+                    }
+                }
+                grow(count, align);
+            }
+        }
+
+        // invalidates all allocations, the chunks are kept for the next ones
+        void reset() noexcept {
+            m_current = 0;
+            m_top = m_chunks.empty() ? nullptr : m_chunks[0].data;
+        }
+
+        // bytes taken from the chunks since the last reset, including the alignment padding
+        std::size_t used() const {
+            if (m_chunks.empty()) return 0;
+            std::size_t res = std::size_t(m_top - m_chunks[m_current].data);
+            for (std::size_t i = 0; i < m_current; ++i) res += m_chunks[i].bytes;
+            return res;
+        }
+
+        // bytes in all chunks
+        std::size_t capacity() const {
+            std::size_t res = 0;
+            for (const detail::pages& c : m_chunks) res += c.bytes;
+            return res;
+        }
+
+        huge_pages mode() const { return m_mode; }
+
+    private:
+        void grow(std::size_t count, std::size_t align) {
+            detail::pages c;
+            c.map(count > m_chunk_bytes ? count : m_chunk_bytes, align, m_mode);
+            m_chunks.push_back(static_cast<detail::pages&&>(c));
+            m_current = m_chunks.size() - 1;
+            m_top = m_chunks.back().data;
+        }
+
+        std::vector<detail::pages> m_chunks;
+        std::size_t m_current = 0;
+        char* m_top = nullptr;
+        std::size_t m_chunk_bytes;
+        huge_pages m_mode;
+    };
+
+    // blocks of one size and alignment, carved from an arena and recycled through a free list,
+    // e.g. for the nodes of a tree or the tiles of an image
+    class pool {
+    public:
+        explicit pool(std::size_t block_bytes, std::size_t align = 64,
+                      std::size_t chunk_bytes = std::size_t(1) << 20,
+                      huge_pages mode = huge_pages::none)
+            : m_align(align < alignof(void*) ? alignof(void*) : align),
+              m_block(detail::align_up(block_bytes < sizeof(void*) ? sizeof(void*) : block_bytes,
+                                       m_align)),
+              m_arena(chunk_bytes, mode) {}
+
+        pool(const pool&) = delete;
+        pool& operator=(const pool&) = delete;
+
+        SIMDEE_INL void* allocate() {
+            if (m_free == nullptr) return m_arena.allocate(m_block, m_align);
+            void* res = m_free;
+            m_free = *static_cast<void**>(m_free);
+            return res;
+        }
+
+        SIMDEE_INL void deallocate(void* ptr) noexcept {
+            if (ptr == nullptr) return;
+            *static_cast<void**>(ptr) = m_free;
+            m_free = ptr;
+        }
+
+        // returns all blocks to the pool at once, without calling deallocate() for each
+        void reset() noexcept {
+            m_free = nullptr;
+            m_arena.reset();
+        }
+
+        std::size_t block_size() const { return m_block; }
+        std::size_t alignment() const { return m_align; }
+
+    private:
+        std::size_t m_align;
+        std::size_t m_block;
+        arena m_arena;
+        void* m_free = nullptr;
+    };
+
+    // std-compatible allocator that takes memory from an sd::arena, aligned to at least Align
+    // bytes; deallocate() does nothing, the memory is reused after arena::reset()
+    template <typename T, std::size_t Align = alignof(T)>
+    class arena_allocator {
+    public:
+        using value_type = T;
+        enum : std::size_t { alignment = Align > alignof(T) ? Align : alignof(T) };
+
+        template <typename S>
+        struct rebind {
+            using other = arena_allocator<S, Align>;
+        };
+
+        explicit arena_allocator(arena& a) noexcept : m_arena(&a) {}
+
+        template <typename S>
+        arena_allocator(const arena_allocator<S, Align>& r) noexcept : m_arena(&r.resource()) {}
+
+        SIMDEE_INL T* allocate(std::size_t count) const {
+            if (count > std::size_t(-1) / sizeof(T)) throw std::bad_alloc{};
+            return static_cast<T*>(m_arena->allocate(sizeof(T) * count, alignment));
+        }
+
+        SIMDEE_INL void deallocate(T*, std::size_t) const noexcept {}
+
+        arena& resource() const noexcept { return *m_arena; }
+
+    private:
+        arena* m_arena;
+    };
+
+    template <typename T, typename S, std::size_t Align>
+    inline bool operator==(const arena_allocator<T, Align>& l,
+                           const arena_allocator<S, Align>& r) {
+        return &l.resource() == &r.resource();
+    }
+    template <typename T, typename S, std::size_t Align>
+    inline bool operator!=(const arena_allocator<T, Align>& l,
+                           const arena_allocator<S, Align>& r) {
+        return &l.resource() != &r.resource();
+    }
+
+    // std-compatible allocator that takes one block of an sd::pool per allocation, meant for
+    // node-based containers such as std::list and std::map; requests that don't fit into a
+    // block throw std::bad_alloc
+    template <typename T>
+    class pool_allocator {
+    public:
+        using value_type = T;
+
+        explicit pool_allocator(pool& p) noexcept : m_pool(&p) {}
+
+        template <typename S>
+        pool_allocator(const pool_allocator<S>& r) noexcept : m_pool(&r.resource()) {}
+
+        SIMDEE_INL T* allocate(std::size_t count) const {
+            if (count > m_pool->block_size() / sizeof(T) || alignof(T) > m_pool->alignment()) {
+                throw std::bad_alloc{};
+            }
+            return static_cast<T*>(m_pool->allocate());
+        }
+
+        SIMDEE_INL void deallocate(T* ptr, std::size_t) const noexcept { m_pool->deallocate(ptr); }
+
+        pool& resource() const noexcept { return *m_pool; }
+
+    private:
+        pool* m_pool;
+    };
+
+    template <typename T, typename S>
+    inline bool operator==(const pool_allocator<T>& l, const pool_allocator<S>& r) {
+        return &l.resource() == &r.resource();
+    }
+    template <typename T, typename S>
+    inline bool operator!=(const pool_allocator<T>& l, const pool_allocator<S>& r) {
+        return &l.resource() != &r.resource();
+    }
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_UTIL_ARENA_HPP
@@ -8,17 +8,57 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <type_traits>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace detail {
+
+        // the 64-bit overloads are templates, so that plain integer literals still pick the 32-bit
+        // ones instead of being ambiguous
+        template <typename T>
+        using if_u64 =
+            typename std::enable_if<std::is_unsigned<T>::value && sizeof(T) == 8, uint32_t>::type;
+
+    } // namespace detail
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
 
 #if defined(__GNUC__) // GCC, Clang
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace detail {
 
         SIMDEE_INL uint32_t lsb(uint32_t in) noexcept { return uint32_t(__builtin_ctz(in)); }
 
+        SIMDEE_INL uint32_t msb(uint32_t in) noexcept { return 31U - uint32_t(__builtin_clz(in)); }
+
+        SIMDEE_INL uint32_t popcount(uint32_t in) noexcept {
+            return uint32_t(__builtin_popcount(in));
+        }
+
+        template <typename T>
+        SIMDEE_INL if_u64<T> lsb(T in) noexcept {
+            return uint32_t(__builtin_ctzll(in));
+        }
+
+        template <typename T>
+        SIMDEE_INL if_u64<T> msb(T in) noexcept {
+            return 63U - uint32_t(__builtin_clzll(in));
+        }
+
+        template <typename T>
+        SIMDEE_INL if_u64<T> popcount(T in) noexcept {
+            return uint32_t(__builtin_popcountll(in));
+        }
+
     } // namespace detail
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #elif defined(_MSC_VER) // Visual Studio
@@ -26,6 +66,7 @@ namespace sd {
 #include <intrin.h>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace detail {
 
@@ -35,8 +76,40 @@ namespace sd {
             return uint32_t(res);
         }
 
+        SIMDEE_INL uint32_t msb(uint32_t in) noexcept {
+            unsigned long res;
+            _BitScanReverse(&res, in);
+            return uint32_t(res);
+        }
+
+        // __popcnt needs a CPU with the POPCNT instruction, which isn't implied by SSE2
+        SIMDEE_INL uint32_t popcount(uint32_t in) noexcept {
+            in = in - ((in >> 1) & 0x55555555U);
+            in = (in & 0x33333333U) + ((in >> 2) & 0x33333333U);
+            return (((in + (in >> 4)) & 0x0f0f0f0fU) * 0x01010101U) >> 24;
+        }
+
+        // the 64-bit bit scans aren't available on 32-bit targets, the halves are used instead
+        template <typename T>
+        SIMDEE_INL if_u64<T> lsb(T in) noexcept {
+            const uint32_t lo = uint32_t(in);
+            return lo != 0 ? lsb(lo) : 32U + lsb(uint32_t(in >> 32));
+        }
+
+        template <typename T>
+        SIMDEE_INL if_u64<T> msb(T in) noexcept {
+            const uint32_t hi = uint32_t(in >> 32);
+            return hi != 0 ? 32U + msb(hi) : msb(uint32_t(in));
+        }
+
+        template <typename T>
+        SIMDEE_INL if_u64<T> popcount(T in) noexcept {
+            return popcount(uint32_t(in)) + popcount(uint32_t(in >> 32));
+        }
+
     } // namespace detail
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #else
@@ -46,28 +119,33 @@ namespace sd {
 #endif
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     // provides indices of set (1) bits, ordered from least significant to most significant
-    struct bit_iterator : std::iterator<std::input_iterator_tag, uint32_t> {
-        uint32_t mask;
+    template <typename Bits_t>
+    struct basic_bit_iterator : std::iterator<std::input_iterator_tag, uint32_t> {
+        Bits_t mask;
 
-        SIMDEE_INL constexpr bit_iterator(uint32_t mask_) noexcept : mask(mask_) {}
+        SIMDEE_INL constexpr basic_bit_iterator(Bits_t mask_) noexcept : mask(mask_) {}
         SIMDEE_INL uint32_t operator*() const noexcept { return detail::lsb(mask); }
-        SIMDEE_INL bit_iterator& operator++() noexcept {
+        SIMDEE_INL basic_bit_iterator& operator++() noexcept {
             mask = mask & (mask - 1);
             return *this;
         }
-        SIMDEE_INL bit_iterator operator++(int) noexcept {
-            bit_iterator r = mask;
+        SIMDEE_INL basic_bit_iterator operator++(int) noexcept {
+            basic_bit_iterator r = mask;
             operator++();
             return r;
         }
-        SIMDEE_INL constexpr bool operator==(const bit_iterator& rhs) const noexcept {
+        SIMDEE_INL constexpr bool operator==(const basic_bit_iterator& rhs) const noexcept {
             return mask == rhs.mask;
         }
-        SIMDEE_INL constexpr bool operator!=(const bit_iterator& rhs) const noexcept {
+        SIMDEE_INL constexpr bool operator!=(const basic_bit_iterator& rhs) const noexcept {
             return mask != rhs.mask;
         }
     };
+
+    using bit_iterator = basic_bit_iterator<uint32_t>;
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_UTIL_BIT_ITERATOR_HPP
@@ -4,10 +4,12 @@
 #ifndef SIMDEE_UTIL_BOOL_T_HPP
 #define SIMDEE_UTIL_BOOL_T_HPP
 
+#include "inline.hpp"
 #include <cstdint>
 #include <type_traits>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     namespace impl {
         template <typename U, typename S>
@@ -23,12 +25,12 @@ namespace sd {
             SIMDEE_INL constexpr explicit operator U() const { return data; }
             SIMDEE_INL constexpr explicit operator S() const { return S(data); }
 
-            SIMDEE_INL constexpr bool_t operator!() const { return bool_t(~data); }
+            SIMDEE_INL constexpr bool_t operator!() const { return bool_t(U(~data)); }
             SIMDEE_INL constexpr bool_t operator&&(const bool_t& r) const {
-                return bool_t(data & r.data);
+                return bool_t(U(data & r.data));
             }
             SIMDEE_INL constexpr bool_t operator||(const bool_t& r) const {
-                return bool_t(data | r.data);
+                return bool_t(U(data | r.data));
             }
 
             // data
@@ -47,6 +49,7 @@ namespace sd {
               bool, false || std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value ||
                         std::is_same<T, bool32_t>::value || std::is_same<T, bool64_t>::value> {};
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_UTIL_BOOL_T_HPP
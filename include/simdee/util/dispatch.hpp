@@ -0,0 +1,166 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_UTIL_DISPATCH_HPP
+#define SIMDEE_UTIL_DISPATCH_HPP
+
+#include "../common/init.hpp"
+#include "inline.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#if SIMDEE_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace sd {
+
+    // instruction set tiers, a higher tier implies support for the lower x86 tiers
+    enum class isa : int { scalar, sse2, avx, avx2, neon };
+
+    //
+    // the tier that the current translation unit is compiled for
+    //
+#if SIMDEE_AVX2
+#define SIMDEE_COMPILED_ISA (::sd::isa::avx2)
+#elif SIMDEE_AVX
+#define SIMDEE_COMPILED_ISA (::sd::isa::avx)
+#elif SIMDEE_SSE2
+#define SIMDEE_COMPILED_ISA (::sd::isa::sse2)
+#elif SIMDEE_NEON
+#define SIMDEE_COMPILED_ISA (::sd::isa::neon)
+#else
+#define SIMDEE_COMPILED_ISA (::sd::isa::scalar)
+#endif
+}
+
+// the rest is compiled separately for each tier, like the vectors
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    namespace detail {
+        constexpr int isa_count = int(isa::neon) + 1;
+
+#if SIMDEE_X86
+        struct cpuid_t {
+            uint32_t eax, ebx, ecx, edx;
+        };
+
+        inline cpuid_t cpuid(uint32_t leaf, uint32_t subleaf) {
+#if defined(_MSC_VER)
+            int r[4];
+            __cpuidex(r, int(leaf), int(subleaf));
+            return cpuid_t{uint32_t(r[0]), uint32_t(r[1]), uint32_t(r[2]), uint32_t(r[3])};
+#else
+            cpuid_t r{0, 0, 0, 0};
+            if (__get_cpuid_max(0, nullptr) < leaf) return r;
+            __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+            return r;
+#endif
+        }
+
+        // extended control register 0, tells which register states the OS saves
+        inline uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t lo, hi;
+            __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            return (uint64_t(hi) << 32) | lo;
+#endif
+        }
+#endif
+
+        inline isa detect_isa() {
+#if SIMDEE_X86
+            const cpuid_t l1 = cpuid(1, 0);
+            if (!(l1.edx & (1U << 26))) return isa::scalar;
+            const bool osxsave = (l1.ecx & (1U << 27)) != 0;
+            const bool avx = (l1.ecx & (1U << 28)) != 0;
+            if (!osxsave || !avx || (xgetbv0() & 6) != 6) return isa::sse2;
+            const cpuid_t l7 = cpuid(7, 0);
+            if (!(l7.ebx & (1U << 5))) return isa::avx;
+            return isa::avx2;
+#elif SIMDEE_ARM64 || SIMDEE_NEON
+            return isa::neon;
+#else
+            return isa::scalar;
+#endif
+        }
+    }
+
+    // the most capable tier supported by the CPU, detected on the first call
+    inline isa cpu_isa() {
+        static const isa detected = detail::detect_isa();
+        return detected;
+    }
+
+    inline const char* isa_name(isa tier) {
+        switch (tier) {
+        case isa::scalar: return "scalar";
+        case isa::sse2: return "SSE2";
+        case isa::avx: return "AVX";
+        case isa::avx2: return "AVX2";
+        case isa::neon: return "NEON";
+        }
+        return "unknown";
+    }
+
+    template <typename Signature>
+    class dispatched;
+
+    //
+    // a function with implementations for several tiers, each usually compiled in a separate
+    // translation unit; the best implementation that the CPU supports is selected once, calls then
+    // go through a cached function pointer
+    //
+    template <typename R, typename... Args>
+    class dispatched<R(Args...)> {
+    public:
+        using function_t = R (*)(Args...);
+        using entry_t = std::pair<isa, function_t>;
+
+        dispatched(std::initializer_list<entry_t> impls) {
+            for (auto& fn : table) fn = nullptr;
+            for (const auto& impl : impls) table[int(impl.first)] = impl.second;
+            select(cpu_isa());
+        }
+
+        // picks the best implementation that does not exceed max_tier and that the CPU supports,
+        // throws std::runtime_error if there is none
+        isa select(isa max_tier) {
+            const isa cpu = cpu_isa();
+            for (int i = int(max_tier); i >= 0; --i) {
+                const isa tier = isa(i);
+                if (!table[i] || !supports(cpu, tier)) continue;
+                current = table[i];
+                current_tier = tier;
+                return tier;
+            }
+            throw std::runtime_error("sd::dispatched: no implementation is supported by the CPU");
+        }
+
+        isa selected() const { return current_tier; }
+
+        SIMDEE_INL R operator()(Args... args) const { return current(std::forward<Args>(args)...); }
+
+    private:
+        static bool supports(isa cpu, isa tier) {
+            if (tier == isa::scalar) return true;
+            if (cpu == isa::neon || tier == isa::neon) return cpu == tier;
+            return int(tier) <= int(cpu);
+        }
+
+        function_t table[detail::isa_count];
+        function_t current;
+        isa current_tier;
+    };
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif // SIMDEE_UTIL_DISPATCH_HPP
@@ -22,4 +22,18 @@
 
 #endif
 
+//
+// the library is declared in the inline namespace sd::SIMDEE_ISA_NAMESPACE when that macro is
+// defined, as simdee_set_source_isa() does for the sources of a dispatch tier; the inline
+// functions compiled with the flags of each tier then have their own symbols, and the linker
+// can't replace the SSE2 copy of a function with the AVX one
+//
+#if defined(SIMDEE_ISA_NAMESPACE)
+#define SIMDEE_ISA_NAMESPACE_BEGIN inline namespace SIMDEE_ISA_NAMESPACE {
+#define SIMDEE_ISA_NAMESPACE_END }
+#else
+#define SIMDEE_ISA_NAMESPACE_BEGIN
+#define SIMDEE_ISA_NAMESPACE_END
+#endif
+
 #endif // SIMDEE_UTIL_INLINE_HPP
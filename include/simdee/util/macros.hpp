@@ -127,4 +127,22 @@ SIMDEE_INL friend RESTYPE NAME (const ARGTYPE & l, const ARGTYPE & r) {
                                                                                                          \
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_SHIFTOP( ARGTYPE, NAME, IMPL )                                                            \
+                                                                                                         \
+SIMDEE_INL friend ARGTYPE NAME (const ARGTYPE & l, int r) {                                              \
+    return IMPL ;                                                                                        \
+}                                                                                                        \
+                                                                                                         \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define SIMDEE_TRIOP( ARGTYPE, RESTYPE, NAME, IMPL )                                                     \
+                                                                                                         \
+SIMDEE_INL friend RESTYPE NAME (const ARGTYPE & l, const ARGTYPE & m, const ARGTYPE & r) {               \
+    return IMPL ;                                                                                        \
+}                                                                                                        \
+                                                                                                         \
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif // SIMDEE_UTIL_MACROS_HPP
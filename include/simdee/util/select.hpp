@@ -5,9 +5,11 @@
 #define SIMDEE_UTIL_SELECT_HPP
 
 #include "bool_t.hpp"
+#include "inline.hpp"
 #include <cstdint>
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
 
     template <std::size_t Size>
     struct select_bool;
@@ -86,6 +88,7 @@ namespace sd {
     template <std::size_t Size>
     using select_float_t = typename select_float<Size>::type;
 
+    SIMDEE_ISA_NAMESPACE_END
 } // namespace sd
 
 #endif // SIMDEE_UTIL_SELECT_HPP
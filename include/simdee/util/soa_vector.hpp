@@ -0,0 +1,159 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_UTIL_SOA_VECTOR_HPP
+#define SIMDEE_UTIL_SOA_VECTOR_HPP
+
+#include "../common/expr.hpp"
+#include "../vec.hpp"
+#include "allocator.hpp"
+#include "inline.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    namespace impl {
+        // fields with the scalar type of Simd_t are loaded as Simd_t, the others as sd::vec of
+        // the same width
+        template <typename Simd_t, typename Field>
+        struct soa_field_vec {
+            using type = typename std::conditional<
+                std::is_same<Field, typename Simd_t::scalar_t>::value, Simd_t,
+                vec<Field, Simd_t::width>>::type;
+        };
+    }
+
+    // a sequence of records with the given fields, stored in blocks of Simd_t::width records;
+    // each field of a block is an aligned array of scalars that loads as a single vector, e.g.
+    //     sd::soa_vector<sd::vec8f, float, float, uint32_t> points; // x, y, color
+    //     points.push_back(1.f, 2.f, 0xff0000U);
+    //     for (std::size_t b = 0; b < points.blocks(); ++b) {
+    //         sd::vec8f x = points.field<0>(b);
+    //         points.field<1>(b) = x + sd::vec8f(points.field<1>(b));
+    //     }
+    // the lanes of the last block past size() are padding, which holds Field() unless overwritten
+    template <typename Simd_t, typename... Fields>
+    class soa_vector {
+    public:
+        enum : std::size_t { width = Simd_t::width, num_fields = sizeof...(Fields) };
+
+        template <std::size_t I>
+        using field_t = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+        template <std::size_t I>
+        using vector_t = typename impl::soa_field_vec<Simd_t, field_t<I>>::type;
+        using mask_t = typename Simd_t::mask_t;
+        using block_t =
+            std::tuple<typename impl::soa_field_vec<Simd_t, Fields>::type::storage_t...>;
+
+        soa_vector() = default;
+        explicit soa_vector(std::size_t count) { resize(count); }
+
+        // number of records
+        SIMDEE_INL std::size_t size() const { return m_size; }
+        SIMDEE_INL bool empty() const { return m_size == 0; }
+        SIMDEE_INL std::size_t capacity() const { return m_blocks.capacity() * width; }
+
+        // number of blocks, the last one may be partial
+        SIMDEE_INL std::size_t blocks() const { return m_blocks.size(); }
+
+        // number of records in block b
+        SIMDEE_INL std::size_t block_size(std::size_t b) const {
+            const std::size_t rest = m_size - b * width;
+            return rest < width ? rest : std::size_t(width);
+        }
+
+        // the lanes of block b that hold records
+        SIMDEE_INL mask_t block_mask(std::size_t b) const {
+            using bits_t = typename mask_t::bits_t;
+            const std::size_t count = block_size(b);
+            if (count == width) return mask_t(bits_t(mask_t::all_bits));
+            return mask_t(bits_t((uint64_t(1) << count) - 1));
+        }
+
+        void reserve(std::size_t count) { m_blocks.reserve((count + width - 1) / width); }
+
+        void clear() {
+            m_blocks.clear();
+            m_size = 0;
+        }
+
+        // new records are Fields(), removed ones become padding again
+        void resize(std::size_t count) {
+            // the padding of the old last block may have been overwritten through field()
+            if (count > m_size && m_size % width != 0) {
+                clear_lanes<0>(m_blocks.back(), m_size % width);
+            }
+            m_blocks.resize((count + width - 1) / width);
+            m_size = count;
+            if (count % width != 0) { clear_lanes<0>(m_blocks.back(), count % width); }
+        }
+
+        void push_back(const Fields&... values) {
+            if (m_size % width == 0) m_blocks.emplace_back();
+            set_lanes<0>(m_blocks.back(), m_size % width, values...);
+            ++m_size;
+        }
+
+        // field I of record i
+        template <std::size_t I>
+        SIMDEE_INL field_t<I>& get(std::size_t i) {
+            return std::get<I>(m_blocks[i / width])[i % width];
+        }
+        template <std::size_t I>
+        SIMDEE_INL const field_t<I>& get(std::size_t i) const {
+            return std::get<I>(m_blocks[i / width])[i % width];
+        }
+
+        // the width scalars of field I in block b, aligned for a vector load or store
+        template <std::size_t I>
+        SIMDEE_INL field_t<I>* data(std::size_t b) {
+            return std::get<I>(m_blocks[b]).data();
+        }
+        template <std::size_t I>
+        SIMDEE_INL const field_t<I>* data(std::size_t b) const {
+            return std::get<I>(m_blocks[b]).data();
+        }
+
+        // field I of block b as a vector_t<I>, the same as sd::aligned(data<I>(b))
+        template <std::size_t I>
+        SIMDEE_INL expr::aligned<field_t<I>> field(std::size_t b) {
+            return expr::aligned<field_t<I>>(data<I>(b));
+        }
+        template <std::size_t I>
+        SIMDEE_INL expr::aligned<const field_t<I>> field(std::size_t b) const {
+            return expr::aligned<const field_t<I>>(data<I>(b));
+        }
+
+    private:
+        template <std::size_t I>
+        static SIMDEE_INL void set_lanes(block_t&, std::size_t) {}
+        template <std::size_t I, typename T, typename... Ts>
+        static SIMDEE_INL void set_lanes(block_t& block, std::size_t lane, const T& value,
+                                         const Ts&... values) {
+            std::get<I>(block)[lane] = value;
+            set_lanes<I + 1>(block, lane, values...);
+        }
+
+        template <std::size_t I>
+        static SIMDEE_INL typename std::enable_if<(I == num_fields)>::type
+        clear_lanes(block_t&, std::size_t) {}
+        template <std::size_t I>
+        static SIMDEE_INL typename std::enable_if<(I < num_fields)>::type
+        clear_lanes(block_t& block, std::size_t first) {
+            for (std::size_t j = first; j < width; ++j) std::get<I>(block)[j] = field_t<I>();
+            clear_lanes<I + 1>(block, first);
+        }
+
+        std::vector<block_t, allocator<block_t>> m_blocks;
+        std::size_t m_size = 0;
+    };
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_UTIL_SOA_VECTOR_HPP
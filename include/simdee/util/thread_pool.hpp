@@ -0,0 +1,206 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_UTIL_THREAD_POOL_HPP
+#define SIMDEE_UTIL_THREAD_POOL_HPP
+
+#include "inline.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+
+    class thread_pool;
+
+    namespace detail {
+        // the pool whose task is running on this thread, so that a nested parallel_for() runs
+        // serially instead of waiting for threads that are all busy
+        inline const thread_pool*& current_pool() {
+            static thread_local const thread_pool* pool = nullptr;
+            return pool;
+        }
+
+        // the indices not yet taken by a thread; the owner takes them from the front, other
+        // threads steal the back half, and the padding keeps the ranges in separate cache lines
+        struct steal_range {
+            std::mutex mutex;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            char padding[64];
+        };
+    }
+
+    // a fixed set of threads that execute parallel loops, e.g.
+    //     sd::thread_pool pool;
+    //     pool.parallel_for(chunks, [&](std::size_t i) { process(i); });
+    // each thread starts with an equal share of the indices and, when it runs out, steals half
+    // of the remaining indices of another thread, so that uneven work is balanced
+    class thread_pool {
+    public:
+        // threads includes the thread that calls parallel_for(), 0 means one per hardware thread
+        explicit thread_pool(std::size_t threads = 0)
+            : m_size(threads != 0 ? threads : hardware_threads()),
+              m_ranges(new detail::steal_range[m_size]) {
+            m_threads.reserve(m_size - 1);
+            try {
+                for (std::size_t k = 1; k < m_size; ++k) {
+                    m_threads.emplace_back([this, k]() { worker(k); });
+                }
+            } catch (...) {
+                stop();
+                throw;
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() { stop(); }
+
+        // number of threads, including the caller of parallel_for()
+        std::size_t size() const { return m_size; }
+
+        // calls fn(i) for i from 0 to count - 1 on all threads of the pool, in no particular
+        // order, and returns when all calls have finished; the first exception thrown by fn is
+        // rethrown and the indices not started by then are skipped; calls from a task of any
+        // pool run serially on the calling thread, and calls from several other threads at once
+        // are executed one after another
+        template <typename Fn>
+        void parallel_for(std::size_t count, Fn&& fn) {
+            using fn_t = typename std::remove_reference<Fn>::type;
+            if (count == 0) return;
+            if (m_size == 1 || count == 1 || detail::current_pool() != nullptr) {
+                for (std::size_t i = 0; i < count; ++i) fn(i);
+                return;
+            }
+
+            std::lock_guard<std::mutex> call(m_call);
+            for (std::size_t k = 0; k < m_size; ++k) {
+                m_ranges[k].begin = count * k / m_size;
+                m_ranges[k].end = count * (k + 1) / m_size;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_task = [](void* ctx, std::size_t i) { (*static_cast<fn_t*>(ctx))(i); };
+                m_ctx = const_cast<void*>(static_cast<const void*>(&fn));
+                m_failed = false;
+                m_pending = m_size - 1;
+                ++m_generation;
+            }
+            m_wake.notify_all();
+            work(0);
+
+            std::exception_ptr error;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done.wait(lock, [this]() { return m_pending == 0; });
+                error = m_error;
+                m_error = nullptr;
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+    private:
+        static std::size_t hardware_threads() {
+            const unsigned n = std::thread::hardware_concurrency();
+            return n != 0 ? n : 1;
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (std::thread& t : m_threads) t.join();
+        }
+
+        void worker(std::size_t k) {
+            std::size_t seen = 0;
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+                    if (m_stop) return;
+                    seen = m_generation;
+                }
+                work(k);
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_pending == 0) m_done.notify_one();
+            }
+        }
+
+        // runs the tasks of the current loop on thread k until no thread has any left
+        void work(std::size_t k) {
+            detail::current_pool() = this;
+            std::size_t i;
+            while (take(k, i) || steal(k, i)) {
+                if (m_failed.load(std::memory_order_relaxed)) continue;
+                try {
+                    m_task(m_ctx, i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_error) m_error = std::current_exception();
+                    m_failed = true;
+                }
+            }
+            detail::current_pool() = nullptr;
+        }
+
+        bool take(std::size_t k, std::size_t& i) {
+            detail::steal_range& r = m_ranges[k];
+            std::lock_guard<std::mutex> lock(r.mutex);
+            if (r.begin == r.end) return false;
+            i = r.begin++;
+            return true;
+        }
+
+        // moves the back half of the indices of another thread to thread k and takes the first
+        bool steal(std::size_t k, std::size_t& i) {
+            for (std::size_t d = 1; d < m_size; ++d) {
+                detail::steal_range& victim = m_ranges[(k + d) % m_size];
+                std::size_t first, last;
+                {
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if (victim.begin == victim.end) continue;
+                    first = victim.begin + (victim.end - victim.begin) / 2;
+                    last = victim.end;
+                    victim.end = first;
+                }
+                i = first;
+                std::lock_guard<std::mutex> lock(m_ranges[k].mutex);
+                m_ranges[k].begin = first + 1;
+                m_ranges[k].end = last;
+                return true;
+            }
+            return false;
+        }
+
+        std::size_t m_size;
+        std::unique_ptr<detail::steal_range[]> m_ranges;
+        std::vector<std::thread> m_threads;
+        std::mutex m_call;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+        std::size_t m_generation = 0;
+        std::size_t m_pending = 0;
+        bool m_stop = false;
+        void (*m_task)(void*, std::size_t) = nullptr;
+        void* m_ctx = nullptr;
+        std::atomic<bool> m_failed{false};
+        std::exception_ptr m_error;
+    };
+
+    SIMDEE_ISA_NAMESPACE_END
+} // namespace sd
+
+#endif // SIMDEE_UTIL_THREAD_POOL_HPP
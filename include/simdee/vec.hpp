@@ -0,0 +1,114 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_VEC_HPP
+#define SIMDEE_VEC_HPP
+
+#include "common/init.hpp"
+#include "simd_vectors/dual.hpp"
+#include "simd_vectors/dum.hpp"
+#include "vec16.hpp"
+#include "vec2.hpp"
+#include "vec32.hpp"
+#include "vec4.hpp"
+#include "vec8.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    namespace impl {
+        // vectors without a fixed-width alias are a dual of two halves, masks limit them to 64
+        // lanes
+        template <typename T, std::size_t N>
+        struct vec_alias {
+            static_assert(N > 1 && N <= 64 && (N & (N - 1)) == 0,
+                          "sd::vec: N must be a power of two up to 64 and T a supported scalar");
+            using type = dual<typename vec_alias<T, N / 2>::type>;
+        };
+
+#define SIMDEE_VEC_ALIAS(T, N, VEC)                                                               \
+    template <>                                                                                    \
+    struct vec_alias<T, N> {                                                                       \
+        using type = VEC;                                                                          \
+    }
+
+        SIMDEE_VEC_ALIAS(bool32_t, 1, dumb);
+        SIMDEE_VEC_ALIAS(bool32_t, 4, vec4b);
+        SIMDEE_VEC_ALIAS(bool32_t, 8, vec8b);
+        SIMDEE_VEC_ALIAS(float, 1, dumf);
+        SIMDEE_VEC_ALIAS(float, 4, vec4f);
+        SIMDEE_VEC_ALIAS(float, 8, vec8f);
+        SIMDEE_VEC_ALIAS(uint32_t, 1, dumu);
+        SIMDEE_VEC_ALIAS(uint32_t, 4, vec4u);
+        SIMDEE_VEC_ALIAS(uint32_t, 8, vec8u);
+        SIMDEE_VEC_ALIAS(int32_t, 1, dums);
+        SIMDEE_VEC_ALIAS(int32_t, 4, vec4s);
+        SIMDEE_VEC_ALIAS(int32_t, 8, vec8s);
+
+        SIMDEE_VEC_ALIAS(bool64_t, 1, dumb64);
+        SIMDEE_VEC_ALIAS(bool64_t, 2, vec2b64);
+        SIMDEE_VEC_ALIAS(bool64_t, 4, vec4b64);
+        SIMDEE_VEC_ALIAS(double, 1, dumd);
+        SIMDEE_VEC_ALIAS(double, 2, vec2d);
+        SIMDEE_VEC_ALIAS(double, 4, vec4d);
+        SIMDEE_VEC_ALIAS(uint64_t, 1, dumu64);
+        SIMDEE_VEC_ALIAS(uint64_t, 2, vec2u64);
+        SIMDEE_VEC_ALIAS(uint64_t, 4, vec4u64);
+        SIMDEE_VEC_ALIAS(int64_t, 1, dums64);
+        SIMDEE_VEC_ALIAS(int64_t, 2, vec2s64);
+        SIMDEE_VEC_ALIAS(int64_t, 4, vec4s64);
+
+        SIMDEE_VEC_ALIAS(bool16_t, 1, dumb16);
+        SIMDEE_VEC_ALIAS(bool16_t, 8, vec8b16);
+        SIMDEE_VEC_ALIAS(bool16_t, 16, vec16b16);
+        SIMDEE_VEC_ALIAS(uint16_t, 1, dumu16);
+        SIMDEE_VEC_ALIAS(uint16_t, 8, vec8u16);
+        SIMDEE_VEC_ALIAS(uint16_t, 16, vec16u16);
+        SIMDEE_VEC_ALIAS(int16_t, 1, dums16);
+        SIMDEE_VEC_ALIAS(int16_t, 8, vec8s16);
+        SIMDEE_VEC_ALIAS(int16_t, 16, vec16s16);
+
+        SIMDEE_VEC_ALIAS(bool8_t, 1, dumb8);
+        SIMDEE_VEC_ALIAS(bool8_t, 16, vec16b8);
+        SIMDEE_VEC_ALIAS(bool8_t, 32, vec32b8);
+        SIMDEE_VEC_ALIAS(uint8_t, 1, dumu8);
+        SIMDEE_VEC_ALIAS(uint8_t, 16, vec16u8);
+        SIMDEE_VEC_ALIAS(uint8_t, 32, vec32u8);
+        SIMDEE_VEC_ALIAS(int8_t, 1, dums8);
+        SIMDEE_VEC_ALIAS(int8_t, 16, vec16s8);
+        SIMDEE_VEC_ALIAS(int8_t, 32, vec32s8);
+
+#undef SIMDEE_VEC_ALIAS
+
+        // size of the widest register that the vec aliases map to a single native vector
+#if (!SIMDEE_NEED_INT && SIMDEE_AVX) || SIMDEE_AVX2
+        constexpr std::size_t native_bytes_32_64 = 32;
+#else
+        constexpr std::size_t native_bytes_32_64 = 16;
+#endif
+#if SIMDEE_AVX2
+        constexpr std::size_t native_bytes_8_16 = 32;
+#else
+        constexpr std::size_t native_bytes_8_16 = 16;
+#endif
+    }
+
+    // vector of N scalars of type T, N is a power of two from 1 to 64
+    template <typename T, std::size_t N>
+    using vec = typename impl::vec_alias<T, N>::type;
+
+    // number of scalars of type T in the widest native vector of the current build
+    template <typename T>
+    struct native_width
+        : std::integral_constant<std::size_t, (sizeof(T) >= 4 ? impl::native_bytes_32_64
+                                                              : impl::native_bytes_8_16) /
+                                                  sizeof(T)> {};
+
+    // the widest native vector of the current build for scalars of type T
+    template <typename T>
+    using native_vec = vec<T, native_width<T>::value>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif // SIMDEE_VEC_HPP
@@ -0,0 +1,85 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_VEC16_HPP
+#define SIMDEE_VEC16_HPP
+
+#include "common/init.hpp"
+
+//
+// SSE-accelerated vec16 implementation, 8-bit lanes
+//
+#if SIMDEE_SSE2
+#include "simd_vectors/sse.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec16b8 = sseb8;
+    using vec16u8 = sseu8;
+    using vec16s8 = sses8;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// NEON-accelerated vec16 implementation, 8-bit lanes
+//
+#elif SIMDEE_NEON
+#include "simd_vectors/neon.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec16b8 = neonb8;
+    using vec16u8 = neonu8;
+    using vec16s8 = neons8;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec16 implementation, 8-bit lanes
+//
+#else
+#include "simd_vectors/dual.hpp"
+#include "simd_vectors/dum.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec16b8 = dual<dual<dual<dual<dumb8>>>>;
+    using vec16u8 = dual<dual<dual<dual<dumu8>>>>;
+    using vec16s8 = dual<dual<dual<dual<dums8>>>>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif
+
+//
+// AVX-accelerated vec16 implementation, 16-bit lanes
+//
+#if SIMDEE_AVX2
+#include "simd_vectors/avx.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec16b16 = avxb16;
+    using vec16u16 = avxu16;
+    using vec16s16 = avxs16;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec16 implementation, 16-bit lanes
+//
+#else
+#include "simd_vectors/dual.hpp"
+#include "vec8.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec16b16 = dual<vec8b16>;
+    using vec16u16 = dual<vec8u16>;
+    using vec16s16 = dual<vec8s16>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif
+
+#endif // SIMDEE_VEC16_HPP
@@ -0,0 +1,40 @@
+// This file is a part of Simdee, see homepage at http://github.com/hrabalik/simdee
+// This file is distributed under the MIT license.
+
+#ifndef SIMDEE_VEC32_HPP
+#define SIMDEE_VEC32_HPP
+
+#include "common/init.hpp"
+
+//
+// AVX-accelerated vec32 implementation, 8-bit lanes
+//
+#if SIMDEE_AVX2
+#include "simd_vectors/avx.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec32b8 = avxb8;
+    using vec32u8 = avxu8;
+    using vec32s8 = avxs8;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec32 implementation, 8-bit lanes
+//
+#else
+#include "simd_vectors/dual.hpp"
+#include "vec16.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec32b8 = dual<vec16b8>;
+    using vec32u8 = dual<vec16u8>;
+    using vec32s8 = dual<vec16s8>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif
+
+#endif // SIMDEE_VEC32_HPP
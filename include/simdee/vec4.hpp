@@ -13,10 +13,12 @@
 #include "simd_vectors/sse.hpp"
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     using vec4b = sseb;
     using vec4f = ssef;
     using vec4u = sseu;
     using vec4s = sses;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 //
@@ -26,10 +28,27 @@ namespace sd {
 #include "simd_vectors/neon.hpp"
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     using vec4b = neonb;
     using vec4f = neonf;
     using vec4u = neonu;
     using vec4s = neons;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec4 implementation, vectorized by the compiler for the target in effect
+//
+#elif SIMDEE_GNU_VECTORS
+#include "simd_vectors/gnu.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec4b = gnub;
+    using vec4f = gnuf;
+    using vec4u = gnuu;
+    using vec4s = gnus;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 //
@@ -40,10 +59,45 @@ namespace sd {
 #include "simd_vectors/dum.hpp"
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     using vec4b = dual<dual<dumb>>;
     using vec4f = dual<dual<dumf>>;
     using vec4u = dual<dual<dumu>>;
     using vec4s = dual<dual<dums>>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif
+
+//
+// AVX-accelerated vec4 implementation, 64-bit lanes
+//
+#if (!SIMDEE_NEED_INT && SIMDEE_AVX) || SIMDEE_AVX2
+#include "simd_vectors/avx.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec4b64 = avxb64;
+    using vec4d = avxd;
+    using vec4u64 = avxu64;
+    using vec4s64 = avxs64;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec4 implementation, 64-bit lanes
+//
+#else
+#include "simd_vectors/dual.hpp"
+#include "vec2.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec4b64 = dual<vec2b64>;
+    using vec4d = dual<vec2d>;
+    using vec4u64 = dual<vec2u64>;
+    using vec4s64 = dual<vec2s64>;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif
@@ -13,10 +13,12 @@
 #include "simd_vectors/avx.hpp"
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     using vec8b = avxb;
     using vec8f = avxf;
     using vec8u = avxu;
     using vec8s = avxs;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 //
@@ -27,10 +29,57 @@ namespace sd {
 #include "vec4.hpp"
 
 namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
     using vec8b = dual<vec4b>;
     using vec8f = dual<vec4f>;
     using vec8u = dual<vec4u>;
     using vec8s = dual<vec4s>;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+#endif
+
+//
+// SSE-accelerated vec8 implementation, 16-bit lanes
+//
+#if SIMDEE_SSE2
+#include "simd_vectors/sse.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec8b16 = sseb16;
+    using vec8u16 = sseu16;
+    using vec8s16 = sses16;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// NEON-accelerated vec8 implementation, 16-bit lanes
+//
+#elif SIMDEE_NEON
+#include "simd_vectors/neon.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec8b16 = neonb16;
+    using vec8u16 = neonu16;
+    using vec8s16 = neons16;
+    SIMDEE_ISA_NAMESPACE_END
+}
+
+//
+// Emulated vec8 implementation, 16-bit lanes
+//
+#else
+#include "simd_vectors/dual.hpp"
+#include "simd_vectors/dum.hpp"
+
+namespace sd {
+    SIMDEE_ISA_NAMESPACE_BEGIN
+    using vec8b16 = dual<dual<dual<dumb16>>>;
+    using vec8u16 = dual<dual<dual<dumu16>>>;
+    using vec8s16 = dual<dual<dual<dums16>>>;
+    SIMDEE_ISA_NAMESPACE_END
 }
 
 #endif
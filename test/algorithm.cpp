@@ -0,0 +1,226 @@
+#include <catch2/catch.hpp>
+#include <simdee/algorithm.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+#include <simdee/simdee.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace {
+    // sizes around the multiples of the vector width, including empty and partial arrays
+    template <typename Simd_t>
+    std::vector<std::size_t> sizes() {
+        const std::size_t w = Simd_t::width;
+        return {0, 1, w - 1, w, w + 1, 3 * w - 1, 3 * w, 100 * w + w / 2 + 1};
+    }
+
+    template <typename U>
+    void test_scan_uint() {
+        using scalar_t = typename U::scalar_t;
+        for (std::size_t n : sizes<U>()) {
+            std::vector<scalar_t> in(n), out(n), gt(n);
+            for (std::size_t i = 0; i < n; ++i) in[i] = scalar_t((i * 2654435761u) >> 7);
+
+            std::partial_sum(in.begin(), in.end(), gt.begin());
+            sd::scan<U>(in.data(), out.data(), n, sd::op_add{});
+            REQUIRE(out == gt);
+
+            std::partial_sum(in.begin(), in.end(), gt.begin(),
+                             [](scalar_t a, scalar_t b) { return std::max(a, b); });
+            sd::scan<U>(in.data(), out.data(), n, sd::op_max{});
+            REQUIRE(out == gt);
+
+            // in place
+            std::partial_sum(in.begin(), in.end(), gt.begin(), std::bit_xor<scalar_t>());
+            sd::scan<U>(in.data(), in.data(), n, sd::op_bitxor{});
+            REQUIRE(in == gt);
+        }
+    }
+
+    template <typename F>
+    void test_view() {
+        for (std::size_t n : sizes<F>()) {
+            std::vector<float> a(n), b(n), c(n), out(n), gt(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = float(i % 13) - 6.f;
+                b[i] = float(i % 5) + 0.5f;
+                c[i] = float(i % 3);
+            }
+            const std::vector<float>& ca = a;
+
+            // operands may be const, and an assignment never rebinds the destination
+            sd::assign<F>(sd::view(out), sd::view(ca) * sd::view(b) + sd::view(c));
+            for (std::size_t i = 0; i < n; ++i) gt[i] = a[i] * b[i] + c[i];
+            REQUIRE(out == gt);
+
+            sd::assign<F>(sd::view(out), 2.f - sd::view(a) / sd::view(b) * 4.f);
+            for (std::size_t i = 0; i < n; ++i) gt[i] = 2.f - a[i] / b[i] * 4.f;
+            REQUIRE(out == gt);
+
+            sd::assign<F>(sd::view(out), sd::min(sd::abs(-sd::view(a)), 3.f));
+            for (std::size_t i = 0; i < n; ++i) gt[i] = std::min(std::abs(a[i]), 3.f);
+            REQUIRE(out == gt);
+
+            sd::assign<F>(sd::view(out), sd::fma(sd::view(a), sd::view(b), sd::view(c)));
+            for (std::size_t i = 0; i < n; ++i) gt[i] = a[i] * b[i] + c[i];
+            REQUIRE(out == gt);
+
+            // only the first scalars of the destination are written if a source is shorter
+            std::fill(out.begin(), out.end(), -1.f);
+            sd::assign<F>(sd::view(out), sd::sqrt(sd::view(b.data(), n / 2)) + 1.f);
+            for (std::size_t i = 0; i < n; ++i) {
+                gt[i] = i < n / 2 ? std::sqrt(b[i]) + 1.f : -1.f;
+            }
+            REQUIRE(out == gt);
+        }
+    }
+
+    template <std::size_t K, typename F>
+    void test_accumulate() {
+        for (std::size_t n : sizes<F>()) {
+            // small integers keep the float sums exact in any order
+            std::vector<float> a(n), b(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = float(i % 13) - 6.f;
+                b[i] = float(i % 3);
+            }
+            float sum = 0.f, dot = 0.f, lo = std::numeric_limits<float>::infinity();
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += a[i];
+                dot += a[i] * b[i];
+                lo = std::min(lo, a[i] + 7.f);
+            }
+
+            REQUIRE(sd::accumulate<K, F>(sd::view(a), sd::op_add{}) == sum);
+            REQUIRE(sd::accumulate<K, F>(sd::view(a) * sd::view(b), sd::op_add{}) == dot);
+            REQUIRE(sd::accumulate<K, F>(sd::view(a) + 7.f, sd::op_min{}) == lo);
+        }
+    }
+
+    template <typename F>
+    void test_scan_float() {
+        for (std::size_t n : sizes<F>()) {
+            // small integers keep the float sums exact
+            std::vector<float> in(n), out(n), gt(n);
+            for (std::size_t i = 0; i < n; ++i) in[i] = float(i % 7) - 3.f;
+
+            std::partial_sum(in.begin(), in.end(), gt.begin());
+            sd::scan<F>(in.data(), out.data(), n, sd::op_add{});
+            REQUIRE(out == gt);
+
+            std::partial_sum(in.begin(), in.end(), gt.begin(),
+                             [](float a, float b) { return std::min(a, b); });
+            sd::scan<F>(in.data(), out.data(), n, sd::op_min{});
+            REQUIRE(out == gt);
+        }
+    }
+
+    // body is called once for each block in order, and src for the block Distance ahead
+    template <std::size_t Distance>
+    void test_prefetched_for(std::size_t n) {
+        std::vector<float> data(8 * n + 8);
+        std::vector<std::size_t> calls, sources;
+        auto src = [&](std::size_t j) {
+            sources.push_back(j);
+            return sd::interleaved(data.data() + j, 8);
+        };
+        sd::prefetched_for<sd::vec8f, Distance>(n, src, [&](std::size_t j) { calls.push_back(j); });
+
+        std::vector<std::size_t> gt(n), gt_sources;
+        std::iota(gt.begin(), gt.end(), std::size_t(0));
+        for (std::size_t j = Distance; Distance != 0 && j < n; ++j) gt_sources.push_back(j);
+        REQUIRE(calls == gt);
+        REQUIRE(sources == gt_sources);
+    }
+}
+
+TEST_CASE("algorithm scan", "[algorithm]") {
+    SECTION("vec4f") { test_scan_float<sd::vec4f>(); }
+    SECTION("vec8f") { test_scan_float<sd::vec8f>(); }
+    SECTION("dual<vec4f>") { test_scan_float<sd::dual<sd::vec4f>>(); }
+    SECTION("dumf") { test_scan_float<sd::dumf>(); }
+    SECTION("vec4u") { test_scan_uint<sd::vec4u>(); }
+    SECTION("vec8u") { test_scan_uint<sd::vec8u>(); }
+    SECTION("dual<dumu>") { test_scan_uint<sd::dual<sd::dumu>>(); }
+}
+
+TEST_CASE("algorithm view", "[algorithm]") {
+    SECTION("vec4f") { test_view<sd::vec4f>(); }
+    SECTION("vec8f") { test_view<sd::vec8f>(); }
+    SECTION("vec<float, 32>") { test_view<sd::vec<float, 32>>(); }
+    SECTION("dumf") { test_view<sd::dumf>(); }
+
+    SECTION("native_vec, assignment operators") {
+        const std::size_t n = 1000;
+        std::vector<uint32_t> a(n), b(n), gt(n);
+        for (std::size_t i = 0; i < n; ++i) a[i] = uint32_t(i * 7);
+
+        sd::view(b) = sd::view(a);
+        REQUIRE(b == a);
+        sd::view(b) += sd::view(a) * 3U;
+        sd::view(b) -= 1U;
+        sd::view(b) *= sd::view(a);
+        sd::view(b) = sd::max(sd::view(b), 5U);
+        for (std::size_t i = 0; i < n; ++i) gt[i] = std::max((a[i] * 4U - 1U) * a[i], 5U);
+        REQUIRE(b == gt);
+    }
+}
+
+TEST_CASE("algorithm accumulate", "[algorithm]") {
+    SECTION("vec4f") { test_accumulate<1, sd::vec4f>(); }
+    SECTION("vec8f") { test_accumulate<3, sd::vec8f>(); }
+    SECTION("vec8f, default") { test_accumulate<0, sd::vec8f>(); }
+    SECTION("vec<float, 16>") { test_accumulate<4, sd::vec<float, 16>>(); }
+    SECTION("dumf") { test_accumulate<8, sd::dumf>(); }
+
+    SECTION("native_vec, uint32_t") {
+        std::vector<uint32_t> a(1003);
+        for (std::size_t i = 0; i < a.size(); ++i) a[i] = uint32_t(i * 2654435761u);
+        const uint32_t gt_xor = std::accumulate(a.begin(), a.end(), 0U, std::bit_xor<uint32_t>());
+        const uint32_t gt_max = *std::max_element(a.begin(), a.end());
+        REQUIRE(sd::accumulate(sd::view(a), sd::op_bitxor{}) == gt_xor);
+        REQUIRE(sd::accumulate(sd::view(a), sd::op_max{}) == gt_max);
+        REQUIRE(sd::accumulate(sd::view(a.data(), 0), sd::op_max{}) == 0U);
+    }
+
+    SECTION("unrolled_for") {
+        const std::size_t n = 37;
+        std::vector<int32_t> hits(n);
+        const auto acc = sd::unrolled_for<4>(n, sd::vec4s(0), [&](sd::vec4s& a, std::size_t j) {
+            hits[j] += 1;
+            a = a + sd::vec4s(int32_t(j));
+        }, sd::op_add{});
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](int32_t h) { return h == 1; }));
+        REQUIRE(all(acc == sd::vec4s(int32_t(n * (n - 1) / 2))));
+    }
+}
+
+TEST_CASE("algorithm prefetch", "[algorithm]") {
+    SECTION("prefetched_for") {
+        for (std::size_t n : {0U, 1U, 3U, 4U, 5U, 100U}) {
+            test_prefetched_for<0>(n);
+            test_prefetched_for<1>(n);
+            test_prefetched_for<4>(n);
+        }
+    }
+
+    SECTION("prefetch_load doesn't change the data") {
+        std::vector<float> a(1024);
+        std::iota(a.begin(), a.end(), 0.f);
+        const std::vector<float> gt = a;
+        sd::prefetch(a.data());
+        sd::prefetch<sd::locality::none>(a.data() + 100);
+        sd::prefetch_load<sd::vec8f>(sd::aligned(a.data()));
+        sd::prefetch_load<sd::vec8f, sd::locality::low>(sd::unaligned(a.data() + 1));
+        sd::prefetch_load<sd::vec8f>(sd::interleaved(a.data(), 3));
+        sd::prefetch_load<sd::vec8f>(sd::interleaved(a.data() + 1000, -100));
+        sd::prefetch_load<sd::vec8f, sd::locality::moderate>(sd::gather(a.data(), sd::vec8s(5)));
+        sd::prefetch_load<sd::dual<sd::vec4f>>(sd::interleaved(a.data(), 64));
+        REQUIRE(a == gt);
+    }
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <list>
+#include <simdee/util/arena.hpp>
+#include <vector>
+
+TEST_CASE("arena", "[allocator]") {
+    SECTION("alignment") {
+        sd::arena a(64 * 1024);
+        for (std::size_t align : {1u, 8u, 64u, 4096u, 65536u}) {
+            void* p = a.allocate(100, align);
+            REQUIRE(uintptr_t(p) % align == 0);
+            std::fill_n(static_cast<char*>(p), 100, char(1));
+        }
+        REQUIRE(a.used() <= a.capacity());
+    }
+    SECTION("reset reuses the chunks") {
+        sd::arena a(4096);
+        void* first = a.allocate(1000);
+        a.allocate(3000);
+        a.allocate(10000);
+        const std::size_t capacity = a.capacity();
+        REQUIRE(capacity >= 14000);
+        a.reset();
+        REQUIRE(a.used() == 0);
+        REQUIRE(a.allocate(1000) == first);
+        a.allocate(3000);
+        a.allocate(10000);
+        REQUIRE(a.capacity() == capacity);
+    }
+    SECTION("arena_allocator") {
+        sd::arena a(1 << 16);
+        std::vector<float, sd::arena_allocator<float, 64>> vec{sd::arena_allocator<float, 64>(a)};
+        for (int i = 0; i < 10000; ++i) { vec.push_back(float(i)); }
+        REQUIRE(uintptr_t(vec.data()) % 64 == 0);
+        REQUIRE(vec[1234] == 1234.f);
+        REQUIRE(a.used() >= 10000 * sizeof(float));
+    }
+    SECTION("huge pages") {
+        for (sd::huge_pages mode : {sd::huge_pages::advise, sd::huge_pages::mapped}) {
+            sd::arena a(std::size_t(4) << 20, mode);
+            char* p = static_cast<char*>(a.allocate(std::size_t(3) << 20, 4096));
+            REQUIRE(uintptr_t(p) % 4096 == 0);
+            std::fill_n(p, std::size_t(3) << 20, char(2));
+            REQUIRE(p[12345] == 2);
+        }
+    }
+}
+
+TEST_CASE("pool", "[allocator]") {
+    SECTION("blocks are recycled") {
+        sd::pool p(24, 32, 4096);
+        REQUIRE(p.block_size() == 32);
+        void* a = p.allocate();
+        void* b = p.allocate();
+        REQUIRE(a != b);
+        REQUIRE(uintptr_t(a) % 32 == 0);
+        REQUIRE(uintptr_t(b) % 32 == 0);
+        p.deallocate(a);
+        REQUIRE(p.allocate() == a);
+        for (int i = 0; i < 1000; ++i) { REQUIRE(uintptr_t(p.allocate()) % 32 == 0); }
+        p.reset();
+        REQUIRE(p.allocate() == a);
+    }
+    SECTION("pool_allocator") {
+        sd::pool p(64);
+        std::list<int, sd::pool_allocator<int>> list{sd::pool_allocator<int>(p)};
+        for (int i = 0; i < 1000; ++i) { list.push_back(i); }
+        list.remove_if([](int i) { return i % 2 == 0; });
+        for (int i = 0; i < 500; ++i) { list.push_front(-i); }
+        REQUIRE(list.size() == 1000);
+        REQUIRE(list.back() == 999);
+        REQUIRE(list.front() == -499);
+
+        sd::pool_allocator<int> alloc(p);
+        REQUIRE_THROWS_AS(alloc.allocate(100), std::bad_alloc);
+    }
+}
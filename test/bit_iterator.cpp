@@ -12,6 +12,23 @@ TEST_CASE("lsb", "[bit_iterator]") {
     REQUIRE(sd::detail::lsb(0x80000000) == 31);
 }
 
+TEST_CASE("msb", "[bit_iterator]") {
+    REQUIRE(sd::detail::msb(0x1) == 0);
+    REQUIRE(sd::detail::msb(0xab) == 7);
+    REQUIRE(sd::detail::msb(0x80000001) == 31);
+}
+
+TEST_CASE("64-bit lsb, msb and popcount", "[bit_iterator]") {
+    REQUIRE(sd::detail::lsb(uint64_t(0x1)) == 0);
+    REQUIRE(sd::detail::lsb(uint64_t(0x8000000000000000ULL)) == 63);
+    REQUIRE(sd::detail::lsb(uint64_t(0x0000030000000000ULL)) == 40);
+    REQUIRE(sd::detail::msb(uint64_t(0x1)) == 0);
+    REQUIRE(sd::detail::msb(uint64_t(0x00000000f0000000ULL)) == 31);
+    REQUIRE(sd::detail::msb(uint64_t(0x0000030000000001ULL)) == 41);
+    REQUIRE(sd::detail::popcount(0xf0f0U) == 8);
+    REQUIRE(sd::detail::popcount(uint64_t(0xff000000000000f1ULL)) == 13);
+}
+
 TEST_CASE("bit_iterator", "[bit_iterator]") {
     sd::bit_iterator i{0x80040023};
     sd::bit_iterator end{0};
@@ -32,3 +49,15 @@ TEST_CASE("bit_iterator", "[bit_iterator]") {
     i++;
     REQUIRE(i == end);
 }
+
+TEST_CASE("64-bit bit_iterator", "[bit_iterator]") {
+    sd::basic_bit_iterator<uint64_t> i{0x8000000100000004ULL};
+    sd::basic_bit_iterator<uint64_t> end{0};
+    REQUIRE(*i == 2);
+    ++i;
+    REQUIRE(*i == 32);
+    ++i;
+    REQUIRE(*i == 63);
+    ++i;
+    REQUIRE(i == end);
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <simdee/util/dispatch.hpp>
+#include <string>
+#include <vector>
+
+using kernel_t = sd::isa(const float*, float*, std::size_t);
+using library_t = sd::isa (*())();
+
+kernel_t dispatch_kernel_scalar;
+#if SIMDEE_TEST_DISPATCH_X86
+kernel_t dispatch_kernel_sse2;
+kernel_t dispatch_kernel_avx;
+kernel_t dispatch_kernel_avx2;
+library_t dispatch_library_scalar;
+library_t dispatch_library_sse2;
+library_t dispatch_library_avx;
+library_t dispatch_library_avx2;
+#endif
+
+namespace {
+    sd::dispatched<kernel_t> make_kernel() {
+        return sd::dispatched<kernel_t>{
+            {sd::isa::scalar, dispatch_kernel_scalar},
+#if SIMDEE_TEST_DISPATCH_X86
+            {sd::isa::sse2, dispatch_kernel_sse2},
+            {sd::isa::avx, dispatch_kernel_avx},
+            {sd::isa::avx2, dispatch_kernel_avx2},
+#endif
+        };
+    }
+
+    bool cpu_supports(sd::isa tier) {
+        if (tier == sd::isa::scalar) return true;
+        if (sd::cpu_isa() == sd::isa::neon) return tier == sd::isa::neon;
+        return tier != sd::isa::neon && int(tier) <= int(sd::cpu_isa());
+    }
+}
+
+TEST_CASE("cpu_isa", "[dispatch]") {
+    REQUIRE(sd::cpu_isa() == sd::detail::detect_isa());
+    REQUIRE(cpu_supports(SIMDEE_COMPILED_ISA));
+    REQUIRE(std::string(sd::isa_name(sd::isa::avx2)) == "AVX2");
+}
+
+TEST_CASE("dispatched", "[dispatch]") {
+    const std::size_t n = 37;
+    std::vector<float> in(n), out(n), expected(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        in[i] = 0.25f * float(i) - 3.f;
+        expected[i] = in[i] * in[i] + 1.f;
+    }
+
+    auto kernel = make_kernel();
+
+    SECTION("selects the best tier on construction") {
+        const sd::isa tier = kernel.selected();
+        REQUIRE(cpu_supports(tier));
+        REQUIRE(kernel(in.data(), out.data(), n) == tier);
+        REQUIRE(out == expected);
+#if SIMDEE_TEST_DISPATCH_X86
+        REQUIRE(tier == sd::cpu_isa());
+#endif
+    }
+    SECTION("each tier can be forced") {
+        for (sd::isa tier : {sd::isa::scalar, sd::isa::sse2, sd::isa::avx, sd::isa::avx2}) {
+#if !SIMDEE_TEST_DISPATCH_X86
+            if (tier != sd::isa::scalar) continue;
+#endif
+            if (!cpu_supports(tier)) {
+                WARN("skipping tier " << sd::isa_name(tier) << ", not supported by the CPU");
+                continue;
+            }
+            std::fill(out.begin(), out.end(), 0.f);
+            REQUIRE(kernel.select(tier) == tier);
+            REQUIRE(kernel.selected() == tier);
+            REQUIRE(kernel(in.data(), out.data(), n) == tier);
+            REQUIRE(out == expected);
+        }
+    }
+    SECTION("never selects a tier unsupported by the CPU") {
+        const sd::isa tier = kernel.select(sd::isa::neon);
+        REQUIRE(cpu_supports(tier));
+    }
+    SECTION("falls back to a lower tier") {
+        sd::dispatched<kernel_t> partial{{sd::isa::scalar, dispatch_kernel_scalar}};
+        REQUIRE(partial.select(sd::isa::avx2) == sd::isa::scalar);
+        REQUIRE(partial(in.data(), out.data(), n) == sd::isa::scalar);
+        REQUIRE(out == expected);
+    }
+    SECTION("throws without a usable implementation") {
+        using entries_t = std::initializer_list<sd::dispatched<kernel_t>::entry_t>;
+        REQUIRE_THROWS_AS(sd::dispatched<kernel_t>(entries_t{}), std::runtime_error);
+    }
+}
+
+#if SIMDEE_TEST_DISPATCH_X86
+TEST_CASE("dispatch tiers don't share the library", "[dispatch]") {
+    // the scalar kernel is compiled with the SSE2 flags, so it shares the SSE2 copy
+    REQUIRE(dispatch_library_scalar() == dispatch_library_sse2());
+    const std::vector<sd::isa (*)()> copies = {&sd::cpu_isa, dispatch_library_sse2(),
+                                               dispatch_library_avx(), dispatch_library_avx2()};
+    for (std::size_t i = 0; i < copies.size(); ++i) {
+        for (std::size_t j = i + 1; j < copies.size(); ++j) REQUIRE(copies[i] != copies[j]);
+    }
+}
+#endif
@@ -0,0 +1,12 @@
+#include <simdee/simdee.hpp>
+#include <simdee/util/dispatch.hpp>
+
+using F = sd::vec8f;
+
+#define DISPATCH_KERNEL dispatch_kernel_avx
+#define DISPATCH_LIBRARY dispatch_library_avx
+#define DISPATCH_TIER sd::isa::avx
+
+static_assert(DISPATCH_TIER == SIMDEE_COMPILED_ISA, "compiled for a wrong instruction set");
+
+#include "dispatch_kernel.inl"
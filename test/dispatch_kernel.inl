@@ -0,0 +1,37 @@
+//
+// kernel for the runtime dispatch tests, compiled once per instruction set
+//
+// following macros are expected to be defined
+// DISPATCH_KERNEL -- name of the function that runs the kernel
+// DISPATCH_TIER -- the sd::isa the kernel is compiled for
+// DISPATCH_LIBRARY -- name of the function that returns the address of a library function
+//
+// following types are expected to be defined
+// F -- SIMD vector of floats to run the kernel with
+//
+
+#include <cstddef>
+#include <simdee/util/dispatch.hpp>
+
+// internal linkage keeps the instantiations in different translation units apart
+namespace {
+    template <typename T>
+    void square_plus_one(const float* in, float* out, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + T::width <= n; i += T::width) {
+            T x = sd::unaligned(in + i);
+            T r = x * x + T(1.f);
+            r.unaligned_store(out + i);
+        }
+        for (; i < n; ++i) out[i] = in[i] * in[i] + 1.f;
+    }
+}
+
+sd::isa DISPATCH_KERNEL(const float* in, float* out, std::size_t n) {
+    square_plus_one<F>(in, out, n);
+    return DISPATCH_TIER;
+}
+
+// the address of an inline function is the same in all translation units that share it, so the
+// tiers must each return a different one
+sd::isa (*DISPATCH_LIBRARY())() { return &sd::cpu_isa; }
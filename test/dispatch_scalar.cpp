@@ -0,0 +1,10 @@
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+
+using F = sd::dual<sd::dual<sd::dual<sd::dumf>>>;
+
+#define DISPATCH_KERNEL dispatch_kernel_scalar
+#define DISPATCH_LIBRARY dispatch_library_scalar
+#define DISPATCH_TIER sd::isa::scalar
+
+#include "dispatch_kernel.inl"
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 #include <simdee/common/mask.hpp>
+#include <bitset>
+#include <type_traits>
 #include <vector>
 
 constexpr uint32_t activeBits = 0x77777777U;
@@ -92,4 +94,41 @@ TEST_CASE("mask", "[mask]") {
         REQUIRE(received(m1) == expected(u1));
         REQUIRE(received(m2) == expected(u2));
     }
+
+    SECTION("none(), popcount(), find_first(), find_last()") {
+        REQUIRE(none(m0) == true);
+        REQUIRE(none(m1) == false);
+        REQUIRE(popcount(m0) == 0);
+        REQUIRE(popcount(mA) == 24);
+        REQUIRE(popcount(m1) == int(std::bitset<32>(u1).count()));
+        REQUIRE(find_first(m0) == -1);
+        REQUIRE(find_last(m0) == -1);
+        REQUIRE(find_first(m1) == 0);
+        REQUIRE(find_last(m1) == 30);
+        REQUIRE(find_first(m2) == 2);
+        REQUIRE(find_last(m2) == 29);
+    }
+}
+
+TEST_CASE("mask with 64 lanes", "[mask]") {
+    using mask64_t = sd::impl::mask<0xffffffffffffffffULL>;
+    static_assert(std::is_same<mask64_t::bits_t, uint64_t>::value, "64-bit storage expected");
+    static_assert(std::is_same<mask_t::bits_t, uint32_t>::value, "32-bit storage expected");
+
+    const uint64_t u = 0x8000a00000000006ULL;
+    const mask64_t m(u);
+    REQUIRE(m[1] == true);
+    REQUIRE(m[45] == true);
+    REQUIRE(m[46] == false);
+    REQUIRE(m[63] == true);
+    REQUIRE((~m).value == ~u);
+    REQUIRE(all(~mask64_t(0)));
+    REQUIRE(popcount(m) == 5);
+    REQUIRE(find_first(m) == 1);
+    REQUIRE(find_last(m) == 63);
+    REQUIRE(find_first(mask64_t(u & ~0xffffffffULL)) == 45);
+
+    std::vector<uint32_t> received;
+    for (auto i : m) received.push_back(i);
+    REQUIRE(received == (std::vector<uint32_t>{1, 2, 45, 47, 63}));
 }
@@ -0,0 +1,251 @@
+#include <catch2/catch.hpp>
+#include <simdee/math.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+#include <simdee/simdee.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const double pi = 3.14159265358979323846;
+
+    // distance of value from the exact result gt, in units in the last place of gt
+    double ulp_error(float value, double gt) {
+        if (std::isnan(value) || std::isnan(gt)) return (std::isnan(value) && std::isnan(gt)) ? 0 : inf;
+        if (double(value) == gt) return 0;
+        if (std::isinf(value)) return (std::abs(gt) > double(std::numeric_limits<float>::max())) ? 0 : inf;
+        int exp;
+        std::frexp(gt, &exp);
+        return std::abs(double(value) - gt) / std::ldexp(1.0, std::max(exp, -125) - 24);
+    }
+
+    // uniformly distributed floats in [lo, hi], plus the boundaries
+    std::vector<float> sample(float lo, float hi, std::size_t count = 20000) {
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<float> dist(lo, hi);
+        std::vector<float> res = {lo, hi};
+        while (res.size() < count) res.push_back(dist(gen));
+        return res;
+    }
+
+    // floats with uniformly distributed bit patterns in [lo, hi], lo and hi positive
+    std::vector<float> sample_bits(float lo, float hi, std::size_t count = 20000) {
+        std::mt19937 gen(1234);
+        std::uniform_int_distribution<uint32_t> dist(sd::dirty::as_u(lo), sd::dirty::as_u(hi));
+        std::vector<float> res = {lo, hi};
+        while (res.size() < count) res.push_back(sd::dirty::as_f(dist(gen)));
+        return res;
+    }
+
+    template <typename F, typename Fn, typename Ref>
+    double max_ulp(const std::vector<float>& in, Fn fn, Ref ref) {
+        double worst = 0;
+        typename F::storage_t xs;
+        for (std::size_t i = 0; i + F::width <= in.size(); i += F::width) {
+            for (std::size_t j = 0; j < F::width; ++j) xs[j] = in[i + j];
+            typename F::storage_t ys(fn(F(xs)));
+            for (std::size_t j = 0; j < F::width; ++j) {
+                worst = std::max(worst, ulp_error(ys[j], ref(double(xs[j]))));
+            }
+        }
+        return worst;
+    }
+
+    template <typename F, typename Fn, typename Ref>
+    double max_ulp2(const std::vector<float>& in1, const std::vector<float>& in2, Fn fn, Ref ref) {
+        double worst = 0;
+        typename F::storage_t xs, ys;
+        for (std::size_t i = 0; i + F::width <= std::min(in1.size(), in2.size()); i += F::width) {
+            for (std::size_t j = 0; j < F::width; ++j) {
+                xs[j] = in1[i + j];
+                ys[j] = in2[i + j];
+            }
+            typename F::storage_t rs(fn(F(xs), F(ys)));
+            for (std::size_t j = 0; j < F::width; ++j) {
+                worst = std::max(worst, ulp_error(rs[j], ref(double(xs[j]), double(ys[j]))));
+            }
+        }
+        return worst;
+    }
+
+    // evaluate a unary function on a single broadcast value
+    template <typename F, typename Fn>
+    float eval(Fn fn, float x) {
+        return first_scalar(fn(F(x)));
+    }
+
+    // evaluate a binary function on a single broadcast pair of values
+    template <typename F, typename Fn>
+    float eval(Fn fn, float x, float y) {
+        return first_scalar(fn(F(x), F(y)));
+    }
+
+    bool same(float a, float b) {
+        return sd::dirty::as_u(a) == sd::dirty::as_u(b) || (std::isnan(a) && std::isnan(b));
+    }
+
+    struct exp_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::exp(x); }
+    };
+    struct log_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::log(x); }
+    };
+    struct sin_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::sin(x); }
+    };
+    struct cos_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::cos(x); }
+    };
+    struct tan_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::tan(x); }
+    };
+    struct atan_fn {
+        template <typename F>
+        F operator()(const F& x) const { return sd::atan(x); }
+    };
+    struct atan2_fn {
+        template <typename F>
+        F operator()(const F& y, const F& x) const { return sd::atan2(y, x); }
+    };
+    struct pow_fn {
+        template <typename F>
+        F operator()(const F& x, const F& y) const { return sd::pow(x, y); }
+    };
+
+    template <typename F>
+    void test_exp() {
+        auto ref = [](double x) { return std::exp(x); };
+        REQUIRE(max_ulp<F>(sample(-87.f, 88.f), exp_fn(), ref) <= 1);
+        REQUIRE(max_ulp<F>(sample(-104.f, -87.f), exp_fn(), ref) <= 1);
+        REQUIRE(max_ulp<F>(sample_bits(1e-20f, 1e-2f), exp_fn(), ref) <= 1);
+        REQUIRE(same(eval<F>(exp_fn(), 0.f), 1.f));
+        REQUIRE(same(eval<F>(exp_fn(), 100.f), inf));
+        REQUIRE(same(eval<F>(exp_fn(), inf), inf));
+        REQUIRE(same(eval<F>(exp_fn(), -200.f), 0.f));
+        REQUIRE(same(eval<F>(exp_fn(), -inf), 0.f));
+        REQUIRE(same(eval<F>(exp_fn(), nan), nan));
+    }
+
+    template <typename F>
+    void test_log() {
+        auto ref = [](double x) { return std::log(x); };
+        REQUIRE(max_ulp<F>(sample(0.5f, 2.f), log_fn(), ref) <= 1);
+        REQUIRE(max_ulp<F>(sample_bits(1e-45f, 3e38f), log_fn(), ref) <= 1);
+        REQUIRE(same(eval<F>(log_fn(), 1.f), 0.f));
+        REQUIRE(same(eval<F>(log_fn(), 0.f), -inf));
+        REQUIRE(same(eval<F>(log_fn(), -0.f), -inf));
+        REQUIRE(same(eval<F>(log_fn(), inf), inf));
+        REQUIRE(same(eval<F>(log_fn(), -1.f), nan));
+        REQUIRE(same(eval<F>(log_fn(), -inf), nan));
+        REQUIRE(same(eval<F>(log_fn(), nan), nan));
+    }
+
+    template <typename F>
+    void test_trig() {
+        auto sin_ref = [](double x) { return std::sin(x); };
+        auto cos_ref = [](double x) { return std::cos(x); };
+        auto tan_ref = [](double x) { return std::tan(x); };
+        REQUIRE(max_ulp<F>(sample(-10.f, 10.f), sin_fn(), sin_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(-10.f, 10.f), cos_fn(), cos_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(-10.f, 10.f), tan_fn(), tan_ref) <= 4.2);
+        REQUIRE(max_ulp<F>(sample(-8192.f, 8192.f), sin_fn(), sin_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(-8192.f, 8192.f), cos_fn(), cos_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(-8192.f, 8192.f), tan_fn(), tan_ref) <= 4.2);
+        REQUIRE(max_ulp<F>(sample_bits(1e-30f, 1e-2f), sin_fn(), sin_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample_bits(1e-30f, 1e-2f), tan_fn(), tan_ref) <= 4.2);
+
+        // large arguments are handed over to the standard library
+        REQUIRE(max_ulp<F>(sample(1e4f, 1e30f), sin_fn(), sin_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(1e4f, 1e30f), cos_fn(), cos_ref) <= 2.5);
+        REQUIRE(max_ulp<F>(sample(1e4f, 1e30f), tan_fn(), tan_ref) <= 4.2);
+
+        REQUIRE(same(eval<F>(sin_fn(), 0.f), 0.f));
+        REQUIRE(same(eval<F>(sin_fn(), -0.f), -0.f));
+        REQUIRE(same(eval<F>(cos_fn(), 0.f), 1.f));
+        REQUIRE(same(eval<F>(tan_fn(), -0.f), -0.f));
+        REQUIRE(same(eval<F>(sin_fn(), inf), nan));
+        REQUIRE(same(eval<F>(cos_fn(), -inf), nan));
+        REQUIRE(same(eval<F>(tan_fn(), inf), nan));
+        REQUIRE(same(eval<F>(sin_fn(), nan), nan));
+        REQUIRE(same(eval<F>(cos_fn(), nan), nan));
+    }
+
+    template <typename F>
+    void test_atan() {
+        auto ref = [](double x) { return std::atan(x); };
+        auto ref2 = [](double y, double x) { return std::atan2(y, x); };
+        REQUIRE(max_ulp<F>(sample(-10.f, 10.f), atan_fn(), ref) <= 2.9);
+        REQUIRE(max_ulp<F>(sample_bits(1e-30f, 1e30f), atan_fn(), ref) <= 2.9);
+        REQUIRE(max_ulp2<F>(sample(-10.f, 10.f), sample(-10.f, 10.f, 20001), atan2_fn(), ref2) <=
+                3.3);
+        REQUIRE(same(eval<F>(atan_fn(), -0.f), -0.f));
+        REQUIRE(same(eval<F>(atan_fn(), inf), float(pi / 2)));
+        REQUIRE(same(eval<F>(atan_fn(), -inf), float(-pi / 2)));
+        REQUIRE(same(eval<F>(atan_fn(), nan), nan));
+
+        REQUIRE(same(eval<F>(atan2_fn(), 0.f, 0.f), 0.f));
+        REQUIRE(same(eval<F>(atan2_fn(), -0.f, 0.f), -0.f));
+        REQUIRE(same(eval<F>(atan2_fn(), 0.f, -0.f), float(pi)));
+        REQUIRE(same(eval<F>(atan2_fn(), -0.f, -0.f), float(-pi)));
+        REQUIRE(same(eval<F>(atan2_fn(), 1.f, 0.f), float(pi / 2)));
+        REQUIRE(same(eval<F>(atan2_fn(), -1.f, 0.f), float(-pi / 2)));
+        REQUIRE(same(eval<F>(atan2_fn(), 1.f, -inf), float(pi)));
+        REQUIRE(same(eval<F>(atan2_fn(), inf, inf), float(pi / 4)));
+        REQUIRE(same(eval<F>(atan2_fn(), -inf, -inf), float(-3 * pi / 4)));
+        REQUIRE(same(eval<F>(atan2_fn(), nan, 1.f), nan));
+        REQUIRE(same(eval<F>(atan2_fn(), 1.f, nan), nan));
+    }
+
+    template <typename F>
+    void test_pow() {
+        auto ref = [](double x, double y) { return std::pow(x, y); };
+        REQUIRE(max_ulp2<F>(sample(0.f, 10.f), sample(-30.f, 30.f, 20001), pow_fn(), ref) <= 2.9);
+        REQUIRE(max_ulp2<F>(sample_bits(1e-30f, 1e30f), sample(-1.f, 1.f, 20001), pow_fn(), ref) <=
+                2.9);
+        REQUIRE(same(eval<F>(pow_fn(), 2.f, 10.f), 1024.f));
+        REQUIRE(same(eval<F>(pow_fn(), -2.f, 3.f), -8.f));
+        REQUIRE(same(eval<F>(pow_fn(), -2.f, -2.f), 0.25f));
+        REQUIRE(same(eval<F>(pow_fn(), -2.f, 0.5f), nan));
+        REQUIRE(same(eval<F>(pow_fn(), nan, 0.f), 1.f));
+        REQUIRE(same(eval<F>(pow_fn(), 1.f, nan), 1.f));
+        REQUIRE(same(eval<F>(pow_fn(), -1.f, inf), 1.f));
+        REQUIRE(same(eval<F>(pow_fn(), 2.f, nan), nan));
+        REQUIRE(same(eval<F>(pow_fn(), 0.f, -1.f), inf));
+        REQUIRE(same(eval<F>(pow_fn(), -0.f, -1.f), -inf));
+        REQUIRE(same(eval<F>(pow_fn(), -0.f, 3.f), -0.f));
+        REQUIRE(same(eval<F>(pow_fn(), 0.f, 2.f), 0.f));
+        REQUIRE(same(eval<F>(pow_fn(), -inf, 3.f), -inf));
+        REQUIRE(same(eval<F>(pow_fn(), -inf, 0.5f), inf));
+        REQUIRE(same(eval<F>(pow_fn(), -inf, -3.f), -0.f));
+        REQUIRE(same(eval<F>(pow_fn(), 0.5f, inf), 0.f));
+        REQUIRE(same(eval<F>(pow_fn(), 2.f, inf), inf));
+        REQUIRE(same(eval<F>(pow_fn(), 0.5f, -inf), inf));
+        REQUIRE(same(eval<F>(pow_fn(), 10.f, 50.f), inf));
+        REQUIRE(same(eval<F>(pow_fn(), 10.f, -50.f), 0.f));
+    }
+}
+
+#define MATH_TEST_CASE(NAME, FN)                                                                  \
+    TEST_CASE("math " NAME, "[math]") {                                                           \
+        SECTION("vec4f") { FN<sd::vec4f>(); }                                                     \
+        SECTION("vec8f") { FN<sd::vec8f>(); }                                                     \
+        SECTION("dual<vec4f>") { FN<sd::dual<sd::vec4f>>(); }                                     \
+        SECTION("dumf") { FN<sd::dumf>(); }                                                       \
+        SECTION("dual<dual<dumf>>") { FN<sd::dual<sd::dual<sd::dumf>>>(); }                       \
+    }
+
+MATH_TEST_CASE("exp", test_exp)
+MATH_TEST_CASE("log", test_log)
+MATH_TEST_CASE("sin, cos, tan", test_trig)
+MATH_TEST_CASE("atan, atan2", test_atan)
+MATH_TEST_CASE("pow", test_pow)
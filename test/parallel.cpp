@@ -0,0 +1,130 @@
+#include <catch2/catch.hpp>
+#include <simdee/algorithm.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+#include <simdee/simdee.hpp>
+#include <simdee/util/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    // sizes around the multiples of the vector width and of the chunk, which is 4096 floats
+    std::vector<std::size_t> sizes() { return {0, 1, 7, 8, 9, 4096, 4097, 12345, 100000}; }
+
+    template <typename F>
+    void test_par(sd::thread_pool& pool) {
+        for (std::size_t n : sizes()) {
+            std::vector<float> a(n), b(n), out(n), gt(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = float(i % 17) - 8.f;
+                b[i] = float(i % 5);
+            }
+
+            sd::par::transform<F>(a.data(), n, out.data(), [](const F& x) { return x * x; }, pool);
+            for (std::size_t i = 0; i < n; ++i) gt[i] = a[i] * a[i];
+            REQUIRE(out == gt);
+
+            sd::par::transform<F>(a.data(), b.data(), n, out.data(),
+                                  [](const F& x, const F& y) { return x + y; }, pool);
+            for (std::size_t i = 0; i < n; ++i) gt[i] = a[i] + b[i];
+            REQUIRE(out == gt);
+
+            std::vector<int32_t> first(n, -1);
+            sd::par::for_each_block<F>(out.data(), n, [&](F& v, std::size_t i) {
+                first[i] = int32_t(i);
+                v = v * 2.f;
+            }, pool);
+            for (std::size_t i = 0; i < n; ++i) gt[i] *= 2.f;
+            REQUIRE(out == gt);
+            std::vector<int32_t> gt_first(n, -1);
+            for (std::size_t i = 0; i < n; i += F::width) gt_first[i] = int32_t(i);
+            REQUIRE(first == gt_first);
+
+            std::atomic<int> blocks{0};
+            const float* ca = a.data();
+            sd::par::for_each_block<F>(ca, n, [&](F&, std::size_t) { ++blocks; }, pool);
+            REQUIRE(std::size_t(blocks) == (n + F::width - 1) / F::width);
+
+            // small integers keep the float sums exact
+            const float sum = std::accumulate(a.begin(), a.end(), 0.f);
+            const float sum_sq = std::inner_product(a.begin(), a.end(), a.begin(), 0.f);
+            const float lo = n == 0 ? std::numeric_limits<float>::infinity()
+                                    : *std::min_element(a.begin(), a.end());
+            REQUIRE(sd::par::reduce<F>(a.data(), n, sd::op_add{}, pool) == sum);
+            REQUIRE(sd::par::reduce<F>(a.data(), n, sd::op_min{}, pool) == lo);
+            REQUIRE(sd::par::transform_reduce<F>(a.data(), n, [](const F& x) { return x * x; },
+                                                 sd::op_add{}, pool) == sum_sq);
+        }
+    }
+}
+
+TEST_CASE("thread_pool", "[parallel]") {
+    SECTION("each index once, with uneven work") {
+        for (std::size_t threads : {1U, 2U, 3U, 8U}) {
+            sd::thread_pool pool(threads);
+            REQUIRE(pool.size() == threads);
+            for (std::size_t count : {0U, 1U, 2U, 5U, 1000U}) {
+                std::vector<std::atomic<int>> hits(count);
+                for (auto& h : hits) h = 0;
+                pool.parallel_for(count, [&](std::size_t i) {
+                    volatile std::size_t spin = 0;
+                    for (std::size_t k = 0; k < (i % 10 == 0 ? 10000 : 10); ++k) spin = spin + k;
+                    ++hits[i];
+                });
+                REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& h) {
+                    return h == 1;
+                }));
+            }
+        }
+    }
+
+    SECTION("nested loops run serially") {
+        sd::thread_pool pool(4);
+        std::atomic<int> total{0};
+        pool.parallel_for(10, [&](std::size_t) {
+            pool.parallel_for(10, [&](std::size_t) { ++total; });
+        });
+        REQUIRE(total == 100);
+    }
+
+    SECTION("exceptions are rethrown") {
+        sd::thread_pool pool(4);
+        REQUIRE_THROWS_AS(pool.parallel_for(100, [](std::size_t i) {
+            if (i == 42) throw std::runtime_error("42");
+        }), std::runtime_error);
+        std::atomic<int> total{0};
+        pool.parallel_for(100, [&](std::size_t) { ++total; });
+        REQUIRE(total == 100);
+    }
+}
+
+TEST_CASE("par algorithms", "[parallel]") {
+    sd::thread_pool one(1), four(4);
+    SECTION("vec8f, 1 thread") { test_par<sd::vec8f>(one); }
+    SECTION("vec8f, 4 threads") { test_par<sd::vec8f>(four); }
+    SECTION("vec4f, 4 threads") { test_par<sd::vec4f>(four); }
+    SECTION("dual<vec8f>, 4 threads") { test_par<sd::dual<sd::vec8f>>(four); }
+    SECTION("dumf, 4 threads") { test_par<sd::dumf>(four); }
+
+    SECTION("the result doesn't depend on the number of threads") {
+        std::vector<float> a(100000);
+        for (std::size_t i = 0; i < a.size(); ++i) a[i] = 1.f / float(i + 1);
+        const float gt = sd::par::reduce(a.data(), a.size(), sd::op_add{}, one);
+        REQUIRE(sd::par::reduce(a.data(), a.size(), sd::op_add{}, four) == gt);
+        REQUIRE(sd::par::reduce(a.data(), a.size(), sd::op_add{}) == gt);
+    }
+
+    SECTION("native_vec, uint32_t") {
+        std::vector<uint32_t> a(5000);
+        std::iota(a.begin(), a.end(), 1U);
+        sd::par::transform(a.data(), a.size(), a.data(),
+                           [](const sd::native_vec<uint32_t>& x) { return x * 3U; }, four);
+        REQUIRE(sd::par::reduce(a.data(), a.size(), sd::op_add{}, four) == 3U * 5000U * 5001U / 2U);
+        REQUIRE(sd::par::reduce(a.data(), a.size(), sd::op_max{}, four) == 15000U);
+    }
+}
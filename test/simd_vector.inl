@@ -6,8 +6,19 @@
 // SIMD_TEST_TAG -- catch tests tag(s) as a string
 // SIMD_WIDTH -- expected SIMD width
 //
+// following macros may be defined
+// SIMD_SCALAR_SIZE -- expected size of the scalar types in bytes, 4 if not defined
+//
+
+#ifndef SIMD_SCALAR_SIZE
+#define SIMD_SCALAR_SIZE 4
+#endif
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <vector>
 
 #define VAL(TYPE) std::declval<TYPE>()
 
@@ -28,10 +39,10 @@ ASSERT(B::width == SIMD_WIDTH);
 ASSERT(F::width == SIMD_WIDTH);
 ASSERT(U::width == SIMD_WIDTH);
 ASSERT(S::width == SIMD_WIDTH);
-ASSERT((std::is_same<B::scalar_t, sd::bool32_t>::value));
-ASSERT((std::is_same<F::scalar_t, float>::value));
-ASSERT((std::is_same<U::scalar_t, uint32_t>::value));
-ASSERT((std::is_same<S::scalar_t, int32_t>::value));
+ASSERT((std::is_same<B::scalar_t, sd::select_bool_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<F::scalar_t, sd::select_float_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<U::scalar_t, sd::select_uint_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<S::scalar_t, sd::select_sint_t<SIMD_SCALAR_SIZE>>::value));
 ASSERT((std::is_same<B::mask_t, sd::impl::mask<((1 << SIMD_WIDTH) - 1)>>::value));
 ASSERT((std::is_same<B::storage_t, sd::storage<B>>::value));
 ASSERT((std::is_same<F::storage_t, sd::storage<F>>::value));
@@ -81,6 +92,10 @@ ASSERT(HAS_METHOD(const B, unaligned_store(VAL(B::scalar_t*)), void));
 ASSERT(HAS_METHOD(const F, unaligned_store(VAL(F::scalar_t*)), void));
 ASSERT(HAS_METHOD(const U, unaligned_store(VAL(U::scalar_t*)), void));
 ASSERT(HAS_METHOD(const S, unaligned_store(VAL(S::scalar_t*)), void));
+ASSERT(HAS_METHOD(const B, streaming_store(VAL(B::scalar_t*)), void));
+ASSERT(HAS_METHOD(const F, streaming_store(VAL(F::scalar_t*)), void));
+ASSERT(HAS_METHOD(const U, streaming_store(VAL(U::scalar_t*)), void));
+ASSERT(HAS_METHOD(const S, streaming_store(VAL(S::scalar_t*)), void));
 ASSERT(HAS_METHOD(B, interleaved_load(VAL(B::scalar_t*), VAL(int)), void));
 ASSERT(HAS_METHOD(F, interleaved_load(VAL(F::scalar_t*), VAL(int)), void));
 ASSERT(HAS_METHOD(U, interleaved_load(VAL(U::scalar_t*), VAL(int)), void));
@@ -89,6 +104,14 @@ ASSERT(HAS_METHOD(const B, interleaved_store(VAL(B::scalar_t*), VAL(int)), void)
 ASSERT(HAS_METHOD(const F, interleaved_store(VAL(F::scalar_t*), VAL(int)), void));
 ASSERT(HAS_METHOD(const U, interleaved_store(VAL(U::scalar_t*), VAL(int)), void));
 ASSERT(HAS_METHOD(const S, interleaved_store(VAL(S::scalar_t*), VAL(int)), void));
+ASSERT(HAS_METHOD(B, gather_load(VAL(B::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(F, gather_load(VAL(F::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(U, gather_load(VAL(U::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(S, gather_load(VAL(S::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(const B, scatter_store(VAL(B::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(const F, scatter_store(VAL(F::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(const U, scatter_store(VAL(U::scalar_t*), VAL(S)), void));
+ASSERT(HAS_METHOD(const S, scatter_store(VAL(S::scalar_t*), VAL(S)), void));
 
 #if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 6
 #pragma GCC diagnostic pop
@@ -107,6 +130,11 @@ const S::storage_t bufAS{SIMDEE_DATA_BUFAS};
 const S::storage_t bufBS{SIMDEE_DATA_BUFBS};
 const S::storage_t bufZS{SIMDEE_DATA_BUFZS};
 
+const F::scalar_t someF = 1.2345678f;
+const U::scalar_t allBitsU = ~U::scalar_t(0);
+const U::scalar_t signBitU = U::scalar_t(1) << (8 * sizeof(U::scalar_t) - 1);
+const U::scalar_t absMaskU = ~signBitU;
+
 TEST_CASE(SIMD_TYPE " explicit construction", SIMD_TEST_TAG) {
     B::storage_t rb = bufZB;
     F::storage_t rf = bufZF;
@@ -127,7 +155,7 @@ TEST_CASE(SIMD_TYPE " explicit construction", SIMD_TEST_TAG) {
         S ts(-123456789);
         tor(tb, tf, tu, ts);
         for (auto val : rb) REQUIRE(val == true);
-        for (auto val : rf) REQUIRE(val == 1.2345678f);
+        for (auto val : rf) REQUIRE(val == someF);
         for (auto val : ru) REQUIRE(val == 123456789U);
         for (auto val : rs) REQUIRE(val == -123456789);
     }
@@ -225,10 +253,10 @@ TEST_CASE(SIMD_TYPE " explicit construction", SIMD_TEST_TAG) {
             U tu(sd::all_bits());
             S ts(sd::all_bits());
             tor(tb, tf, tu, ts);
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == allBitsU);
         }
         {
             B tb(sd::sign_bit());
@@ -236,10 +264,10 @@ TEST_CASE(SIMD_TYPE " explicit construction", SIMD_TEST_TAG) {
             U tu(sd::sign_bit());
             S ts(sd::sign_bit());
             tor(tb, tf, tu, ts);
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == signBitU);
         }
         {
             B tb(sd::abs_mask());
@@ -247,10 +275,10 @@ TEST_CASE(SIMD_TYPE " explicit construction", SIMD_TEST_TAG) {
             U tu(sd::abs_mask());
             S ts(sd::abs_mask());
             tor(tb, tf, tu, ts);
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == absMaskU);
         }
     }
 }
@@ -271,7 +299,7 @@ TEST_CASE(SIMD_TYPE " implicit construction", SIMD_TEST_TAG) {
     SECTION("from scalar_t") {
         implicit_test(B::scalar_t(true), 1.2345678f, 123456789U, -123456789);
         for (auto val : rb) REQUIRE(val == true);
-        for (auto val : rf) REQUIRE(val == 1.2345678f);
+        for (auto val : rf) REQUIRE(val == someF);
         for (auto val : ru) REQUIRE(val == 123456789U);
         for (auto val : rs) REQUIRE(val == -123456789);
     }
@@ -319,20 +347,20 @@ TEST_CASE(SIMD_TYPE " implicit construction", SIMD_TEST_TAG) {
         for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x00000000);
         for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x00000000);
         implicit_test(sd::all_bits(), sd::all_bits(), sd::all_bits(), sd::all_bits());
-        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
+        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == allBitsU);
         implicit_test(sd::sign_bit(), sd::sign_bit(), sd::sign_bit(), sd::sign_bit());
-        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
+        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == signBitU);
+        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == signBitU);
+        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == signBitU);
+        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == signBitU);
         implicit_test(sd::abs_mask(), sd::abs_mask(), sd::abs_mask(), sd::abs_mask());
-        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
+        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+        for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+        for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+        for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == absMaskU);
     }
 }
 
@@ -361,7 +389,7 @@ TEST_CASE(SIMD_TYPE " assignment", SIMD_TEST_TAG) {
             ts = -123456789;
             tor();
             for (auto val : rb) REQUIRE(val == true);
-            for (auto val : rf) REQUIRE(val == 1.2345678f);
+            for (auto val : rf) REQUIRE(val == someF);
             for (auto val : ru) REQUIRE(val == 123456789U);
             for (auto val : rs) REQUIRE(val == -123456789);
         }
@@ -434,28 +462,28 @@ TEST_CASE(SIMD_TYPE " assignment", SIMD_TEST_TAG) {
             tu = sd::all_bits();
             ts = sd::all_bits();
             tor();
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0xffffffff);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == allBitsU);
             tb = sd::sign_bit();
             tf = sd::sign_bit();
             tu = sd::sign_bit();
             ts = sd::sign_bit();
             tor();
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x80000000);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == signBitU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == signBitU);
             tb = sd::abs_mask();
             tf = sd::abs_mask();
             tu = sd::abs_mask();
             ts = sd::abs_mask();
             tor();
-            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
-            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == 0x7fffffff);
+            for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : rf) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : ru) REQUIRE(sd::dirty::as_u(val) == absMaskU);
+            for (auto val : rs) REQUIRE(sd::dirty::as_u(val) == absMaskU);
         }
     }
     SECTION("to...") {
@@ -484,6 +512,17 @@ TEST_CASE(SIMD_TYPE " assignment", SIMD_TEST_TAG) {
             REQUIRE(ru == bufAU);
             REQUIRE(rs == bufAS);
         }
+        SECTION("to streaming pointer") {
+            sd::streaming(rb.data()) = tb;
+            sd::streaming(rf.data()) = tf;
+            sd::streaming(ru.data()) = tu;
+            sd::streaming(rs.data()) = ts;
+            sd::stream_fence();
+            REQUIRE(rb == bufAB);
+            REQUIRE(rf == bufAF);
+            REQUIRE(ru == bufAU);
+            REQUIRE(rs == bufAS);
+        }
         SECTION("to interleaved pointer") {
             sd::interleaved(rb.data(), 1) = tb;
             sd::interleaved(rf.data(), 1) = tf;
@@ -507,6 +546,122 @@ TEST_CASE(SIMD_TYPE " assignment", SIMD_TEST_TAG) {
     }
 }
 
+TEST_CASE(SIMD_TYPE " gather and scatter", SIMD_TEST_TAG) {
+    const int step = 3;
+    const std::size_t size = step * SIMD_WIDTH;
+    S::storage_t idx;
+    S::storage_t rev;
+    for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+        idx[i] = S::scalar_t(step * (SIMD_WIDTH - 1 - i) + i % step);
+        rev[i] = S::scalar_t(SIMD_WIDTH - 1 - i);
+    }
+    std::vector<F::scalar_t> srcF(size);
+    std::vector<U::scalar_t> srcU(size);
+    F::scalar_t valF = F::scalar_t(1) / F::scalar_t(2);
+    U::scalar_t valU = 1;
+    for (std::size_t i = 0; i < size; ++i, valF += 1, valU += 7) {
+        srcF[i] = valF;
+        srcU[i] = valU;
+    }
+
+    SECTION("interleaved load with step > 1") {
+        F tf(sd::interleaved(srcF.data(), step));
+        U tu = sd::interleaved(srcU.data(), step);
+        F::storage_t rf(tf);
+        U::storage_t ru(tu);
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            REQUIRE(rf[i] == srcF[step * i]);
+            REQUIRE(ru[i] == srcU[step * i]);
+        }
+    }
+    SECTION("interleaved store with step > 1") {
+        std::vector<F::scalar_t> dstF(size, F::scalar_t(0));
+        sd::interleaved(dstF.data(), step) = F(bufAF);
+        for (std::size_t i = 0; i < size; ++i) {
+            REQUIRE(dstF[i] == ((i % step == 0) ? bufAF[i / step] : F::scalar_t(0)));
+        }
+    }
+    SECTION("gather") {
+        F tf(sd::gather(srcF.data(), S(idx)));
+        U tu = sd::gather(srcU.data(), S(idx));
+        S ts;
+        ts = sd::gather(bufAS.data(), S(rev));
+        F::storage_t rf(tf);
+        U::storage_t ru(tu);
+        S::storage_t rs(ts);
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            const std::size_t j = std::size_t(idx[i]);
+            REQUIRE(rf[i] == srcF[j]);
+            REQUIRE(ru[i] == srcU[j]);
+            REQUIRE(rs[i] == bufAS[SIMD_WIDTH - 1 - i]);
+        }
+    }
+    SECTION("scatter") {
+        std::vector<F::scalar_t> dstF(size, F::scalar_t(0));
+        std::vector<B::scalar_t> dstB(size, B::scalar_t(false));
+        sd::scatter(dstF.data(), S(idx), F(bufAF));
+        sd::gather(dstB.data(), S(idx)) = B(bufAB);
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            const std::size_t j = std::size_t(idx[i]);
+            REQUIRE(dstF[j] == bufAF[i]);
+            REQUIRE(bool(dstB[j]) == bool(bufAB[i]));
+            dstF[j] = F::scalar_t(0);
+        }
+        for (std::size_t i = 0; i < size; ++i) { REQUIRE(dstF[i] == F::scalar_t(0)); }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " partial load and store", SIMD_TEST_TAG) {
+    const S::scalar_t fillS = -7;
+
+    for (std::size_t count = 0; count <= SIMD_WIDTH + 1; ++count) {
+        B::storage_t eb = bufZB;
+        F::storage_t ef = bufZF;
+        F::storage_t efi;
+        U::storage_t eu;
+        S::storage_t es;
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            if (i < count) {
+                eb[i] = bufAB[i];
+                ef[i] = efi[i] = bufAF[i];
+                eu[i] = bufAU[i];
+                es[i] = bufAS[i];
+            } else {
+                efi[i] = std::numeric_limits<F::scalar_t>::infinity();
+                eu[i] = allBitsU;
+                es[i] = fillS;
+            }
+        }
+
+        SECTION("load") {
+            B tb = sd::partial(bufAB.data(), count);
+            F tf = sd::partial(bufAF.data(), count);
+            F tfi(sd::partial(bufAF.data(), count, sd::inf()));
+            U tu(sd::partial(bufAU.data(), count, sd::all_bits()));
+            S ts;
+            ts = sd::partial(bufAS.data(), count, fillS);
+            REQUIRE(B::storage_t(tb) == eb);
+            REQUIRE(F::storage_t(tf) == ef);
+            REQUIRE(F::storage_t(tfi) == efi);
+            REQUIRE(U::storage_t(tu) == eu);
+            REQUIRE(S::storage_t(ts) == es);
+        }
+        SECTION("store") {
+            F::storage_t rf = bufZF;
+            U::storage_t ru;
+            S::storage_t rs;
+            std::fill(ru.data(), ru.data() + SIMD_WIDTH, allBitsU);
+            std::fill(rs.data(), rs.data() + SIMD_WIDTH, fillS);
+            sd::partial(rf.data(), count) = F(bufAF);
+            sd::partial(ru.data(), count) = U(bufAU);
+            S(bufAS).partial_store(rs.data(), count);
+            REQUIRE(rf == ef);
+            REQUIRE(ru == eu);
+            REQUIRE(rs == es);
+        }
+    }
+}
+
 TEST_CASE(SIMD_TYPE " type conversion", SIMD_TEST_TAG) {
     SECTION("int to float") {
         F::storage_t expected, result;
@@ -540,6 +695,46 @@ TEST_CASE(SIMD_TYPE " type conversion", SIMD_TEST_TAG) {
         result = S(in);
         REQUIRE(result == expected);
     }
+#if SIMD_SCALAR_SIZE == 4
+    SECTION("uint to float") {
+        F::storage_t expected, result;
+        std::transform(begin(bufAU), end(bufAU), begin(expected),
+                       [](U::scalar_t a) { return static_cast<F::scalar_t>(a); });
+        U in = bufAU;
+        result = F(in);
+        REQUIRE(result == expected);
+    }
+    SECTION("float to uint") {
+        F::storage_t in;
+        U::storage_t expected, result;
+        std::transform(begin(bufAU), end(bufAU), begin(bufAF), begin(in),
+                       [](U::scalar_t a, F::scalar_t b) { return F::scalar_t(a) - std::abs(b); });
+        std::transform(begin(in), end(in), begin(expected),
+                       [](F::scalar_t a) { return static_cast<U::scalar_t>(a); });
+        result = U(F(in));
+        REQUIRE(result == expected);
+        std::transform(begin(bufAF), end(bufAF), begin(in),
+                       [](F::scalar_t a) { return std::abs(a) * 100.f; });
+        std::transform(begin(in), end(in), begin(expected),
+                       [](F::scalar_t a) { return static_cast<U::scalar_t>(a); });
+        result = U(F(in));
+        REQUIRE(result == expected);
+    }
+    SECTION("float to int, rounded") {
+        const F::scalar_t in[] = {-2.5f, -1.5f, -0.5f, 0.5f,        1.5f,  2.5f,      3.5f,  -0.f,
+                                  -0.7f, 0.7f,  3.25f, 0.49999997f, -1e9f, 123456.5f, -3.5f, 4.5f};
+        for (std::size_t i = 0; i < 16; i += F::width) {
+            F::storage_t x;
+            S::storage_t expected, result;
+            std::copy(in + i, in + i + F::width, begin(x));
+            std::transform(begin(x), end(x), begin(expected), [](F::scalar_t a) {
+                return static_cast<S::scalar_t>(std::nearbyint(a));
+            });
+            result = to_int_round(F(x));
+            REQUIRE(result == expected);
+        }
+    }
+#endif
     SECTION("bool to uint") {
         U::storage_t expected, result;
         std::transform(begin(bufAB), end(bufAB), begin(expected),
@@ -655,6 +850,50 @@ TEST_CASE(SIMD_TYPE " float arithmetic", SIMD_TEST_TAG) {
         r = abs(va);
         REQUIRE(r == e);
     }
+    SECTION("rounding to integral values") {
+        const scalar_t in[] = {-2.5f,  -1.5f,  -0.5f, -0.f,        0.5f,   1.5f,   2.5f,   3.25f,
+                               -0.7f,  0.7f,   -3.25f, 0.49999997f, 8388607.5f, -8388609.f, 1e30f,
+                               -std::numeric_limits<scalar_t>::infinity()};
+        for (std::size_t i = 0; i < 16; i += F::width) {
+            F::storage_t x;
+            std::copy(in + i, in + i + F::width, begin(x));
+            const F v = x;
+            std::transform(begin(x), end(x), begin(e), [](scalar_t a) { return std::floor(a); });
+            r = floor(v);
+            REQUIRE(r == e);
+            std::transform(begin(x), end(x), begin(e), [](scalar_t a) { return std::ceil(a); });
+            r = ceil(v);
+            REQUIRE(r == e);
+            std::transform(begin(x), end(x), begin(e), [](scalar_t a) { return std::trunc(a); });
+            r = trunc(v);
+            REQUIRE(r == e);
+            std::transform(begin(x), end(x), begin(e), [](scalar_t a) { return std::round(a); });
+            r = round(v);
+            REQUIRE(r == e);
+            for (auto j = 0U; j < F::width; ++j) REQUIRE(std::signbit(r[j]) == std::signbit(e[j]));
+        }
+    }
+    SECTION("fused multiply-add") {
+        expect([](scalar_t a, scalar_t b) { return a * b + a; });
+        r = fma(va, vb, va);
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]));
+        expect([](scalar_t a, scalar_t b) { return a * b - a; });
+        r = fms(va, vb, va);
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]));
+        expect([](scalar_t a, scalar_t b) { return a - a * b; });
+        r = fnma(va, vb, va);
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]));
+    }
+    SECTION("fused multiply-add rounds once") {
+        // x * x = 1 + 2^-(k-1) + 2^-2k, where the last term is lost when rounding the product
+        const int k = (std::numeric_limits<scalar_t>::digits + 1) / 2;
+        const F x(1 + std::ldexp(scalar_t(1), -k));
+        const F p = x * x;
+        const scalar_t lost = SIMDEE_FMA ? std::ldexp(scalar_t(1), -2 * k) : 0;
+        REQUIRE(all(fma(x, x, -p) == F(lost)));
+        REQUIRE(all(fms(x, x, p) == F(lost)));
+        REQUIRE(all(fnma(x, x, p) == F(-lost)));
+    }
     SECTION("square root") {
         expect1([](scalar_t a) { return std::sqrt(std::abs(a)); });
         r = sqrt(abs(va));
@@ -670,6 +909,40 @@ TEST_CASE(SIMD_TYPE " float arithmetic", SIMD_TEST_TAG) {
         r = rsqrt(abs(va));
         for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(0.005));
     }
+    SECTION("reciprocal with selectable precision") {
+        expect1([](scalar_t a) { return 1 / a; });
+        r = sd::rcp<sd::precision::fast>(va);
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(0.005));
+        r = sd::rcp<sd::precision::refined>(va);
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(1e-6));
+        r = sd::rcp<sd::precision::exact>(va);
+        REQUIRE(r == e);
+        REQUIRE(all(sd::rcp<sd::precision::refined>(F(sd::zero())) == F(sd::inf())));
+        REQUIRE(all(sd::rcp<sd::precision::refined>(F(sd::inf())) == F(sd::zero())));
+    }
+    SECTION("reciprocal square root with selectable precision") {
+        expect1([](scalar_t a) { return 1 / std::sqrt(std::abs(a)); });
+        r = sd::rsqrt<sd::precision::fast>(abs(va));
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(0.005));
+        r = sd::rsqrt<sd::precision::refined>(abs(va));
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(1e-6));
+        r = sd::rsqrt<sd::precision::exact>(abs(va));
+        REQUIRE(r == e);
+        REQUIRE(all(sd::rsqrt<sd::precision::refined>(F(sd::zero())) == F(sd::inf())));
+        REQUIRE(all(sd::rsqrt<sd::precision::refined>(F(sd::inf())) == F(sd::zero())));
+    }
+    SECTION("square root with selectable precision") {
+        expect1([](scalar_t a) { return std::sqrt(std::abs(a)); });
+        r = sd::sqrt<sd::precision::fast>(abs(va));
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(0.005));
+        r = sd::sqrt<sd::precision::refined>(abs(va));
+        for (auto i = 0U; i < F::width; ++i) REQUIRE(r[i] == Approx(e[i]).epsilon(1e-6));
+        r = sd::sqrt<sd::precision::exact>(abs(va));
+        REQUIRE(r == e);
+        REQUIRE(all(sd::sqrt<sd::precision::fast>(F(sd::zero())) == F(sd::zero())));
+        REQUIRE(all(sd::sqrt<sd::precision::fast>(F(sd::inf())) == F(sd::inf())));
+        REQUIRE(all(sd::sqrt<sd::precision::refined>(F(sd::inf())) == F(sd::inf())));
+    }
     SECTION("rhs of compound can be implicitly constructed") {
         va = vb;
         va += 1.23f;
@@ -778,6 +1051,76 @@ TEST_CASE(SIMD_TYPE " uint arithmetic", SIMD_TEST_TAG) {
         r = max(va, vb);
         REQUIRE(r == e);
     }
+#if SIMD_SCALAR_SIZE == 4
+    SECTION("shift by a scalar count") {
+        expect1([](scalar_t a) { return a << 7; });
+        r = va << 7;
+        REQUIRE(r == e);
+        expect1([](scalar_t a) { return a >> 7; });
+        r = va >> 7;
+        REQUIRE(r == e);
+        // negative counts are out of range, like the counts of 32 or more
+        for (int n : {0, 1, 31, 32, 33, 255, 256, -1, -32}) {
+            const bool in_range = unsigned(n) < 32U;
+            for (std::size_t i = 0; i < U::width; ++i) {
+                e[i] = in_range ? bufAU[i] << n : 0U;
+            }
+            r = va << n;
+            REQUIRE(r == e);
+            for (std::size_t i = 0; i < U::width; ++i) {
+                e[i] = in_range ? bufAU[i] >> n : 0U;
+            }
+            r = va >> n;
+            REQUIRE(r == e);
+        }
+        va <<= 3;
+        va >>= 5;
+        expect1([](scalar_t a) { return (a << 3) >> 5; });
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("shift by a per-lane count") {
+        expect([](scalar_t a, scalar_t b) { return a << (b & 31); });
+        r = va << (vb & 31U);
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a >> (b & 31); });
+        r = va >> (vb & 31U);
+        REQUIRE(r == e);
+        va >>= (vb & 31U);
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("shift by out-of-range per-lane counts") {
+        const scalar_t counts[] = {32U, 33U, 255U, 256U, 0xffffffffU, 0x80000000U, 0x100U, 64U};
+        U::storage_t n;
+        for (std::size_t i = 0; i < U::width; ++i) {
+            n[i] = counts[i % 8];
+            e[i] = 0U;
+        }
+        r = va << U(n);
+        REQUIRE(r == e);
+        r = va >> U(n);
+        REQUIRE(r == e);
+    }
+    SECTION("rotate") {
+        expect1([](scalar_t a) { return (a << 9) | (a >> 23); });
+        r = rotl(va, 9);
+        REQUIRE(r == e);
+        r = rotr(va, 23);
+        REQUIRE(r == e);
+        r = rotl(va, 0);
+        REQUIRE(r == bufAU);
+        r = rotr(va, 32);
+        REQUIRE(r == bufAU);
+        expect([](scalar_t a, scalar_t b) {
+            return (a << (b & 31)) | (a >> ((32 - (b & 31)) & 31));
+        });
+        r = rotl(va, vb);
+        REQUIRE(r == e);
+        r = rotr(va, U(32U) - vb);
+        REQUIRE(r == e);
+    }
+#endif
     SECTION("rhs of compound can be implicitly constructed") {
         va = vb;
         va &= 0xdeadbeefU;
@@ -888,6 +1231,69 @@ TEST_CASE(SIMD_TYPE " int arithmetic", SIMD_TEST_TAG) {
         r = abs(va);
         REQUIRE(r == e);
     }
+#if SIMD_SCALAR_SIZE == 4
+    SECTION("shift by a scalar count") {
+        expect1([](scalar_t a) { return scalar_t(uint32_t(a) << 7); });
+        r = va << 7;
+        REQUIRE(r == e);
+        expect1([](scalar_t a) { return a >> 7; });
+        r = va >> 7;
+        REQUIRE(r == e);
+        // negative counts are out of range, like the counts of 32 or more
+        for (int n : {0, 1, 31, 32, 33, 255, 256, -1, -32}) {
+            const bool in_range = unsigned(n) < 32U;
+            for (std::size_t i = 0; i < S::width; ++i) {
+                e[i] = in_range ? scalar_t(uint32_t(bufAS[i]) << n) : 0;
+            }
+            r = va << n;
+            REQUIRE(r == e);
+            for (std::size_t i = 0; i < S::width; ++i) {
+                e[i] = bufAS[i] >> (in_range ? n : 31);
+            }
+            r = va >> n;
+            REQUIRE(r == e);
+        }
+        va <<= 3;
+        va >>= 5;
+        expect1([](scalar_t a) { return scalar_t(uint32_t(a) << 3) >> 5; });
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("shift by a per-lane count") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(uint32_t(a) << (b & 31)); });
+        r = va << (vb & 31);
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a >> (b & 31); });
+        r = va >> (vb & 31);
+        REQUIRE(r == e);
+        va >>= (vb & 31);
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("shift by out-of-range per-lane counts") {
+        // the counts are unsigned, so negative ones shift all bits out
+        const scalar_t counts[] = {32, 33, 255, 256, -1, -31, -32, INT32_MIN};
+        S::storage_t n;
+        for (std::size_t i = 0; i < S::width; ++i) {
+            n[i] = counts[i % 8];
+            e[i] = 0;
+        }
+        r = va << S(n);
+        REQUIRE(r == e);
+        for (std::size_t i = 0; i < S::width; ++i) e[i] = bufAS[i] < 0 ? -1 : 0;
+        r = va >> S(n);
+        REQUIRE(r == e);
+    }
+    SECTION("rotate") {
+        expect1([](scalar_t a) {
+            return scalar_t((uint32_t(a) << 9) | (uint32_t(a) >> 23));
+        });
+        r = rotl(va, 9);
+        REQUIRE(r == e);
+        r = rotr(va, -9);
+        REQUIRE(r == e);
+    }
+#endif
     SECTION("rhs of compound can be implicitly constructed") {
         va = vb;
         va += 123;
@@ -1218,6 +1624,311 @@ TEST_CASE(SIMD_TYPE " horizontal operations", SIMD_TEST_TAG) {
     }
 }
 
+// a pattern that moves lanes across 128-bit halves and one that keeps them in place
+#if SIMD_WIDTH == 1
+#define SHUFFLE_ANY 0
+#define SHUFFLE_IN_HALF 0
+#elif SIMD_WIDTH == 2
+#define SHUFFLE_ANY 1, 1
+#define SHUFFLE_IN_HALF 1, 0
+#elif SIMD_WIDTH == 4
+#define SHUFFLE_ANY 2, 0, 3, 3
+#define SHUFFLE_IN_HALF 1, 0, 3, 2
+#elif SIMD_WIDTH == 8
+#define SHUFFLE_ANY 5, 0, 7, 2, 1, 4, 6, 6
+#define SHUFFLE_IN_HALF 1, 0, 3, 3, 5, 4, 7, 7
+#endif
+
+TEST_CASE(SIMD_TYPE " lane permutations", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    const std::size_t w = SIMD_WIDTH;
+    U::storage_t sa, sb;
+    scalar_t va = 1, vb = 101;
+    for (std::size_t i = 0; i < w; ++i) {
+        sa[i] = va++;
+        sb[i] = vb++;
+    }
+    const U a = sa;
+    const U b = sb;
+    U::storage_t r;
+
+    SECTION("shuffle") {
+        const std::size_t any[] = {SHUFFLE_ANY};
+        r = sd::shuffle<SHUFFLE_ANY>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[any[i]]); }
+        const std::size_t in_half[] = {SHUFFLE_IN_HALF};
+        r = sd::shuffle<SHUFFLE_IN_HALF>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[in_half[i]]); }
+
+        const F::storage_t f(sd::shuffle<SHUFFLE_ANY>(F(bufAF)));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(f[i] == bufAF[any[i]]); }
+    }
+    SECTION("blend") {
+        constexpr std::uint64_t mask = 0x9a5c3e6dULL & ((std::uint64_t(1) << SIMD_WIDTH) - 1);
+        r = sd::blend<mask>(a, b);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(r[i] == (((mask >> i) & 1) ? sb[i] : sa[i]));
+        }
+        r = sd::blend<0>(a, b);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[i]); }
+        const S::storage_t s(sd::blend<mask>(S(bufAS), S(bufBS)));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(s[i] == (((mask >> i) & 1) ? bufBS[i] : bufAS[i]));
+        }
+    }
+    SECTION("reverse") {
+        r = reverse(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[w - 1 - i]); }
+        const F::storage_t f(reverse(F(bufAF)));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(f[i] == bufAF[w - 1 - i]); }
+    }
+    SECTION("rotate lanes") {
+        r = sd::rotate_lanes<1>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[(i + 1) % w]); }
+        r = sd::rotate_lanes<SIMD_WIDTH - 1>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[(i + w - 1) % w]); }
+        r = sd::rotate_lanes<SIMD_WIDTH>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[i]); }
+    }
+    SECTION("broadcast lane") {
+        r = sd::broadcast_lane<SIMD_WIDTH - 1>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[w - 1]); }
+        r = sd::broadcast_lane<0>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[0]); }
+    }
+    SECTION("interleave") {
+        // a0, b0, a1, b1, ...
+        auto seq = [&](std::size_t k) { return k % 2 == 0 ? sa[k / 2] : sb[k / 2]; };
+        const U::storage_t lo(interleave_lo(a, b));
+        const U::storage_t hi(interleave_hi(a, b));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(lo[i] == seq(i));
+            REQUIRE(hi[i] == seq(w + i));
+        }
+    }
+}
+
+#undef SHUFFLE_ANY
+#undef SHUFFLE_IN_HALF
+
+TEST_CASE(SIMD_TYPE " scalar reductions", SIMD_TEST_TAG) {
+    SECTION("on floats") {
+        using scalar_t = F::scalar_t;
+        const F a = bufAF;
+        const scalar_t sum = std::accumulate(begin(bufAF), end(bufAF), scalar_t(0));
+        const scalar_t prod = std::accumulate(begin(bufAF), end(bufAF), scalar_t(1),
+                                              std::multiplies<scalar_t>());
+        REQUIRE(hsum(a) == Approx(sum));
+        REQUIRE(hprod(a) == Approx(prod));
+        REQUIRE(hmin(a) == *std::min_element(begin(bufAF), end(bufAF)));
+        REQUIRE(hmax(a) == *std::max_element(begin(bufAF), end(bufAF)));
+    }
+    SECTION("on uints") {
+        using scalar_t = U::scalar_t;
+        const U a = bufAU;
+        REQUIRE(hsum(a) == std::accumulate(begin(bufAU), end(bufAU), scalar_t(0)));
+        REQUIRE(hmin(a) == *std::min_element(begin(bufAU), end(bufAU)));
+        REQUIRE(hmax(a) == *std::max_element(begin(bufAU), end(bufAU)));
+    }
+    SECTION("on ints") {
+        const S a = bufAS;
+        REQUIRE(hmin(a) == *std::min_element(begin(bufAS), end(bufAS)));
+        REQUIRE(hmax(a) == *std::max_element(begin(bufAS), end(bufAS)));
+    }
+}
+
+TEST_CASE(SIMD_TYPE " multi-vector reductions", SIMD_TEST_TAG) {
+    const std::size_t w = SIMD_WIDTH;
+
+    // row i holds distinct values, rotated by i lanes and scaled
+    F rowsF[SIMD_WIDTH];
+    U rowsU[SIMD_WIDTH];
+    for (std::size_t i = 0; i < w; ++i) {
+        F::storage_t f;
+        U::storage_t u;
+        for (std::size_t j = 0; j < w; ++j) {
+            f[j] = bufAF[(i + j) % w] * F::scalar_t(i + 1);
+            u[j] = bufAU[(i + j) % w] ^ bufBU[i];
+        }
+        rowsF[i] = f;
+        rowsU[i] = u;
+    }
+
+    SECTION("sum of floats") {
+        const F::storage_t r(reduce_n(rowsF, sd::op_add{}));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == Approx(hsum(rowsF[i]))); }
+    }
+    SECTION("max of floats") {
+        const F::storage_t r(reduce_n(rowsF, sd::op_max{}));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == hmax(rowsF[i])); }
+    }
+    SECTION("min and xor of uints") {
+        const U::storage_t r(reduce_n(rowsU, sd::op_min{}));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == hmin(rowsU[i])); }
+        const U::storage_t x(reduce_n(rowsU, sd::op_bitxor{}));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(x[i] == first_scalar(reduce(rowsU[i], sd::op_bitxor{})));
+        }
+    }
+    SECTION("fewer vectors than lanes") {
+        const U few[] = {rowsU[0]};
+        const U::storage_t r(reduce_n(few, sd::op_max{}));
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == hmax(rowsU[0])); }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " prefix scans", SIMD_TEST_TAG) {
+    const std::size_t w = SIMD_WIDTH;
+
+    SECTION("sum of floats") {
+        using scalar_t = F::scalar_t;
+        const F::storage_t in(bufAF);
+        const F::storage_t incl(inclusive_scan(F(bufAF), sd::op_add{}));
+        const F::storage_t excl(exclusive_scan(F(bufAF), sd::op_add{}));
+        scalar_t acc = 0;
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(excl[i] == Approx(acc));
+            acc += in[i];
+            REQUIRE(incl[i] == Approx(acc));
+        }
+    }
+    SECTION("sum and max of uints") {
+        using scalar_t = U::scalar_t;
+        const U::storage_t in(bufAU);
+        const U::storage_t sum(inclusive_scan(U(bufAU), sd::op_add{}));
+        const U::storage_t hi(inclusive_scan(U(bufAU), sd::op_max{}));
+        const U::storage_t excl(exclusive_scan(U(bufAU), sd::op_add{}, in[0]));
+        scalar_t acc = 0, top = 0;
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(excl[i] == acc + in[0]);
+            acc += in[i];
+            top = std::max(top, in[i]);
+            REQUIRE(sum[i] == acc);
+            REQUIRE(hi[i] == top);
+        }
+    }
+    SECTION("min of ints") {
+        using scalar_t = S::scalar_t;
+        const S::storage_t in(bufAS);
+        const S::storage_t incl(inclusive_scan(S(bufAS), sd::op_min{}));
+        const S::storage_t excl(exclusive_scan(S(bufAS), sd::op_min{}));
+        scalar_t low = std::numeric_limits<scalar_t>::max();
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(excl[i] == low);
+            low = std::min(low, in[i]);
+            REQUIRE(incl[i] == low);
+        }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " compress and expand", SIMD_TEST_TAG) {
+    const std::size_t w = SIMD_WIDTH;
+    const F::storage_t inF(bufAF);
+    const U::storage_t inU(bufAU);
+    const F::scalar_t sentinel = 1000;
+
+    for (uint32_t bits = 0; bits <= F::mask_t::all_bits; ++bits) {
+        const F::mask_t mF(bits);
+        const U::mask_t mU(bits);
+        std::vector<F::scalar_t> selF;
+        std::vector<U::scalar_t> selU;
+        for (std::size_t i = 0; i < w; ++i) {
+            if (mF[int(i)]) {
+                selF.push_back(inF[i]);
+                selU.push_back(inU[i]);
+            }
+        }
+        const std::size_t n = selF.size();
+
+        std::vector<F::scalar_t> outF(w + 1, sentinel);
+        REQUIRE(compress_store(outF.data(), F(inF), mF) == n);
+        REQUIRE(std::equal(selF.begin(), selF.end(), outF.begin()));
+        REQUIRE(outF[n] == sentinel);
+
+        std::vector<U::scalar_t> outU(w);
+        REQUIRE(compress_store(outU.data(), U(inU), mU) == n);
+        REQUIRE(std::equal(selU.begin(), selU.end(), outU.begin()));
+
+        const F::storage_t cF(compress(F(inF), mF));
+        const U::storage_t cU(compress(U(inU), mU));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(cF[i] == (i < n ? selF[i] : 0));
+            REQUIRE(cU[i] == (i < n ? selU[i] : 0));
+        }
+
+        const F::storage_t eF(sd::expand_load<F>(selF.data(), mF));
+        const U::storage_t eU(expand(U(cU), mU));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(eF[i] == (mF[int(i)] ? inF[i] : 0));
+            REQUIRE(eU[i] == (mU[int(i)] ? inU[i] : 0));
+        }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " interleaved channels", SIMD_TEST_TAG) {
+    const std::size_t w = SIMD_WIDTH;
+    std::vector<F::scalar_t> inF(5 * w);
+    std::vector<U::scalar_t> inU(5 * w);
+    std::vector<S::scalar_t> inS(5 * w);
+    std::iota(inF.begin(), inF.end(), 0.5f);
+    std::iota(inU.begin(), inU.end(), 1U);
+    std::iota(inS.begin(), inS.end(), -100);
+
+    SECTION("two channels") {
+        U x, y;
+        sd::load_deinterleave<2>(inU.data(), x, y);
+        const U::storage_t sx(x), sy(y);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sx[i] == inU[2 * i]);
+            REQUIRE(sy[i] == inU[2 * i + 1]);
+        }
+        std::vector<U::scalar_t> out(2 * w + 1, 7);
+        sd::store_interleave<2>(out.data(), x, y);
+        REQUIRE(std::equal(out.begin(), out.end() - 1, inU.begin()));
+        REQUIRE(out[2 * w] == 7);
+    }
+    SECTION("three channels") {
+        F x, y, z;
+        sd::load_deinterleave<3>(inF.data(), x, y, z);
+        const F::storage_t sx(x), sy(y), sz(z);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sx[i] == inF[3 * i]);
+            REQUIRE(sy[i] == inF[3 * i + 1]);
+            REQUIRE(sz[i] == inF[3 * i + 2]);
+        }
+        std::vector<F::scalar_t> out(3 * w + 1, 7);
+        sd::store_interleave<3>(out.data(), x, y, z);
+        REQUIRE(std::equal(out.begin(), out.end() - 1, inF.begin()));
+        REQUIRE(out[3 * w] == 7);
+    }
+    SECTION("four channels") {
+        S r, g, b, a;
+        sd::load_deinterleave<4>(inS.data(), r, g, b, a);
+        const S::storage_t sr(r), sg(g), sb(b), sa(a);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sr[i] == inS[4 * i]);
+            REQUIRE(sg[i] == inS[4 * i + 1]);
+            REQUIRE(sb[i] == inS[4 * i + 2]);
+            REQUIRE(sa[i] == inS[4 * i + 3]);
+        }
+        std::vector<S::scalar_t> out(4 * w + 1, 7);
+        sd::store_interleave<4>(out.data(), r, g, b, a);
+        REQUIRE(std::equal(out.begin(), out.end() - 1, inS.begin()));
+        REQUIRE(out[4 * w] == 7);
+    }
+    SECTION("five channels") {
+        F v[5];
+        sd::load_deinterleave<5>(inF.data(), v[0], v[1], v[2], v[3], v[4]);
+        for (std::size_t c = 0; c < 5; ++c) {
+            const F::storage_t sv(v[c]);
+            for (std::size_t i = 0; i < w; ++i) { REQUIRE(sv[i] == inF[5 * i + c]); }
+        }
+        std::vector<F::scalar_t> out(5 * w);
+        sd::store_interleave<5>(out.data(), v[0], v[1], v[2], v[3], v[4]);
+        REQUIRE(out == inF);
+    }
+}
+
 TEST_CASE(SIMD_TYPE " conditional", SIMD_TEST_TAG) {
     B ab = bufAB;
     F af = bufAF;
@@ -1249,7 +1960,7 @@ TEST_CASE(SIMD_TYPE " mask", SIMD_TEST_TAG) {
         auto expected = [](const B::storage_t& s) {
             B::mask_t res(0U);
             for (auto i = 0U; i < s.size(); ++i) {
-                if (sd::cast_u(s[i]) & (1U << 31)) { res |= B::mask_t(1U << i); }
+                if (sd::cast_u(s[i]) & signBitU) { res |= B::mask_t(1U << i); }
             }
             return res;
         };
@@ -1265,6 +1976,19 @@ TEST_CASE(SIMD_TYPE " mask", SIMD_TEST_TAG) {
         REQUIRE(all(a) == all(mask(a)));
         REQUIRE(all(b) == all(mask(b)));
     }
+    SECTION("back to vectors") {
+        const B a = bufAB;
+        const B b = bufBB;
+        const auto m = mask(a);
+        REQUIRE(mask(sd::from_mask<F>(m)) == m);
+        REQUIRE(mask(sd::from_mask<U>(~m)) == ~m);
+        REQUIRE(mask(sd::from_mask<B>(mask(b))) == mask(b));
+        const S::storage_t idx(sd::lane_indices<U>(m));
+        std::size_t n = 0;
+        for (auto i : m) { REQUIRE(idx[n++] == S::scalar_t(i)); }
+        REQUIRE(popcount(m) == int(n));
+        for (; n < SIMD_WIDTH; ++n) { REQUIRE(idx[n] == 0); }
+    }
 }
 
 TEST_CASE(SIMD_TYPE " first_scalar", SIMD_TEST_TAG) {
@@ -0,0 +1,23 @@
+#define SIMDEE_DATA_BUFAB                                                                          \
+    false, true, false, false, true, false, true, false, false, false, false, true, false, false,  \
+    false, true
+#define SIMDEE_DATA_BUFBB                                                                          \
+    true, true, true, false, true, false, true, false, true, true, false, false, false, true,      \
+    true, true
+#define SIMDEE_DATA_BUFZB                                                                          \
+    false, false, false, false, false, false, false, false, false, false, false, false, false,     \
+    false, false, false
+#define SIMDEE_DATA_BUFAU                                                                          \
+    5366U, 65535U, 49569U, 808U, 43385U, 21433U, 11017U, 56346U, 4130U, 22974U, 64132U, 57139U,    \
+    36347U, 30112U, 28900U, 54143U
+#define SIMDEE_DATA_BUFBU                                                                          \
+    45370U, 65534U, 47522U, 415U, 841U, 33593U, 21953U, 63037U, 51141U, 48181U, 48284U, 18476U,    \
+    19487U, 44493U, 52920U, 54143U
+#define SIMDEE_DATA_BUFZU 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+#define SIMDEE_DATA_BUFAS                                                                          \
+    14695, 31864, -32768, 32767, -21519, -17847, -5424, -21089, -13717, 15494, -27883, 14251,      \
+    6266, 11651, 28159, 27200
+#define SIMDEE_DATA_BUFBS                                                                          \
+    10612, -7543, -32767, 32766, -22324, 2980, 29247, -26271, 9997, -20672, -4847, -10746, 3251,   \
+    -15714, 18846, 27200
+#define SIMDEE_DATA_BUFZS 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
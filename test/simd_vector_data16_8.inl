@@ -0,0 +1,17 @@
+#define SIMDEE_DATA_BUFAB                                                                          \
+    true, false, false, true, true, true, true, false, true, false, true, true, false, false,      \
+    false, false
+#define SIMDEE_DATA_BUFBB                                                                          \
+    true, false, false, false, true, true, true, false, true, true, false, false, true, false,     \
+    false, false
+#define SIMDEE_DATA_BUFZB                                                                          \
+    false, false, false, false, false, false, false, false, false, false, false, false, false,     \
+    false, false, false
+#define SIMDEE_DATA_BUFAU                                                                          \
+    223U, 255U, 208U, 211U, 39U, 12U, 126U, 17U, 2U, 127U, 227U, 223U, 232U, 42U, 77U, 202U
+#define SIMDEE_DATA_BUFBU                                                                          \
+    183U, 254U, 27U, 69U, 89U, 17U, 69U, 0U, 102U, 100U, 108U, 253U, 123U, 33U, 98U, 202U
+#define SIMDEE_DATA_BUFZU 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+#define SIMDEE_DATA_BUFAS 19, 55, -128, 127, 64, -108, -2, 17, -106, 74, 25, -97, 73, -107, 2, -8
+#define SIMDEE_DATA_BUFBS 72, -86, -127, 126, 112, 115, 125, 9, 51, 36, -120, 1, -87, -9, -63, -8
+#define SIMDEE_DATA_BUFZS 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
@@ -0,0 +1,12 @@
+#define SIMDEE_DATA_BUFAB true
+#define SIMDEE_DATA_BUFBB false
+#define SIMDEE_DATA_BUFZB false
+#define SIMDEE_DATA_BUFAF -0.2778719317263155
+#define SIMDEE_DATA_BUFBF -0.2364545803382261
+#define SIMDEE_DATA_BUFZF 0.
+#define SIMDEE_DATA_BUFAU 11753029375442378523ULL
+#define SIMDEE_DATA_BUFBU 7679702461210934621ULL
+#define SIMDEE_DATA_BUFZU 0ULL
+#define SIMDEE_DATA_BUFAS -2712190449LL
+#define SIMDEE_DATA_BUFBS 1724135231LL
+#define SIMDEE_DATA_BUFZS 0LL
@@ -0,0 +1,12 @@
+#define SIMDEE_DATA_BUFAB true, false
+#define SIMDEE_DATA_BUFBB false, false
+#define SIMDEE_DATA_BUFZB false, false
+#define SIMDEE_DATA_BUFAF -0.2778719317263155, +2.2294456839715082
+#define SIMDEE_DATA_BUFBF -0.2364545803382261, +2.2294456839715082
+#define SIMDEE_DATA_BUFZF 0., 0.
+#define SIMDEE_DATA_BUFAU 11753029375442378523ULL, 3761735248019283746ULL
+#define SIMDEE_DATA_BUFBU 7679702461210934621ULL, 3761735248019283746ULL
+#define SIMDEE_DATA_BUFZU 0ULL, 0ULL
+#define SIMDEE_DATA_BUFAS -2712190449LL, 1440646957LL
+#define SIMDEE_DATA_BUFBS 1724135231LL, 1440646957LL
+#define SIMDEE_DATA_BUFZS 0LL, 0LL
@@ -0,0 +1,30 @@
+#define SIMDEE_DATA_BUFAB                                                                          \
+    false, false, false, true, false, false, false, true, false, false, false, false, false,       \
+    true, false, true, true, false, true, true, true, true, false, true, true, true, true, true,   \
+    false, true, false, false
+#define SIMDEE_DATA_BUFBB                                                                          \
+    true, true, true, false, false, false, false, false, false, true, true, true, true, false,     \
+    false, false, true, true, true, false, true, true, true, false, true, true, true, true, true,  \
+    true, false, true
+#define SIMDEE_DATA_BUFZB                                                                          \
+    false, false, false, false, false, false, false, false, false, false, false, false, false,     \
+    false, false, false, false, false, false, false, false, false, false, false, false, false,     \
+    false, false, false, false, false, false
+#define SIMDEE_DATA_BUFAU                                                                          \
+    131U, 255U, 76U, 172U, 96U, 112U, 86U, 105U, 2U, 224U, 0U, 81U, 11U, 244U, 237U, 228U, 0U,     \
+    47U, 35U, 9U, 28U, 237U, 166U, 204U, 5U, 165U, 210U, 15U, 158U, 169U, 198U, 130U
+#define SIMDEE_DATA_BUFBU                                                                          \
+    232U, 254U, 48U, 17U, 131U, 11U, 32U, 158U, 249U, 89U, 90U, 119U, 84U, 84U, 21U, 78U, 38U,     \
+    77U, 190U, 151U, 216U, 196U, 103U, 77U, 98U, 135U, 124U, 137U, 154U, 230U, 228U, 130U
+#define SIMDEE_DATA_BUFZU                                                                          \
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U,    \
+    0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+#define SIMDEE_DATA_BUFAS                                                                          \
+    13, -111, -128, 127, 60, 105, -106, 77, -100, 118, -92, -101, -104, 73, -20, -107, 89, 36,     \
+    90, 23, -25, -62, 3, 24, 24, 124, 22, 11, 110, 67, -109, -79
+#define SIMDEE_DATA_BUFBS                                                                          \
+    -45, -38, -127, 126, 63, -100, 2, 56, -124, 26, -91, 60, 54, -119, -74, -126, 100, 48, -65,    \
+    93, 53, -82, -22, 79, -15, 126, 2, 17, 74, 122, 101, -79
+#define SIMDEE_DATA_BUFZS                                                                          \
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,   \
+    0
@@ -0,0 +1,16 @@
+#define SIMDEE_DATA_BUFAB true, false, true, true
+#define SIMDEE_DATA_BUFBB false, true, false, true
+#define SIMDEE_DATA_BUFZB false, false, false, false
+#define SIMDEE_DATA_BUFAF                                                                          \
+    -0.2778719317263155, +0.7015414682037615, -2.0518163034871923, +2.2294456839715082
+#define SIMDEE_DATA_BUFBF                                                                          \
+    -0.2364545803382261, +2.0236908912837104, -2.2583539727105487, +2.2294456839715082
+#define SIMDEE_DATA_BUFZF 0., 0., 0., 0.
+#define SIMDEE_DATA_BUFAU                                                                          \
+    11753029375442378523ULL, 1117080442ULL, 17817141237004561290ULL, 3761735248019283746ULL
+#define SIMDEE_DATA_BUFBU                                                                          \
+    7679702461210934621ULL, 2102346647ULL, 480083363918273645ULL, 3761735248019283746ULL
+#define SIMDEE_DATA_BUFZU 0ULL, 0ULL, 0ULL, 0ULL
+#define SIMDEE_DATA_BUFAS -2712190449LL, -48692967LL, -2214510247LL, 1440646957LL
+#define SIMDEE_DATA_BUFBS 1724135231LL, 2956848532LL, 64122653LL, 1440646957LL
+#define SIMDEE_DATA_BUFZS 0LL, 0LL, 0LL, 0LL
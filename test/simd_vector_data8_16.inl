@@ -0,0 +1,9 @@
+#define SIMDEE_DATA_BUFAB true, true, false, false, true, true, false, false
+#define SIMDEE_DATA_BUFBB true, false, false, true, true, false, true, false
+#define SIMDEE_DATA_BUFZB false, false, false, false, false, false, false, false
+#define SIMDEE_DATA_BUFAU 20022U, 65535U, 42962U, 63808U, 17901U, 4746U, 48083U, 30316U
+#define SIMDEE_DATA_BUFBU 37592U, 65534U, 47647U, 57189U, 37839U, 48623U, 1673U, 30316U
+#define SIMDEE_DATA_BUFZU 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U
+#define SIMDEE_DATA_BUFAS 22843, -19545, -32768, 32767, 8033, 15169, 14920, -7199
+#define SIMDEE_DATA_BUFBS -15722, 27144, -32767, 32766, 15161, 8653, 12132, -7199
+#define SIMDEE_DATA_BUFZS 0, 0, 0, 0, 0, 0, 0, 0
@@ -0,0 +1,17 @@
+#include <catch2/catch.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simd_vectors/dum.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::dual<sd::dual<sd::dual<sd::dual<sd::dumb8>>>>;
+using U = sd::dual<sd::dual<sd::dual<sd::dual<sd::dumu8>>>>;
+using S = sd::dual<sd::dual<sd::dual<sd::dual<sd::dums8>>>>;
+
+#define SIMD_TYPE "dum16_8"
+#define SIMD_TEST_TAG "[simd_vectors][dum16_8]"
+#define SIMD_WIDTH 16
+#define SIMD_SCALAR_SIZE 1
+
+#include "simd_vector_data16_8.inl"
+
+#include "simd_vector_narrow.inl"
@@ -0,0 +1,20 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+
+#if SIMDEE_GNU_VECTORS
+#include <simdee/simd_vectors/gnu.hpp>
+
+using B = sd::gnub;
+using F = sd::gnuf;
+using U = sd::gnuu;
+using S = sd::gnus;
+
+#define SIMD_TYPE "gnu"
+#define SIMD_TEST_TAG "[simd_vectors][gnu]"
+#define SIMD_WIDTH 4
+
+#include "simd_vector_data4.inl"
+
+#include "simd_vector.inl"
+
+#endif
@@ -0,0 +1,810 @@
+//
+// common tests of SIMD types with 8-bit and 16-bit scalars
+//
+// following macros are expected to be defined
+// SIMD_TYPE -- name of the SIMD type as a string
+// SIMD_TEST_TAG -- catch tests tag(s) as a string
+// SIMD_WIDTH -- expected SIMD width
+// SIMD_SCALAR_SIZE -- expected size of the scalar types in bytes, 1 or 2
+//
+// the narrow families have no floating-point counterpart, only B, U and S types are tested
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+
+#define ASSERT(COND) static_assert(COND, SIMD_TYPE " compile-time check")
+
+#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 6
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+ASSERT(B::width == SIMD_WIDTH);
+ASSERT(U::width == SIMD_WIDTH);
+ASSERT(S::width == SIMD_WIDTH);
+ASSERT((std::is_same<B::scalar_t, sd::select_bool_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<U::scalar_t, sd::select_uint_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<S::scalar_t, sd::select_sint_t<SIMD_SCALAR_SIZE>>::value));
+ASSERT((std::is_same<B::vec_u, U>::value));
+ASSERT((std::is_same<U::vec_s, S>::value));
+ASSERT((std::is_same<S::vec_b, B>::value));
+ASSERT((std::is_same<B::mask_t, sd::impl::mask<(~0U >> (32 - SIMD_WIDTH))>>::value));
+ASSERT((std::is_same<B::storage_t, sd::storage<B>>::value));
+ASSERT((std::is_same<U::storage_t, sd::storage<U>>::value));
+ASSERT((std::is_same<S::storage_t, sd::storage<S>>::value));
+ASSERT(sizeof(B) == sizeof(B::vector_t));
+ASSERT(sizeof(U) == sizeof(U::vector_t));
+ASSERT(sizeof(S) == sizeof(S::vector_t));
+ASSERT(sizeof(B::scalar_t) * B::width == sizeof(B));
+ASSERT(sizeof(U::scalar_t) * U::width == sizeof(U));
+ASSERT(sizeof(S::scalar_t) * S::width == sizeof(S));
+ASSERT((std::is_trivially_copyable<B>::value));
+ASSERT((std::is_trivially_copyable<U>::value));
+ASSERT((std::is_trivially_copyable<S>::value));
+ASSERT((sd::is_simd_vector<B>::value));
+ASSERT((sd::is_simd_vector<U>::value));
+ASSERT((sd::is_simd_vector<S>::value));
+
+#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 6
+#pragma GCC diagnostic pop
+#endif
+
+const B::storage_t bufAB{SIMDEE_DATA_BUFAB};
+const B::storage_t bufBB{SIMDEE_DATA_BUFBB};
+const B::storage_t bufZB{SIMDEE_DATA_BUFZB};
+const U::storage_t bufAU{SIMDEE_DATA_BUFAU};
+const U::storage_t bufBU{SIMDEE_DATA_BUFBU};
+const U::storage_t bufZU{SIMDEE_DATA_BUFZU};
+const S::storage_t bufAS{SIMDEE_DATA_BUFAS};
+const S::storage_t bufBS{SIMDEE_DATA_BUFBS};
+const S::storage_t bufZS{SIMDEE_DATA_BUFZS};
+
+const U::scalar_t allBitsU = U::scalar_t(~U::scalar_t(0));
+const U::scalar_t signBitU = U::scalar_t(U::scalar_t(1) << (8 * sizeof(U::scalar_t) - 1));
+
+// reference implementation of a saturating conversion from int
+template <typename T>
+T saturate_ref(int v) {
+    const int lo = int(std::numeric_limits<T>::min());
+    const int hi = int(std::numeric_limits<T>::max());
+    return T(std::min(std::max(v, lo), hi));
+}
+
+TEST_CASE(SIMD_TYPE " construction", SIMD_TEST_TAG) {
+    B::storage_t rb = bufZB;
+    U::storage_t ru = bufZU;
+    S::storage_t rs = bufZS;
+
+    auto tor = [&rb, &ru, &rs](const B& tb, const U& tu, const S& ts) {
+        rb = tb;
+        ru = tu;
+        rs = ts;
+    };
+
+    SECTION("from scalar_t") {
+        B tb(true);
+        U tu(U::scalar_t(123));
+        S ts(S::scalar_t(-123));
+        tor(tb, tu, ts);
+        for (auto val : rb) REQUIRE(val == true);
+        for (auto val : ru) REQUIRE(val == 123U);
+        for (auto val : rs) REQUIRE(val == -123);
+    }
+    SECTION("from Width x scalar_t (parentheses)") {
+        B tb(SIMDEE_DATA_BUFAB);
+        U tu(SIMDEE_DATA_BUFAU);
+        S ts(SIMDEE_DATA_BUFAS);
+        tor(tb, tu, ts);
+        REQUIRE(rb == bufAB);
+        REQUIRE(ru == bufAU);
+        REQUIRE(rs == bufAS);
+    }
+    SECTION("from aligned pointer") {
+        tor(sd::aligned(bufAB.data()), sd::aligned(bufAU.data()), sd::aligned(bufAS.data()));
+        REQUIRE(rb == bufAB);
+        REQUIRE(ru == bufAU);
+        REQUIRE(rs == bufAS);
+    }
+    SECTION("from unaligned pointer") {
+        tor(sd::unaligned(bufAB.data()), sd::unaligned(bufAU.data()),
+            sd::unaligned(bufAS.data()));
+        REQUIRE(rb == bufAB);
+        REQUIRE(ru == bufAU);
+        REQUIRE(rs == bufAS);
+    }
+    SECTION("from interleaved pointer") {
+        tor(sd::interleaved(bufAB.data(), 1), sd::interleaved(bufAU.data(), 1),
+            sd::interleaved(bufAS.data(), 1));
+        REQUIRE(rb == bufAB);
+        REQUIRE(ru == bufAU);
+        REQUIRE(rs == bufAS);
+    }
+    SECTION("from storage_t") {
+        tor(bufAB, bufAU, bufAS);
+        REQUIRE(rb == bufAB);
+        REQUIRE(ru == bufAU);
+        REQUIRE(rs == bufAS);
+    }
+    SECTION("from zero, all_bits, sign_bit (sd::init family)") {
+        tor(sd::zero(), sd::zero(), sd::zero());
+        for (auto val : ru) REQUIRE(val == 0U);
+        for (auto val : rs) REQUIRE(val == 0);
+        tor(sd::all_bits(), sd::all_bits(), sd::all_bits());
+        for (auto val : rb) REQUIRE(sd::dirty::as_u(val) == allBitsU);
+        for (auto val : ru) REQUIRE(val == allBitsU);
+        tor(sd::sign_bit(), sd::sign_bit(), sd::sign_bit());
+        for (auto val : ru) REQUIRE(val == signBitU);
+        for (auto val : rs) REQUIRE(val == std::numeric_limits<S::scalar_t>::min());
+    }
+}
+
+TEST_CASE(SIMD_TYPE " store", SIMD_TEST_TAG) {
+    U::storage_t ru = bufZU;
+    S::storage_t rs = bufZS;
+    U tu = bufAU;
+    S ts = bufAS;
+
+    SECTION("to aligned pointer") {
+        tu.aligned_store(ru.data());
+        ts.aligned_store(rs.data());
+    }
+    SECTION("to unaligned pointer") {
+        tu.unaligned_store(ru.data());
+        ts.unaligned_store(rs.data());
+    }
+    SECTION("to interleaved pointer") {
+        tu.interleaved_store(ru.data(), 1);
+        ts.interleaved_store(rs.data(), 1);
+    }
+    REQUIRE(ru == bufAU);
+    REQUIRE(rs == bufAS);
+}
+
+TEST_CASE(SIMD_TYPE " partial load and store", SIMD_TEST_TAG) {
+    const S::scalar_t fillS = -7;
+
+    for (std::size_t count = 0; count <= SIMD_WIDTH + 1; ++count) {
+        B::storage_t eb = bufZB;
+        U::storage_t eu;
+        S::storage_t es;
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            if (i < count) {
+                eb[i] = bufAB[i];
+                eu[i] = bufAU[i];
+                es[i] = bufAS[i];
+            } else {
+                eu[i] = allBitsU;
+                es[i] = fillS;
+            }
+        }
+
+        B tb = sd::partial(bufAB.data(), count);
+        U tu(sd::partial(bufAU.data(), count, sd::all_bits()));
+        S ts;
+        ts = sd::partial(bufAS.data(), count, fillS);
+        REQUIRE(B::storage_t(tb) == eb);
+        REQUIRE(U::storage_t(tu) == eu);
+        REQUIRE(S::storage_t(ts) == es);
+
+        U::storage_t ru;
+        S::storage_t rs;
+        std::fill(ru.data(), ru.data() + SIMD_WIDTH, allBitsU);
+        std::fill(rs.data(), rs.data() + SIMD_WIDTH, fillS);
+        sd::partial(ru.data(), count) = U(bufAU);
+        sd::partial(rs.data(), count) = S(bufAS);
+        REQUIRE(ru == eu);
+        REQUIRE(rs == es);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " type conversion", SIMD_TEST_TAG) {
+    SECTION("int to uint") {
+        U::storage_t expected, result;
+        std::transform(begin(bufAS), end(bufAS), begin(expected),
+                       [](S::scalar_t a) { return static_cast<U::scalar_t>(a); });
+        S in = bufAS;
+        result = U(in);
+        REQUIRE(result == expected);
+    }
+    SECTION("uint to int") {
+        S::storage_t expected, result;
+        std::transform(begin(bufAU), end(bufAU), begin(expected),
+                       [](U::scalar_t a) { return static_cast<S::scalar_t>(a); });
+        U in = bufAU;
+        result = S(in);
+        REQUIRE(result == expected);
+    }
+    SECTION("bool to uint") {
+        U::storage_t expected, result;
+        std::transform(begin(bufAB), end(bufAB), begin(expected),
+                       [](B::scalar_t a) { return static_cast<U::scalar_t>(a); });
+        B in = bufAB;
+        result = U(in);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " bool arithmetic", SIMD_TEST_TAG) {
+    using scalar_t = B::scalar_t;
+    B::storage_t r, e;
+    B va = bufAB;
+    B vb = bufBB;
+
+    auto expect1 = [&e](scalar_t (*f)(scalar_t)) {
+        std::transform(begin(bufAB), end(bufAB), begin(e), f);
+    };
+    auto expect = [&e](scalar_t (*f)(scalar_t, scalar_t)) {
+        std::transform(begin(bufAB), end(bufAB), begin(bufBB), begin(e), f);
+    };
+
+    SECTION("log not") {
+        expect1([](scalar_t a) { return !a; });
+        r = !va;
+        REQUIRE(r == e);
+    }
+    SECTION("log and") {
+        expect([](scalar_t a, scalar_t b) { return a && b; });
+        r = va && vb;
+        REQUIRE(r == e);
+    }
+    SECTION("log or") {
+        expect([](scalar_t a, scalar_t b) { return a || b; });
+        r = va || vb;
+        REQUIRE(r == e);
+    }
+    SECTION("equal to, not equal to") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(bool(a) == bool(b)); });
+        r = va == vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return scalar_t(bool(a) != bool(b)); });
+        r = va != vb;
+        REQUIRE(r == e);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " uint arithmetic", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    U::storage_t r, e;
+    U va = bufAU;
+    U vb = bufBU;
+
+    auto expect1 = [&e](scalar_t (*f)(scalar_t)) {
+        std::transform(begin(bufAU), end(bufAU), begin(e), f);
+    };
+    auto expect = [&e](scalar_t (*f)(scalar_t, scalar_t)) {
+        std::transform(begin(bufAU), end(bufAU), begin(bufBU), begin(e), f);
+    };
+
+    SECTION("bit not") {
+        expect1([](scalar_t a) { return scalar_t(~a); });
+        r = ~va;
+        REQUIRE(r == e);
+    }
+    SECTION("bit and, or, xor") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a & b); });
+        r = va & vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a | b); });
+        r = va | vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a ^ b); });
+        r = va ^ vb;
+        REQUIRE(r == e);
+    }
+    SECTION("unary minus") {
+        expect1([](scalar_t a) { return scalar_t(0U - a); });
+        r = -va;
+        REQUIRE(r == e);
+    }
+    SECTION("plus") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a + b); });
+        r = va + vb;
+        REQUIRE(r == e);
+        va += vb;
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("minus") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a - b); });
+        r = va - vb;
+        REQUIRE(r == e);
+    }
+    SECTION("multiplies") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(uint32_t(a) * b); });
+        r = va * vb;
+        REQUIRE(r == e);
+    }
+    SECTION("minimum, maximum") {
+        expect([](scalar_t a, scalar_t b) { return std::min(a, b); });
+        r = min(va, vb);
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return std::max(a, b); });
+        r = max(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("saturating plus") {
+        expect([](scalar_t a, scalar_t b) { return saturate_ref<scalar_t>(a + b); });
+        r = add_sat(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("saturating minus") {
+        expect([](scalar_t a, scalar_t b) { return saturate_ref<scalar_t>(a - b); });
+        r = sub_sat(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("rounding average") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t((a + b + 1) >> 1); });
+        r = avg(va, vb);
+        REQUIRE(r == e);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " int arithmetic", SIMD_TEST_TAG) {
+    using scalar_t = S::scalar_t;
+    S::storage_t r, e;
+    S va = bufAS;
+    S vb = bufBS;
+
+    auto expect1 = [&e](scalar_t (*f)(scalar_t)) {
+        std::transform(begin(bufAS), end(bufAS), begin(e), f);
+    };
+    auto expect = [&e](scalar_t (*f)(scalar_t, scalar_t)) {
+        std::transform(begin(bufAS), end(bufAS), begin(bufBS), begin(e), f);
+    };
+
+    SECTION("bit not") {
+        expect1([](scalar_t a) { return scalar_t(~a); });
+        r = ~va;
+        REQUIRE(r == e);
+    }
+    SECTION("unary minus") {
+        expect1([](scalar_t a) { return scalar_t(-a); });
+        r = -va;
+        REQUIRE(r == e);
+    }
+    SECTION("plus") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a + b); });
+        r = va + vb;
+        REQUIRE(r == e);
+    }
+    SECTION("minus") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a - b); });
+        r = va - vb;
+        REQUIRE(r == e);
+        va -= vb;
+        r = va;
+        REQUIRE(r == e);
+    }
+    SECTION("multiplies") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t(a * b); });
+        r = va * vb;
+        REQUIRE(r == e);
+    }
+    SECTION("minimum, maximum") {
+        expect([](scalar_t a, scalar_t b) { return std::min(a, b); });
+        r = min(va, vb);
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return std::max(a, b); });
+        r = max(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("absolute value") {
+        expect1([](scalar_t a) { return scalar_t(std::abs(a)); });
+        r = abs(va);
+        REQUIRE(r == e);
+    }
+    SECTION("saturating plus") {
+        expect([](scalar_t a, scalar_t b) { return saturate_ref<scalar_t>(a + b); });
+        r = add_sat(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("saturating minus") {
+        expect([](scalar_t a, scalar_t b) { return saturate_ref<scalar_t>(a - b); });
+        r = sub_sat(va, vb);
+        REQUIRE(r == e);
+    }
+    SECTION("rounding average") {
+        expect([](scalar_t a, scalar_t b) { return scalar_t((a + b + 1) >> 1); });
+        r = avg(va, vb);
+        REQUIRE(r == e);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " uint comparison", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    B::storage_t r, e;
+    U va = bufAU;
+    U vb = bufBU;
+
+    auto expect = [&e](bool (*f)(scalar_t, scalar_t)) {
+        std::transform(begin(bufAU), end(bufAU), begin(bufBU), begin(e), f);
+    };
+
+    SECTION("equal to, not equal to") {
+        expect([](scalar_t a, scalar_t b) { return a == b; });
+        r = va == vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a != b; });
+        r = va != vb;
+        REQUIRE(r == e);
+    }
+    SECTION("greater, less") {
+        expect([](scalar_t a, scalar_t b) { return a > b; });
+        r = va > vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a < b; });
+        r = va < vb;
+        REQUIRE(r == e);
+    }
+    SECTION("greater equal, less equal") {
+        expect([](scalar_t a, scalar_t b) { return a >= b; });
+        r = va >= vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a <= b; });
+        r = va <= vb;
+        REQUIRE(r == e);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " int comparison", SIMD_TEST_TAG) {
+    using scalar_t = S::scalar_t;
+    B::storage_t r, e;
+    S va = bufAS;
+    S vb = bufBS;
+
+    auto expect = [&e](bool (*f)(scalar_t, scalar_t)) {
+        std::transform(begin(bufAS), end(bufAS), begin(bufBS), begin(e), f);
+    };
+
+    SECTION("equal to, not equal to") {
+        expect([](scalar_t a, scalar_t b) { return a == b; });
+        r = va == vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a != b; });
+        r = va != vb;
+        REQUIRE(r == e);
+    }
+    SECTION("greater, less") {
+        expect([](scalar_t a, scalar_t b) { return a > b; });
+        r = va > vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a < b; });
+        r = va < vb;
+        REQUIRE(r == e);
+    }
+    SECTION("greater equal, less equal") {
+        expect([](scalar_t a, scalar_t b) { return a >= b; });
+        r = va >= vb;
+        REQUIRE(r == e);
+        expect([](scalar_t a, scalar_t b) { return a <= b; });
+        r = va <= vb;
+        REQUIRE(r == e);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " horizontal operations", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    U a = bufAU;
+    scalar_t e;
+    U::storage_t v;
+
+    SECTION("sum") {
+        auto add_ = [](scalar_t l, scalar_t r) { return scalar_t(l + r); };
+        e = std::accumulate(begin(bufAU), end(bufAU), scalar_t(0), add_);
+        v = reduce(a, sd::op_add{});
+        for (scalar_t vr : v) { REQUIRE(vr == e); }
+    }
+    SECTION("min") {
+        e = *std::min_element(begin(bufAU), end(bufAU));
+        v = reduce(a, sd::op_min{});
+        for (scalar_t vr : v) { REQUIRE(vr == e); }
+    }
+    SECTION("max") {
+        e = *std::max_element(begin(bufAU), end(bufAU));
+        v = reduce(a, sd::op_max{});
+        for (scalar_t vr : v) { REQUIRE(vr == e); }
+    }
+    SECTION("scalar") {
+        REQUIRE(hmin(a) == *std::min_element(begin(bufAU), end(bufAU)));
+        REQUIRE(hmax(a) == *std::max_element(begin(bufAU), end(bufAU)));
+    }
+    SECTION("multiple vectors") {
+        const std::size_t w = SIMD_WIDTH;
+        U rows[SIMD_WIDTH];
+        for (std::size_t i = 0; i < w; ++i) {
+            U::storage_t u;
+            for (std::size_t j = 0; j < w; ++j) { u[j] = bufAU[(i + j) % w] ^ bufBU[i]; }
+            rows[i] = u;
+        }
+        const U::storage_t sum(reduce_n(rows, sd::op_add{}));
+        const U::storage_t max(reduce_n(rows, sd::op_max{}));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sum[i] == hsum(rows[i]));
+            REQUIRE(max[i] == hmax(rows[i]));
+        }
+    }
+    SECTION("prefix scans") {
+        const U::storage_t sum(inclusive_scan(U(bufAU), sd::op_add{}));
+        const U::storage_t max(exclusive_scan(U(bufAU), sd::op_max{}));
+        scalar_t acc = 0, top = 0;
+        for (std::size_t i = 0; i < SIMD_WIDTH; ++i) {
+            REQUIRE(max[i] == top);
+            acc = scalar_t(acc + bufAU[i]);
+            top = std::max(top, bufAU[i]);
+            REQUIRE(sum[i] == acc);
+        }
+    }
+}
+
+// a pattern that moves lanes across 128-bit halves and one that keeps them in place
+#if SIMD_WIDTH == 8
+#define SHUFFLE_ANY 5, 0, 7, 2, 1, 4, 6, 6
+#define SHUFFLE_IN_HALF 1, 0, 3, 3, 5, 4, 7, 7
+#elif SIMD_WIDTH == 16
+#define SHUFFLE_ANY 3, 3, 0, 15, 8, 9, 1, 2, 14, 13, 12, 4, 5, 6, 7, 10
+#define SHUFFLE_IN_HALF 7, 6, 5, 4, 3, 2, 1, 0, 8, 8, 9, 9, 10, 11, 12, 15
+#elif SIMD_WIDTH == 32
+#define SHUFFLE_ANY                                                                                \
+    31, 0, 17, 16, 2, 3, 30, 29, 4, 5, 6, 7, 18, 19, 20, 21, 1, 8, 9, 10, 11, 12, 13, 14, 15, 22,  \
+        23, 24, 25, 26, 27, 28
+#define SHUFFLE_IN_HALF                                                                            \
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20,  \
+        21, 21, 22, 22, 31, 30
+#endif
+
+TEST_CASE(SIMD_TYPE " lane permutations", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    const std::size_t w = SIMD_WIDTH;
+    U::storage_t sa, sb;
+    scalar_t va = 1, vb = 101;
+    for (std::size_t i = 0; i < w; ++i) {
+        sa[i] = va++;
+        sb[i] = vb++;
+    }
+    const U a = sa;
+    const U b = sb;
+    U::storage_t r;
+
+    SECTION("shuffle") {
+        const std::size_t any[] = {SHUFFLE_ANY};
+        r = sd::shuffle<SHUFFLE_ANY>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[any[i]]); }
+        const std::size_t in_half[] = {SHUFFLE_IN_HALF};
+        r = sd::shuffle<SHUFFLE_IN_HALF>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[in_half[i]]); }
+    }
+    SECTION("blend") {
+        constexpr std::uint64_t mask = 0x9a5c3e6dULL & ((std::uint64_t(1) << SIMD_WIDTH) - 1);
+        r = sd::blend<mask>(a, b);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(r[i] == (((mask >> i) & 1) ? sb[i] : sa[i]));
+        }
+        // the same pattern in both 128-bit halves
+        constexpr std::uint64_t half = 0x3e6dULL & ((std::uint64_t(1) << SIMD_WIDTH / 2) - 1);
+        constexpr std::uint64_t twice = half | half << (SIMD_WIDTH / 2);
+        r = sd::blend<twice>(a, b);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(r[i] == (((twice >> i) & 1) ? sb[i] : sa[i]));
+        }
+    }
+    SECTION("reverse and rotate") {
+        r = reverse(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[w - 1 - i]); }
+        r = sd::rotate_lanes<3>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[(i + 3) % w]); }
+        r = sd::broadcast_lane<SIMD_WIDTH - 1>(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(r[i] == sa[w - 1]); }
+    }
+    SECTION("interleave") {
+        // a0, b0, a1, b1, ...
+        auto seq = [&](std::size_t k) { return k % 2 == 0 ? sa[k / 2] : sb[k / 2]; };
+        const U::storage_t lo(interleave_lo(a, b));
+        const U::storage_t hi(interleave_hi(a, b));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(lo[i] == seq(i));
+            REQUIRE(hi[i] == seq(w + i));
+        }
+    }
+}
+
+#undef SHUFFLE_ANY
+#undef SHUFFLE_IN_HALF
+
+TEST_CASE(SIMD_TYPE " compress and expand", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    const std::size_t w = SIMD_WIDTH;
+    const uint32_t patterns[] = {0U, ~0U, 1U, 0x80000001U, 0x5a5a5a5aU, 0xf00f0ff0U, 0x3e6d91c7U};
+
+    for (uint32_t bits : patterns) {
+        const U::mask_t m(bits & U::mask_t::all_bits);
+        std::vector<scalar_t> sel;
+        for (std::size_t i = 0; i < w; ++i) {
+            if (m[int(i)]) { sel.push_back(bufAU[i]); }
+        }
+        const std::size_t n = sel.size();
+
+        std::vector<scalar_t> out(w + 1, scalar_t(7));
+        REQUIRE(compress_store(out.data(), U(bufAU), m) == n);
+        REQUIRE(std::equal(sel.begin(), sel.end(), out.begin()));
+        REQUIRE(out[n] == scalar_t(7));
+
+        const U::storage_t c(compress(U(bufAU), m));
+        const U::storage_t e(sd::expand_load<U>(sel.data(), m));
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(c[i] == (i < n ? sel[i] : 0));
+            REQUIRE(e[i] == (m[int(i)] ? bufAU[i] : 0));
+        }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " interleaved channels", SIMD_TEST_TAG) {
+    using scalar_t = U::scalar_t;
+    const std::size_t w = SIMD_WIDTH;
+    std::vector<scalar_t> in(4 * w);
+    for (std::size_t k = 0; k < 4 * w; ++k) { in[k] = scalar_t(k * 3 + 1); }
+
+    SECTION("two channels") {
+        U x, y;
+        sd::load_deinterleave<2>(in.data(), x, y);
+        const U::storage_t sx(x), sy(y);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sx[i] == in[2 * i]);
+            REQUIRE(sy[i] == in[2 * i + 1]);
+        }
+        std::vector<scalar_t> out(2 * w);
+        sd::store_interleave<2>(out.data(), x, y);
+        REQUIRE(std::equal(out.begin(), out.end(), in.begin()));
+    }
+    SECTION("three channels") {
+        U x, y, z;
+        sd::load_deinterleave<3>(in.data(), x, y, z);
+        const U::storage_t sx(x), sy(y), sz(z);
+        for (std::size_t i = 0; i < w; ++i) {
+            REQUIRE(sx[i] == in[3 * i]);
+            REQUIRE(sy[i] == in[3 * i + 1]);
+            REQUIRE(sz[i] == in[3 * i + 2]);
+        }
+        std::vector<scalar_t> out(3 * w);
+        sd::store_interleave<3>(out.data(), x, y, z);
+        REQUIRE(std::equal(out.begin(), out.end(), in.begin()));
+    }
+    SECTION("four channels") {
+        U r, g, b, a;
+        sd::load_deinterleave<4>(in.data(), r, g, b, a);
+        const U::storage_t sa(a);
+        for (std::size_t i = 0; i < w; ++i) { REQUIRE(sa[i] == in[4 * i + 3]); }
+        std::vector<scalar_t> out(4 * w);
+        sd::store_interleave<4>(out.data(), r, g, b, a);
+        REQUIRE(out == in);
+    }
+}
+
+TEST_CASE(SIMD_TYPE " conditional", SIMD_TEST_TAG) {
+    B ab = bufAB;
+    U au = bufAU;
+    S as = bufAS;
+    B bb = bufBB;
+    U bu = bufBU;
+    S bs = bufBS;
+
+    B sel = as >= bs;
+    auto sel_mask = mask(sel);
+
+    B::storage_t rb(cond(sel, ab, bb));
+    U::storage_t ru(cond(sel, au, bu));
+    S::storage_t rs(cond(sel, as, bs));
+
+    for (auto i = 0U; i < S::width; ++i) {
+        REQUIRE((rb[i]) == (sel_mask[int(i)] ? bufAB[i] : bufBB[i]));
+        REQUIRE((ru[i]) == (sel_mask[int(i)] ? bufAU[i] : bufBU[i]));
+        REQUIRE((rs[i]) == (sel_mask[int(i)] ? bufAS[i] : bufBS[i]));
+    }
+}
+
+TEST_CASE(SIMD_TYPE " mask", SIMD_TEST_TAG) {
+    SECTION("mask itself") {
+        auto expected = [](const B::storage_t& s) {
+            B::mask_t res(0U);
+            for (auto i = 0U; i < s.size(); ++i) {
+                if (sd::cast_u(s[i]) & signBitU) { res |= B::mask_t(1U << i); }
+            }
+            return res;
+        };
+
+        REQUIRE(expected(bufAB) == mask(B(bufAB)));
+        REQUIRE(expected(bufBB) == mask(B(bufBB)));
+    }
+    SECTION("any, all") {
+        B a = bufAB;
+        B b = bufBB;
+        REQUIRE(any(a) == any(mask(a)));
+        REQUIRE(any(b) == any(mask(b)));
+        REQUIRE(all(a) == all(mask(a)));
+        REQUIRE(all(b) == all(mask(b)));
+        REQUIRE(all(B(true)));
+        REQUIRE(!any(B(false)));
+    }
+    SECTION("back to vectors") {
+        const B a = bufAB;
+        const B b = bufBB;
+        const auto m = mask(a);
+        REQUIRE(mask(sd::from_mask<U>(m)) == m);
+        REQUIRE(mask(sd::from_mask<U>(~m)) == ~m);
+        REQUIRE(mask(sd::from_mask<B>(mask(b))) == mask(b));
+        const S::storage_t idx(sd::lane_indices<U>(m));
+        std::size_t n = 0;
+        for (auto i : m) { REQUIRE(idx[n++] == S::scalar_t(i)); }
+        REQUIRE(popcount(m) == int(n));
+        for (; n < SIMD_WIDTH; ++n) { REQUIRE(idx[n] == 0); }
+    }
+}
+
+TEST_CASE(SIMD_TYPE " first_scalar", SIMD_TEST_TAG) {
+    B b = bufAB;
+    U u = bufAU;
+    S s = bufAS;
+
+    REQUIRE(bufAB[0] == first_scalar(b));
+    REQUIRE(bufAU[0] == first_scalar(u));
+    REQUIRE(bufAS[0] == first_scalar(s));
+}
+
+TEST_CASE(SIMD_TYPE " widening and narrowing", SIMD_TEST_TAG) {
+    SECTION("uint") {
+        U va = bufAU;
+        auto lo = widen_lo(va);
+        auto hi = widen_hi(va);
+        using W = decltype(lo);
+        ASSERT(W::width * 2 == U::width);
+        ASSERT(sizeof(W::scalar_t) == 2 * sizeof(U::scalar_t));
+        ASSERT(!std::numeric_limits<W::scalar_t>::is_signed);
+
+        W::storage_t rlo(lo), rhi(hi);
+        for (auto i = 0U; i < W::width; ++i) {
+            REQUIRE(rlo[i] == bufAU[i]);
+            REQUIRE(rhi[i] == bufAU[i + W::width]);
+        }
+
+        U::storage_t r(narrow(lo, hi));
+        REQUIRE(r == bufAU);
+    }
+    SECTION("int") {
+        S va = bufAS;
+        auto lo = widen_lo(va);
+        auto hi = widen_hi(va);
+        using W = decltype(lo);
+        ASSERT(W::width * 2 == S::width);
+        ASSERT(sizeof(W::scalar_t) == 2 * sizeof(S::scalar_t));
+        ASSERT(std::numeric_limits<W::scalar_t>::is_signed);
+
+        W::storage_t rlo(lo), rhi(hi);
+        for (auto i = 0U; i < W::width; ++i) {
+            REQUIRE(rlo[i] == bufAS[i]);
+            REQUIRE(rhi[i] == bufAS[i + W::width]);
+        }
+
+        S::storage_t r(narrow(lo, hi));
+        REQUIRE(r == bufAS);
+    }
+    SECTION("uint saturation") {
+        using scalar_t = U::scalar_t;
+        U va = bufAU;
+        auto three = decltype(widen_lo(va))(3U);
+        U::storage_t e, r(narrow(widen_lo(va) * three, widen_hi(va) * three));
+        std::transform(begin(bufAU), end(bufAU), begin(e),
+                       [](scalar_t a) { return saturate_ref<scalar_t>(3 * a); });
+        REQUIRE(r == e);
+    }
+    SECTION("int saturation") {
+        using scalar_t = S::scalar_t;
+        S va = bufAS;
+        auto three = decltype(widen_lo(va))(3);
+        S::storage_t e, r(narrow(widen_lo(va) * three, widen_hi(va) * three));
+        std::transform(begin(bufAS), end(bufAS), begin(e),
+                       [](scalar_t a) { return saturate_ref<scalar_t>(3 * a); });
+        REQUIRE(r == e);
+    }
+}
@@ -0,0 +1,15 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::vec16b16;
+using U = sd::vec16u16;
+using S = sd::vec16s16;
+
+#define SIMD_TYPE "vec16_16"
+#define SIMD_TEST_TAG "[simd_vectors][vec16_16]"
+#define SIMD_WIDTH 16
+#define SIMD_SCALAR_SIZE 2
+
+#include "simd_vector_data16_16.inl"
+
+#include "simd_vector_narrow.inl"
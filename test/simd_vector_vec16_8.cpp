@@ -0,0 +1,15 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::vec16b8;
+using U = sd::vec16u8;
+using S = sd::vec16s8;
+
+#define SIMD_TYPE "vec16_8"
+#define SIMD_TEST_TAG "[simd_vectors][vec16_8]"
+#define SIMD_WIDTH 16
+#define SIMD_SCALAR_SIZE 1
+
+#include "simd_vector_data16_8.inl"
+
+#include "simd_vector_narrow.inl"
@@ -0,0 +1,54 @@
+#include <catch2/catch.hpp>
+#include <simdee/simd_vectors/dual.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::vec32b8;
+using U = sd::vec32u8;
+using S = sd::vec32s8;
+
+#define SIMD_TYPE "vec32_8"
+#define SIMD_TEST_TAG "[simd_vectors][vec32_8]"
+#define SIMD_WIDTH 32
+#define SIMD_SCALAR_SIZE 1
+
+#include "simd_vector_data32_8.inl"
+
+#include "simd_vector_narrow.inl"
+
+TEST_CASE("vec32_8 paired to 64 lanes", "[simd_vectors][vec32_8]") {
+    using U64 = sd::dual<U>;
+    using mask_t = U64::mask_t;
+    static_assert(std::is_same<mask_t::bits_t, uint64_t>::value, "64-bit mask expected");
+
+    U64::storage_t s;
+    for (std::size_t i = 0; i < U64::width; ++i) { s[i] = uint8_t(i * 37); }
+    const U64 x(s);
+    const mask_t m = mask(x < U64(uint8_t(100)));
+    for (std::size_t i = 0; i < U64::width; ++i) { REQUIRE(m[int(i)] == (s[i] < 100)); }
+    REQUIRE(find_last(m) == 63);
+    REQUIRE(mask(sd::from_mask<U64>(m)) == m);
+
+    std::vector<uint8_t> out(U64::width);
+    const std::size_t n = compress_store(out.data(), x, m);
+    REQUIRE(n == std::size_t(popcount(m)));
+    std::size_t k = 0;
+    for (auto i : m) { REQUIRE(out[k++] == s[i]); }
+}
+
+TEST_CASE("vec32_8 paired to 64 lanes: prefix scans", "[simd_vectors][vec32_8]") {
+    using U64 = sd::dual<U>;
+
+    U64::storage_t s;
+    for (std::size_t i = 0; i < U64::width; ++i) { s[i] = uint8_t(i * 37 + 11); }
+    const U64::storage_t sum(inclusive_scan(U64(s), sd::op_add{}));
+    const U64::storage_t max(exclusive_scan(U64(s), sd::op_max{}));
+    const U64::storage_t off(exclusive_scan(U64(s), sd::op_add{}, uint8_t(5)));
+    uint8_t acc = 0, top = 0;
+    for (std::size_t i = 0; i < U64::width; ++i) {
+        REQUIRE(max[i] == top);
+        REQUIRE(off[i] == uint8_t(acc + 5));
+        acc = uint8_t(acc + s[i]);
+        top = std::max(top, s[i]);
+        REQUIRE(sum[i] == acc);
+    }
+}
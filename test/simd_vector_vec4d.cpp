@@ -0,0 +1,16 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::vec4b64;
+using F = sd::vec4d;
+using U = sd::vec4u64;
+using S = sd::vec4s64;
+
+#define SIMD_TYPE "vec4d"
+#define SIMD_TEST_TAG "[simd_vectors][vec4d]"
+#define SIMD_WIDTH 4
+#define SIMD_SCALAR_SIZE 8
+
+#include "simd_vector_data4_64.inl"
+
+#include "simd_vector.inl"
@@ -0,0 +1,15 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+
+using B = sd::vec8b16;
+using U = sd::vec8u16;
+using S = sd::vec8s16;
+
+#define SIMD_TYPE "vec8_16"
+#define SIMD_TEST_TAG "[simd_vectors][vec8_16]"
+#define SIMD_WIDTH 8
+#define SIMD_SCALAR_SIZE 2
+
+#include "simd_vector_data8_16.inl"
+
+#include "simd_vector_narrow.inl"
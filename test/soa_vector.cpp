@@ -0,0 +1,73 @@
+#include <catch2/catch.hpp>
+#include <simdee/simdee.hpp>
+#include <simdee/util/soa_vector.hpp>
+
+namespace {
+    template <typename F>
+    void test_soa_vector() {
+        using soa_t = sd::soa_vector<F, float, float, uint32_t>;
+        using U = typename soa_t::template vector_t<2>;
+        const std::size_t w = F::width;
+        static_assert(std::is_same<typename soa_t::template vector_t<0>, F>::value, "");
+        static_assert(U::width == w, "");
+        static_assert(std::is_same<typename U::scalar_t, uint32_t>::value, "");
+
+        soa_t soa;
+        REQUIRE(soa.empty());
+        REQUIRE(soa.blocks() == 0);
+
+        const std::size_t n = 3 * w + 1;
+        for (std::size_t i = 0; i < n; ++i) soa.push_back(float(i), float(2 * i), uint32_t(i));
+        REQUIRE(soa.size() == n);
+        REQUIRE(soa.blocks() == 4);
+        REQUIRE(soa.block_size(0) == w);
+        REQUIRE(soa.block_size(3) == 1);
+        REQUIRE(all(soa.block_mask(2)));
+        REQUIRE(soa.block_mask(3) == typename soa_t::mask_t(1U));
+        REQUIRE(soa.template get<1>(w + 1) == float(2 * (w + 1)));
+        REQUIRE(soa.template get<2>(n - 1) == uint32_t(n - 1));
+
+        // per-block vectors
+        for (std::size_t b = 0; b < soa.blocks(); ++b) {
+            const F x = soa.template field<0>(b);
+            const U c = soa.template field<2>(b);
+            soa.template field<1>(b) = F(soa.template field<1>(b)) - x;
+            soa.template field<2>(b) = c + U(1U);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(soa.template get<1>(i) == float(i));
+            REQUIRE(soa.template get<2>(i) == uint32_t(i + 1));
+        }
+
+        // the padding lanes are Field() until written, and again after a resize
+        const soa_t& csoa = soa;
+        REQUIRE(csoa.template data<0>(3)[1] == 0.f);
+        REQUIRE(csoa.template data<2>(3)[1] == 1U);
+        soa.resize(2 * w + 1);
+        REQUIRE(soa.blocks() == 3);
+        REQUIRE(csoa.template data<1>(2)[1] == 0.f);
+        REQUIRE(csoa.template data<2>(2)[w - 1] == 0U);
+        REQUIRE(all(F(csoa.template field<0>(0)) == F(soa.template field<1>(0))));
+        soa.resize(4 * w);
+        REQUIRE(soa.template get<0>(4 * w - 1) == 0.f);
+
+        soa.clear();
+        REQUIRE(soa.size() == 0);
+        REQUIRE(soa.blocks() == 0);
+
+        // growing turns overwritten padding back into Field()
+        soa.push_back(1.f, 2.f, 3U);
+        soa.template field<0>(0) = F(soa.template field<0>(0)) + F(5.f);
+        soa.resize(3);
+        REQUIRE(soa.template get<0>(0) == 6.f);
+        REQUIRE(soa.template get<0>(1) == 0.f);
+        REQUIRE(soa.template get<0>(2) == 0.f);
+    }
+}
+
+TEST_CASE("soa_vector", "[soa_vector]") {
+    SECTION("vec4f") { test_soa_vector<sd::vec4f>(); }
+    SECTION("vec8f") { test_soa_vector<sd::vec8f>(); }
+    SECTION("vec<float, 16>") { test_soa_vector<sd::vec<float, 16>>(); }
+    SECTION("dual<dumf>") { test_soa_vector<sd::dual<sd::dumf>>(); }
+}
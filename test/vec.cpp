@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+#include <simdee/vec.hpp>
+
+TEST_CASE("vec aliases", "[vec]") {
+    static_assert(std::is_same<sd::vec<float, 1>, sd::dumf>::value, "");
+    static_assert(std::is_same<sd::vec<float, 2>, sd::dual<sd::dumf>>::value, "");
+    static_assert(std::is_same<sd::vec<float, 4>, sd::vec4f>::value, "");
+    static_assert(std::is_same<sd::vec<float, 8>, sd::vec8f>::value, "");
+    static_assert(std::is_same<sd::vec<float, 16>, sd::dual<sd::vec8f>>::value, "");
+    static_assert(std::is_same<sd::vec<float, 32>, sd::dual<sd::dual<sd::vec8f>>>::value, "");
+    static_assert(std::is_same<sd::vec<sd::bool32_t, 16>, sd::dual<sd::vec8b>>::value, "");
+    static_assert(std::is_same<sd::vec<uint32_t, 16>, sd::dual<sd::vec8u>>::value, "");
+    static_assert(std::is_same<sd::vec<int32_t, 16>, sd::dual<sd::vec8s>>::value, "");
+    static_assert(std::is_same<sd::vec<double, 2>, sd::vec2d>::value, "");
+    static_assert(std::is_same<sd::vec<double, 8>, sd::dual<sd::vec4d>>::value, "");
+    static_assert(std::is_same<sd::vec<int64_t, 4>, sd::vec4s64>::value, "");
+    static_assert(std::is_same<sd::vec<uint16_t, 4>, sd::dual<sd::dual<sd::dumu16>>>::value, "");
+    static_assert(std::is_same<sd::vec<uint16_t, 32>, sd::dual<sd::vec16u16>>::value, "");
+    static_assert(std::is_same<sd::vec<int8_t, 16>, sd::vec16s8>::value, "");
+    static_assert(std::is_same<sd::vec<uint8_t, 64>, sd::dual<sd::vec32u8>>::value, "");
+
+    static_assert(sd::vec<float, 64>::width == 64, "");
+    static_assert(sd::vec<sd::bool8_t, 64>::width == 64, "");
+    static_assert(std::is_same<sd::vec<float, 16>::vec_u, sd::vec<uint32_t, 16>>::value, "");
+}
+
+TEST_CASE("native_vec", "[vec]") {
+#if (!SIMDEE_NEED_INT && SIMDEE_AVX) || SIMDEE_AVX2
+    static_assert(std::is_same<sd::native_vec<float>, sd::vec8f>::value, "");
+    static_assert(std::is_same<sd::native_vec<double>, sd::vec4d>::value, "");
+#else
+    static_assert(std::is_same<sd::native_vec<float>, sd::vec4f>::value, "");
+    static_assert(std::is_same<sd::native_vec<double>, sd::vec2d>::value, "");
+#endif
+#if SIMDEE_AVX2
+    static_assert(std::is_same<sd::native_vec<uint8_t>, sd::vec32u8>::value, "");
+    static_assert(std::is_same<sd::native_vec<int16_t>, sd::vec16s16>::value, "");
+#else
+    static_assert(std::is_same<sd::native_vec<uint8_t>, sd::vec16u8>::value, "");
+    static_assert(std::is_same<sd::native_vec<int16_t>, sd::vec8s16>::value, "");
+#endif
+    static_assert(sd::native_vec<sd::bool32_t>::width == sd::native_width<float>::value, "");
+    static_assert(sd::native_vec<int32_t>::width == sd::native_width<uint32_t>::value, "");
+    static_assert(sizeof(sd::native_vec<uint64_t>) == sizeof(sd::native_vec<float>), "");
+}
+
+TEST_CASE("vec wide kernel", "[vec]") {
+    using F = sd::vec<float, 32>;
+    using S = sd::vec<int32_t, 32>;
+    const std::size_t n = 4 * F::width;
+    alignas(F) float in[n], out[n];
+    for (std::size_t i = 0; i < n; ++i) in[i] = float(i);
+
+    F acc = sd::zero();
+    for (std::size_t i = 0; i < n; i += F::width) {
+        F x = sd::aligned(&in[i]);
+        acc = acc + x;
+        (x * F(2.f) + F(1.f)).aligned_store(&out[i]);
+    }
+
+    REQUIRE(hsum(acc) == float(n * (n - 1) / 2));
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(out[i] == float(2 * i + 1));
+
+    S s = S(F(sd::aligned(&out[0])));
+    REQUIRE(first_scalar(s) == 1);
+    REQUIRE(mask(F(sd::aligned(&in[0])) < F(3.f)) == F::mask_t(0x7U));
+}